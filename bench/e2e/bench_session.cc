@@ -0,0 +1,388 @@
+// bench/e2e/bench_session.cc
+#include "e2e/bench_session.h"
+
+#include <chrono>
+
+namespace h2v {
+namespace bench {
+
+namespace {
+
+// Windows generous enough that flow control never stalls the bench; the
+// FlowController still returns credit as data is consumed.
+constexpr int64_t kStreamWindow = 16 * 1024 * 1024;
+constexpr int64_t kConnectionWindow = 1024 * 1024 * 1024;
+
+frame::FlowControlConfig BenchFlowConfig() noexcept {
+  frame::FlowControlConfig config;
+  config.initial_stream_window = kStreamWindow;
+  config.initial_connection_window = kConnectionWindow;
+  config.auto_tune = false;
+  return config;
+}
+
+uint64_t NowNs() noexcept {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+void PutSetting(uint8_t*& out, uint16_t id, uint32_t value) noexcept {
+  out[0] = uint8_t(id >> 8);
+  out[1] = uint8_t(id);
+  frame::PutUint32BE(out + 2, value);
+  out += 6;
+}
+
+absl::Span<const uint8_t> Block(const std::vector<uint8_t>& block) noexcept {
+  return absl::MakeConstSpan(block.data(), block.size());
+}
+
+}  // namespace
+
+// -----------------------------------------------------------------------------
+// ServerSession
+// -----------------------------------------------------------------------------
+
+ServerSession::ServerSession(const BenchOptions& options,
+                             const EncodedBlocks& blocks,
+                             absl::Span<const uint8_t> body,
+                             transport::Connection& conn) noexcept
+                : options_(options),
+                  blocks_(blocks),
+                  body_(body),
+                  conn_(conn),
+                  flow_(BenchFlowConfig()) {}
+
+void ServerSession::Start() noexcept {
+  uint8_t settings[12];
+  uint8_t* p = settings;
+  PutSetting(p, frame::SETTINGS_ID::MAX_CONCURRENT_STREAMS, options_.streams);
+  PutSetting(p, frame::SETTINGS_ID::INITIAL_WINDOW_SIZE,
+             static_cast<uint32_t>(kStreamWindow));
+  writer_.WriteControl(frame::FrameType::Settings, frame::FRAME_FLAG::NONE, 0,
+                       absl::MakeConstSpan(settings, sizeof(settings)));
+  flow_.Start(writer_);
+  streams_.SetInitialWindows(frame::kDefaultInitialWindowSize, kStreamWindow);
+  Flush();
+}
+
+void ServerSession::OnRead(absl::Span<const uint8_t> data) noexcept {
+  std::size_t consumed = 0;
+  if (parser_.Parse(data, consumed) != frame::FRAME_ERR::NONE) {
+    conn_.Close();
+    return;
+  }
+  // answered once Parse() returns: the parser applies END_STREAM after the
+  // visitor callback, so closing the stream from there would race it
+  for (uint32_t id : ready_) {
+    frame::Stream* stream = streams_.Find(id);
+    if (stream && stream->state == frame::StreamState::HalfClosedRemote) {
+      Respond(stream);
+    }
+  }
+  ready_.clear();
+  Flush();
+}
+
+void ServerSession::Flush() noexcept {
+  if (writer_.Flush(conn_) == frame::FRAME_ERR::TRANSPORT_ERROR) {
+    conn_.Close();
+  }
+}
+
+void ServerSession::Decode(frame::Stream* stream,
+                           absl::Span<const uint8_t> fragment,
+                           bool end_headers, bool end_stream) noexcept {
+  const hpack::HpackErrorCode rc =
+      decoder_.Decode(fragment, end_headers, fields_);
+  if (rc != hpack::HPACK_ERR::NONE &&
+      rc != hpack::HPACK_ERR::DECODE_HEADER_LIST_TOO_LARGE) {
+    conn_.Close();  // COMPRESSION_ERROR
+    return;
+  }
+  if (end_headers && end_stream && stream) {
+    ready_.push_back(stream->id);
+  }
+}
+
+void ServerSession::OnHeaders(uint32_t stream_id, frame::Stream* stream,
+                              absl::Span<const uint8_t> fragment,
+                              bool end_headers, bool end_stream) {
+  block_end_stream_ = end_stream;
+  Decode(stream, fragment, end_headers, end_stream);
+}
+
+void ServerSession::OnContinuation(uint32_t stream_id, frame::Stream* stream,
+                                   absl::Span<const uint8_t> fragment,
+                                   bool end_headers) {
+  Decode(stream, fragment, end_headers, block_end_stream_);
+}
+
+void ServerSession::OnData(uint32_t stream_id, frame::Stream* stream,
+                           absl::Span<const uint8_t> data,
+                           uint32_t frame_length, bool end_stream) {
+  // the body is dropped on arrival and padding counts as consumed at once,
+  // so the whole frame is handed back; a rejected stream's DATA
+  // (stream nullptr) only moves the connection window
+  if (flow_.OnDataReceived(stream, frame_length, 0, writer_) !=
+          frame::FRAME_ERR::NONE ||
+      flow_.OnConsumed(stream, frame_length, writer_) !=
+          frame::FRAME_ERR::NONE) {
+    conn_.Close();
+    return;
+  }
+  if (end_stream && stream) {
+    ready_.push_back(stream->id);
+  }
+}
+
+void ServerSession::Respond(frame::Stream* stream) noexcept {
+  const bool first = first_response_;
+  first_response_ = false;
+  const bool has_body = !body_.empty();
+  const bool has_trailers = !blocks_.trailers.empty();
+
+  const uint32_t id = stream->id;
+  frame::ApplyTransition(stream->state, frame::StreamEvent::Headers,
+                         frame::StreamDirection::Send);
+  writer_.WriteHeaders(
+      id, Block(first ? blocks_.first_headers : blocks_.headers),
+      !has_body && !has_trailers);
+  if (has_body) {
+    writer_.WriteData(id, body_, !has_trailers);
+  }
+  if (has_trailers) {
+    writer_.WriteHeaders(
+        id, Block(first ? blocks_.first_trailers : blocks_.trailers), true);
+  }
+  frame::ApplyTransition(stream->state, frame::StreamEvent::EndStream,
+                         frame::StreamDirection::Send);
+  streams_.Close(stream);
+}
+
+void ServerSession::OnSetting(uint16_t id, uint32_t value) {
+  if (id == frame::SETTINGS_ID::MAX_FRAME_SIZE) {
+    writer_.SetMaxFrameSize(value);
+  }
+}
+
+void ServerSession::OnSettingsEnd(bool ack) {
+  if (!ack) {
+    writer_.WriteControl(frame::FrameType::Settings, frame::FRAME_FLAG::ACK, 0,
+                         {});
+  }
+}
+
+void ServerSession::OnPing(bool ack, absl::Span<const uint8_t> opaque) {
+  if (!ack) {
+    writer_.WriteControl(frame::FrameType::Ping, frame::FRAME_FLAG::ACK, 0,
+                         opaque);
+  }
+}
+
+void ServerSession::OnStreamError(uint32_t stream_id,
+                                  frame::Http2ErrorCode code) {
+  uint8_t payload[4];
+  frame::PutUint32BE(payload, static_cast<uint32_t>(code));
+  writer_.WriteControl(frame::FrameType::RstStream, frame::FRAME_FLAG::NONE,
+                       stream_id, absl::MakeConstSpan(payload, 4));
+}
+
+void ServerSession::OnConnectionError(frame::Http2ErrorCode code,
+                                      absl::string_view reason) {
+  conn_.Close();
+}
+
+// -----------------------------------------------------------------------------
+// ClientSession
+// -----------------------------------------------------------------------------
+
+ClientSession::ClientSession(const BenchOptions& options,
+                             const EncodedBlocks& blocks,
+                             absl::Span<const uint8_t> body,
+                             ClientStats& stats,
+                             const std::atomic<bool>& measuring,
+                             transport::Connection& conn) noexcept
+                : options_(options),
+                  blocks_(blocks),
+                  body_(body),
+                  stats_(stats),
+                  measuring_(measuring),
+                  conn_(conn),
+                  flow_(BenchFlowConfig()),
+                  requests_(options.streams) {
+  for (Request& r : requests_) {
+    r.next_free = free_;
+    free_ = &r;
+  }
+}
+
+void ClientSession::Start() noexcept {
+  // the preface is not a frame; a fresh socket always takes 24 bytes
+  const struct iovec preface = {
+      const_cast<char*>(frame::kConnectionPreface.data()),
+      frame::kConnectionPreface.size()};
+  if (conn_.Writev(&preface, 1) !=
+      static_cast<int64_t>(frame::kConnectionPreface.size())) {
+    stats_.errors++;
+    conn_.Close();
+    return;
+  }
+
+  uint8_t settings[12];
+  uint8_t* p = settings;
+  PutSetting(p, frame::SETTINGS_ID::ENABLE_PUSH, 0);
+  PutSetting(p, frame::SETTINGS_ID::INITIAL_WINDOW_SIZE,
+             static_cast<uint32_t>(kStreamWindow));
+  writer_.WriteControl(frame::FrameType::Settings, frame::FRAME_FLAG::NONE, 0,
+                       absl::MakeConstSpan(settings, sizeof(settings)));
+  flow_.Start(writer_);
+  streams_.SetInitialWindows(frame::kDefaultInitialWindowSize, kStreamWindow);
+  for (uint32_t i = 0; i < options_.streams; ++i) {
+    Issue();
+  }
+  Flush();
+}
+
+void ClientSession::Issue() noexcept {
+  Request* r = free_;
+  if (!r) {
+    return;
+  }
+  frame::Stream* s = nullptr;
+  const uint32_t id = streams_.NextLocalStreamId();
+  if (streams_.Open(id, s) != frame::FRAME_ERR::NONE) {
+    stats_.errors++;
+    return;
+  }
+  free_ = r->next_free;
+  r->start_ns = NowNs();
+  s->user_data = r;
+
+  const bool first = first_request_;
+  first_request_ = false;
+  const bool has_body = !body_.empty();
+  frame::ApplyTransition(s->state, frame::StreamEvent::Headers,
+                         frame::StreamDirection::Send);
+  writer_.WriteHeaders(id, Block(first ? blocks_.first_headers
+                                       : blocks_.headers),
+                       !has_body);
+  if (has_body) {
+    writer_.WriteData(id, body_, true);
+  }
+  frame::ApplyTransition(s->state, frame::StreamEvent::EndStream,
+                         frame::StreamDirection::Send);
+}
+
+void ClientSession::OnRead(absl::Span<const uint8_t> data) noexcept {
+  std::size_t consumed = 0;
+  if (parser_.Parse(data, consumed) != frame::FRAME_ERR::NONE) {
+    stats_.errors++;
+    conn_.Close();
+    return;
+  }
+  // streams are reopened here, not from OnStreamClosed(), so the parser
+  // never sees the table change under it
+  for (; to_issue_ > 0; --to_issue_) {
+    if (!draining_) {
+      Issue();
+    }
+  }
+  Flush();
+}
+
+void ClientSession::Flush() noexcept {
+  if (writer_.Flush(conn_) == frame::FRAME_ERR::TRANSPORT_ERROR) {
+    stats_.errors++;
+    conn_.Close();
+  }
+}
+
+void ClientSession::OnHeaders(uint32_t stream_id, frame::Stream* stream,
+                              absl::Span<const uint8_t> fragment,
+                              bool end_headers, bool end_stream) {
+  if (decoder_.Decode(fragment, end_headers, fields_) !=
+      hpack::HPACK_ERR::NONE) {
+    stats_.errors++;
+    conn_.Close();
+  }
+}
+
+void ClientSession::OnContinuation(uint32_t stream_id, frame::Stream* stream,
+                                   absl::Span<const uint8_t> fragment,
+                                   bool end_headers) {
+  OnHeaders(stream_id, stream, fragment, end_headers, false);
+}
+
+void ClientSession::OnData(uint32_t stream_id, frame::Stream* stream,
+                           absl::Span<const uint8_t> data,
+                           uint32_t frame_length, bool end_stream) {
+  // as on the server: padding included, all of it consumed at once
+  if (flow_.OnDataReceived(stream, frame_length, 0, writer_) !=
+          frame::FRAME_ERR::NONE ||
+      flow_.OnConsumed(stream, frame_length, writer_) !=
+          frame::FRAME_ERR::NONE) {
+    stats_.errors++;
+    conn_.Close();
+    return;
+  }
+  if (stream && measuring_.load(std::memory_order_relaxed)) {
+    stats_.response_bytes += data.size();
+  }
+}
+
+void ClientSession::OnSettingsEnd(bool ack) {
+  if (!ack) {
+    writer_.WriteControl(frame::FrameType::Settings, frame::FRAME_FLAG::ACK, 0,
+                         {});
+  }
+}
+
+void ClientSession::OnPing(bool ack, absl::Span<const uint8_t> opaque) {
+  if (!ack) {
+    writer_.WriteControl(frame::FrameType::Ping, frame::FRAME_FLAG::ACK, 0,
+                         opaque);
+  }
+}
+
+void ClientSession::OnRstStream(uint32_t stream_id,
+                                frame::Http2ErrorCode code) {
+  stats_.errors++;
+  frame::Stream* s = streams_.Find(stream_id);
+  if (s && s->user_data) {
+    static_cast<Request*>(s->user_data)->start_ns = 0;  // not a completion
+  }
+}
+
+void ClientSession::OnGoaway(uint32_t last_stream_id,
+                             frame::Http2ErrorCode code,
+                             absl::Span<const uint8_t> debug_data) {
+  stats_.errors++;
+  draining_ = true;
+}
+
+void ClientSession::OnStreamClosed(frame::Stream* stream) {
+  Request* r = static_cast<Request*>(stream->user_data);
+  if (!r) {
+    return;
+  }
+  stream->user_data = nullptr;
+  if (r->start_ns && measuring_.load(std::memory_order_relaxed)) {
+    stats_.completed++;
+    stats_.latency.Record(NowNs() - r->start_ns);
+  }
+  r->next_free = free_;
+  free_ = r;
+  to_issue_++;
+}
+
+void ClientSession::OnConnectionError(frame::Http2ErrorCode code,
+                                      absl::string_view reason) {
+  stats_.errors++;
+  conn_.Close();
+}
+
+}  // namespace bench
+}  // namespace h2v
@@ -0,0 +1,174 @@
+// bench/e2e/bench_session.h
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "absl/types/span.h"
+#include "e2e/header_sets.h"
+#include "e2e/latency_histogram.h"
+#include "h2v/frame/flow_control.h"
+#include "h2v/frame/frame_parser.h"
+#include "h2v/frame/frame_writer.h"
+#include "h2v/frame/stream_table.h"
+#include "h2v/hpack/decoder.h"
+#include "h2v/transport/transport.h"
+
+namespace h2v {
+namespace bench {
+
+/// @brief Workload shared by both ends of the benchmark.
+struct BenchOptions {
+  HeaderSetKind headers = HeaderSetKind::Browser;
+  /// Concurrent streams per connection.
+  uint32_t streams = 32;
+  std::size_t request_body = 0;
+  std::size_t response_body = 1024;
+};
+
+/// @brief Counters of one load-generator thread.
+struct ClientStats {
+  uint64_t completed = 0;  ///< responses inside the measurement window
+  uint64_t errors = 0;     ///< RST_STREAM, GOAWAY or failed connections
+  uint64_t response_bytes = 0;
+  LatencyHistogram latency;
+};
+
+/// @brief Counts decoded fields; the bench only needs HPACK to run.
+class CountingHandler : public hpack::HeaderHandler {
+ public:
+  void OnHeader(const hpack::DecodedHeader& header) override {
+    fields++;
+    bytes += header.name.size() + header.value.size();
+  }
+  uint64_t fields = 0;
+  uint64_t bytes = 0;
+};
+
+/// @brief Server end of one connection: answers every request with the
+///   profile's response headers, `response_body` bytes and, for gRPC,
+///   trailers.
+class ServerSession : public frame::FrameVisitor {
+ public:
+  ServerSession(const BenchOptions& options, const EncodedBlocks& blocks,
+                absl::Span<const uint8_t> body,
+                transport::Connection& conn) noexcept;
+
+  void Start() noexcept;
+  void OnRead(absl::Span<const uint8_t> data) noexcept;
+  void OnWritable() noexcept {
+    Flush();
+  }
+
+  void OnHeaders(uint32_t stream_id, frame::Stream* stream,
+                 absl::Span<const uint8_t> fragment, bool end_headers,
+                 bool end_stream) override;
+  void OnContinuation(uint32_t stream_id, frame::Stream* stream,
+                      absl::Span<const uint8_t> fragment,
+                      bool end_headers) override;
+  void OnData(uint32_t stream_id, frame::Stream* stream,
+              absl::Span<const uint8_t> data, uint32_t frame_length,
+              bool end_stream) override;
+  void OnSetting(uint16_t id, uint32_t value) override;
+  void OnSettingsEnd(bool ack) override;
+  void OnPing(bool ack, absl::Span<const uint8_t> opaque) override;
+  void OnStreamError(uint32_t stream_id, frame::Http2ErrorCode code) override;
+  void OnConnectionError(frame::Http2ErrorCode code,
+                         absl::string_view reason) override;
+
+ private:
+  const BenchOptions& options_;
+  const EncodedBlocks& blocks_;
+  absl::Span<const uint8_t> body_;
+  transport::Connection& conn_;
+
+  frame::StreamTable streams_{true};
+  frame::FrameParser parser_{streams_, *this, true};
+  frame::FrameWriter writer_;
+  frame::FlowController flow_;
+  hpack::Decoder decoder_;
+  CountingHandler fields_;
+  std::vector<uint32_t> ready_;  ///< requests complete in this read
+  bool first_response_ = true;
+  bool block_end_stream_ = false;
+
+  void Decode(frame::Stream* stream, absl::Span<const uint8_t> fragment,
+              bool end_headers, bool end_stream) noexcept;
+  void Respond(frame::Stream* stream) noexcept;
+  void Flush() noexcept;
+};
+
+/// @brief Load-generator end of one connection: keeps `streams` requests in
+///   flight and records the latency of each.
+class ClientSession : public frame::FrameVisitor {
+ public:
+  ClientSession(const BenchOptions& options, const EncodedBlocks& blocks,
+                absl::Span<const uint8_t> body, ClientStats& stats,
+                const std::atomic<bool>& measuring,
+                transport::Connection& conn) noexcept;
+
+  void Start() noexcept;
+  /// @brief Stop issuing new requests; in-flight ones still complete.
+  void Drain() noexcept {
+    draining_ = true;
+  }
+  bool Idle() const noexcept {
+    return streams_.ActiveCount() == 0;
+  }
+  void OnRead(absl::Span<const uint8_t> data) noexcept;
+  void OnWritable() noexcept {
+    Flush();
+  }
+
+  void OnHeaders(uint32_t stream_id, frame::Stream* stream,
+                 absl::Span<const uint8_t> fragment, bool end_headers,
+                 bool end_stream) override;
+  void OnContinuation(uint32_t stream_id, frame::Stream* stream,
+                      absl::Span<const uint8_t> fragment,
+                      bool end_headers) override;
+  void OnData(uint32_t stream_id, frame::Stream* stream,
+              absl::Span<const uint8_t> data, uint32_t frame_length,
+              bool end_stream) override;
+  void OnSettingsEnd(bool ack) override;
+  void OnPing(bool ack, absl::Span<const uint8_t> opaque) override;
+  void OnRstStream(uint32_t stream_id, frame::Http2ErrorCode code) override;
+  void OnGoaway(uint32_t last_stream_id, frame::Http2ErrorCode code,
+                absl::Span<const uint8_t> debug_data) override;
+  void OnStreamClosed(frame::Stream* stream) override;
+  void OnConnectionError(frame::Http2ErrorCode code,
+                         absl::string_view reason) override;
+
+ private:
+  struct Request {
+    uint64_t start_ns = 0;
+    Request* next_free = nullptr;
+  };
+
+  const BenchOptions& options_;
+  const EncodedBlocks& blocks_;
+  absl::Span<const uint8_t> body_;
+  ClientStats& stats_;
+  const std::atomic<bool>& measuring_;
+  transport::Connection& conn_;
+
+  frame::StreamTable streams_{false};
+  frame::FrameParser parser_{streams_, *this, false};
+  frame::FrameWriter writer_;
+  frame::FlowController flow_;
+  hpack::Decoder decoder_;
+  CountingHandler fields_;
+
+  std::vector<Request> requests_;
+  Request* free_ = nullptr;
+  bool first_request_ = true;
+  bool draining_ = false;
+  uint32_t to_issue_ = 0;
+
+  void Issue() noexcept;
+  void Flush() noexcept;
+};
+
+}  // namespace bench
+}  // namespace h2v
@@ -0,0 +1,507 @@
+// bench/e2e/e2e_bench_main.cc
+//
+// Loopback end-to-end HTTP/2 load benchmark (h2load-style).
+//
+// Starts an in-process h2v server on 127.0.0.1 over the reference transport
+// and drives it with an h2v-based load generator, so the whole frame + HPACK
+// pipeline is measured: framing, stream state, flow control, header block
+// decoding and the transport, on both ends.
+//
+//   h2v_e2e_bench --connections=16 --streams=64 --headers=grpc
+//                 --server-threads=2 --client-threads=2 --duration=10
+//
+// Reports requests/s, response throughput, p50/p99/p999 latency and CPU time
+// per request (server threads, client threads and the whole process).
+#include <pthread.h>
+#include <sys/resource.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "absl/strings/numbers.h"
+#include "absl/strings/string_view.h"
+#include "e2e/bench_session.h"
+#include "e2e/header_sets.h"
+#include "h2v/transport/epoll_transport.h"
+#include "h2v/transport/transport.h"
+#if defined(H2V_HAVE_IO_URING)
+#include "h2v/transport/uring_transport.h"
+#endif
+
+namespace h2v {
+namespace bench {
+namespace {
+
+struct Args {
+  BenchOptions options;
+  std::string transport = "auto";
+  uint32_t connections = 8;
+  uint32_t server_threads = 1;
+  uint32_t client_threads = 1;
+  double duration_s = 10;
+  double warmup_s = 2;
+  bool request_body_set = false;
+};
+
+void Usage() {
+  std::fprintf(
+      stderr,
+      "usage: h2v_e2e_bench [options]\n"
+      "  --transport=auto|uring|epoll  reference transport (auto)\n"
+      "  --connections=N               total connections (8)\n"
+      "  --streams=N                   concurrent streams per connection (32)\n"
+      "  --headers=browser|grpc        request/response header set (browser)\n"
+      "  --request-body=BYTES          request body (0; grpc: 64)\n"
+      "  --response-body=BYTES         response body (1024)\n"
+      "  --server-threads=N            server event loops (1)\n"
+      "  --client-threads=N            load generator event loops (1)\n"
+      "  --duration=SECONDS            measured interval (10)\n"
+      "  --warmup=SECONDS              unmeasured ramp-up (2)\n");
+}
+
+template <typename T>
+bool ParseNumber(absl::string_view text, T& out) {
+  uint64_t v = 0;
+  if (!absl::SimpleAtoi(text, &v)) {
+    return false;
+  }
+  out = static_cast<T>(v);
+  return static_cast<uint64_t>(out) == v;
+}
+
+bool ParseArgs(int argc, char** argv, Args& args) {
+  for (int i = 1; i < argc; ++i) {
+    absl::string_view arg = argv[i];
+    if (arg == "-h" || arg == "--help") {
+      return false;
+    }
+    if (arg.substr(0, 2) != "--") {
+      std::fprintf(stderr, "unexpected argument: %s\n", argv[i]);
+      return false;
+    }
+    arg.remove_prefix(2);
+    absl::string_view value;
+    const std::size_t eq = arg.find('=');
+    if (eq != absl::string_view::npos) {
+      value = arg.substr(eq + 1);
+      arg = arg.substr(0, eq);
+    } else if (i + 1 < argc) {
+      value = argv[++i];
+    }
+
+    bool ok = true;
+    if (arg == "transport") {
+      args.transport = std::string(value);
+      ok = value == "auto" || value == "uring" || value == "epoll";
+    } else if (arg == "connections") {
+      ok = ParseNumber(value, args.connections) && args.connections > 0;
+    } else if (arg == "streams") {
+      ok = ParseNumber(value, args.options.streams) &&
+           args.options.streams > 0;
+    } else if (arg == "headers") {
+      ok = ParseHeaderSetKind(value, args.options.headers);
+    } else if (arg == "request-body") {
+      ok = ParseNumber(value, args.options.request_body);
+      args.request_body_set = true;
+    } else if (arg == "response-body") {
+      ok = ParseNumber(value, args.options.response_body);
+    } else if (arg == "server-threads") {
+      ok = ParseNumber(value, args.server_threads) && args.server_threads > 0;
+    } else if (arg == "client-threads") {
+      ok = ParseNumber(value, args.client_threads) && args.client_threads > 0;
+    } else if (arg == "duration") {
+      ok = absl::SimpleAtod(value, &args.duration_s) && args.duration_s > 0;
+    } else if (arg == "warmup") {
+      ok = absl::SimpleAtod(value, &args.warmup_s) && args.warmup_s >= 0;
+    } else {
+      std::fprintf(stderr, "unknown option: --%.*s\n", int(arg.size()),
+                   arg.data());
+      return false;
+    }
+    if (!ok) {
+      std::fprintf(stderr, "bad value for --%.*s: %.*s\n", int(arg.size()),
+                   arg.data(), int(value.size()), value.data());
+      return false;
+    }
+  }
+  if (!args.request_body_set && args.options.headers == HeaderSetKind::Grpc) {
+    args.options.request_body = 64;
+  }
+  if (args.client_threads > args.connections) {
+    args.client_threads = args.connections;
+  }
+  return true;
+}
+
+std::unique_ptr<transport::Transport> MakeTransport(const std::string& kind,
+                                                    uint32_t connections) {
+  transport::TransportConfig config;
+  config.max_connections = connections;
+  std::unique_ptr<transport::Transport> t;
+  if (kind == "epoll") {
+    t.reset(new transport::EpollTransport(config));
+  } else if (kind == "uring") {
+#if defined(H2V_HAVE_IO_URING)
+    t.reset(new transport::UringTransport(config));
+#else
+    std::fprintf(stderr, "built without io_uring support\n");
+    return nullptr;
+#endif
+  } else {
+    return transport::CreateTransport(config);
+  }
+  const transport::TransportErrorCode rc = t->Init();
+  if (rc != transport::TRANSPORT_ERR::NONE) {
+    std::fprintf(stderr, "transport init failed: code %d, errno %d (%s)\n", rc,
+                 t->LastErrno(), std::strerror(t->LastErrno()));
+    return nullptr;
+  }
+  return t;
+}
+
+double ThreadCpuSeconds(std::thread& thread) {
+  clockid_t id;
+  timespec ts;
+  if (pthread_getcpuclockid(thread.native_handle(), &id) != 0 ||
+      clock_gettime(id, &ts) != 0) {
+    return 0;
+  }
+  return double(ts.tv_sec) + double(ts.tv_nsec) * 1e-9;
+}
+
+double ProcessCpuSeconds() {
+  rusage ru;
+  getrusage(RUSAGE_SELF, &ru);
+  return double(ru.ru_utime.tv_sec + ru.ru_stime.tv_sec) +
+         double(ru.ru_utime.tv_usec + ru.ru_stime.tv_usec) * 1e-6;
+}
+
+// -----------------------------------------------------------------------------
+// Event loops
+// -----------------------------------------------------------------------------
+
+class ServerLoop : public transport::ConnectionHandler {
+ public:
+  ServerLoop(const BenchOptions& options, const EncodedBlocks& blocks,
+             absl::Span<const uint8_t> body,
+             std::unique_ptr<transport::Transport> transport)
+                  : options_(options),
+                    blocks_(blocks),
+                    body_(body),
+                    transport_(std::move(transport)) {}
+
+  transport::Transport& Transport() {
+    return *transport_;
+  }
+
+  void Run(const std::atomic<bool>& stop) {
+    while (!stop.load(std::memory_order_acquire)) {
+      if (transport_->Poll(100) < 0) {
+        std::fprintf(stderr, "server poll failed: %s\n",
+                     std::strerror(transport_->LastErrno()));
+        return;
+      }
+    }
+  }
+
+  void OnOpen(transport::Connection& conn) noexcept override {
+    auto* session = new ServerSession(options_, blocks_, body_, conn);
+    conn.user_data = session;
+    session->Start();
+  }
+  void OnRead(transport::Connection& conn,
+              absl::Span<const uint8_t> data) noexcept override {
+    static_cast<ServerSession*>(conn.user_data)->OnRead(data);
+  }
+  void OnWritable(transport::Connection& conn) noexcept override {
+    static_cast<ServerSession*>(conn.user_data)->OnWritable();
+  }
+  void OnClose(transport::Connection& conn, int error) noexcept override {
+    delete static_cast<ServerSession*>(conn.user_data);
+    conn.user_data = nullptr;
+  }
+
+ private:
+  const BenchOptions& options_;
+  const EncodedBlocks& blocks_;
+  absl::Span<const uint8_t> body_;
+  std::unique_ptr<transport::Transport> transport_;
+};
+
+class ClientLoop : public transport::ConnectionHandler {
+ public:
+  ClientLoop(const BenchOptions& options, const EncodedBlocks& blocks,
+             absl::Span<const uint8_t> body,
+             const std::atomic<bool>& measuring,
+             std::unique_ptr<transport::Transport> transport)
+                  : options_(options),
+                    blocks_(blocks),
+                    body_(body),
+                    measuring_(measuring),
+                    transport_(std::move(transport)) {}
+
+  transport::Transport& Transport() {
+    return *transport_;
+  }
+  const ClientStats& Stats() const {
+    return stats_;
+  }
+
+  void Run(const std::vector<uint16_t>& ports, const std::atomic<bool>& stop) {
+    for (uint16_t port : ports) {
+      if (transport_->Connect("127.0.0.1", port, *this) !=
+          transport::TRANSPORT_ERR::NONE) {
+        std::fprintf(stderr, "connect failed: %s\n",
+                     std::strerror(transport_->LastErrno()));
+        stats_.errors++;
+      }
+    }
+    while (!stop.load(std::memory_order_acquire)) {
+      if (transport_->Poll(100) < 0) {
+        std::fprintf(stderr, "client poll failed: %s\n",
+                     std::strerror(transport_->LastErrno()));
+        return;
+      }
+    }
+
+    // let in-flight requests finish, then close
+    for (transport::Connection* conn : conns_) {
+      static_cast<ClientSession*>(conn->user_data)->Drain();
+    }
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (std::chrono::steady_clock::now() < deadline && !AllIdle()) {
+      transport_->Poll(10);
+    }
+    closing_ = true;
+    for (transport::Connection* conn : std::vector<transport::Connection*>(
+             conns_.begin(), conns_.end())) {
+      conn->Close();
+    }
+    while (transport_->OpenConnections() > 0 &&
+           std::chrono::steady_clock::now() < deadline) {
+      transport_->Poll(10);
+    }
+  }
+
+  void OnOpen(transport::Connection& conn) noexcept override {
+    auto* session = new ClientSession(options_, blocks_, body_, stats_,
+                                      measuring_, conn);
+    conn.user_data = session;
+    conns_.push_back(&conn);
+    session->Start();
+  }
+  void OnRead(transport::Connection& conn,
+              absl::Span<const uint8_t> data) noexcept override {
+    static_cast<ClientSession*>(conn.user_data)->OnRead(data);
+  }
+  void OnWritable(transport::Connection& conn) noexcept override {
+    static_cast<ClientSession*>(conn.user_data)->OnWritable();
+  }
+  void OnClose(transport::Connection& conn, int error) noexcept override {
+    if (!closing_) {
+      stats_.errors++;
+    }
+    delete static_cast<ClientSession*>(conn.user_data);
+    conn.user_data = nullptr;
+    for (std::size_t i = 0; i < conns_.size(); ++i) {
+      if (conns_[i] == &conn) {
+        conns_[i] = conns_.back();
+        conns_.pop_back();
+        break;
+      }
+    }
+  }
+
+ private:
+  const BenchOptions& options_;
+  const EncodedBlocks& blocks_;
+  absl::Span<const uint8_t> body_;
+  const std::atomic<bool>& measuring_;
+  std::unique_ptr<transport::Transport> transport_;
+  std::vector<transport::Connection*> conns_;
+  ClientStats stats_;
+  bool closing_ = false;
+
+  bool AllIdle() const {
+    for (transport::Connection* conn : conns_) {
+      if (!static_cast<ClientSession*>(conn->user_data)->Idle()) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+void PrintDuration(const char* label, uint64_t ns) {
+  if (ns >= 10000000) {
+    std::printf(" %s %.2fms", label, double(ns) / 1e6);
+  } else {
+    std::printf(" %s %.1fus", label, double(ns) / 1e3);
+  }
+}
+
+int Run(const Args& args) {
+  const BenchOptions& options = args.options;
+  EncodedBlocks request_blocks;
+  request_blocks.Build(RequestHeaders(options.headers), {});
+  EncodedBlocks response_blocks;
+  response_blocks.Build(ResponseHeaders(options.headers),
+                        ResponseTrailers(options.headers));
+  const std::vector<uint8_t> request_body(options.request_body, 'q');
+  const std::vector<uint8_t> response_body(options.response_body, 'r');
+
+  std::atomic<bool> measuring{false};
+  std::atomic<bool> stop_servers{false};
+  std::atomic<bool> stop_clients{false};
+
+  // servers: one listening transport per loop
+  std::vector<std::unique_ptr<ServerLoop>> servers;
+  std::vector<uint16_t> ports;
+  for (uint32_t i = 0; i < args.server_threads; ++i) {
+    auto t = MakeTransport(args.transport, args.connections);
+    if (!t) {
+      return 1;
+    }
+    servers.emplace_back(new ServerLoop(
+        options, response_blocks,
+        absl::MakeConstSpan(response_body.data(), response_body.size()),
+        std::move(t)));
+    if (servers.back()->Transport().Listen("127.0.0.1", 0, *servers.back()) !=
+        transport::TRANSPORT_ERR::NONE) {
+      std::fprintf(stderr, "listen failed: %s\n",
+                   std::strerror(servers.back()->Transport().LastErrno()));
+      return 1;
+    }
+    ports.push_back(servers.back()->Transport().ListenPort());
+  }
+
+  // clients: connections spread over loops, and over server ports
+  std::vector<std::unique_ptr<ClientLoop>> clients;
+  std::vector<std::vector<uint16_t>> targets(args.client_threads);
+  for (uint32_t c = 0; c < args.connections; ++c) {
+    targets[c % args.client_threads].push_back(ports[c % ports.size()]);
+  }
+  for (uint32_t i = 0; i < args.client_threads; ++i) {
+    auto t = MakeTransport(args.transport, uint32_t(targets[i].size()));
+    if (!t) {
+      return 1;
+    }
+    clients.emplace_back(new ClientLoop(
+        options, request_blocks,
+        absl::MakeConstSpan(request_body.data(), request_body.size()),
+        measuring, std::move(t)));
+  }
+
+  const char* kind =
+      servers[0]->Transport().Kind() == transport::TransportKind::IoUring
+          ? "io_uring"
+          : "epoll";
+  std::printf(
+      "h2v_e2e_bench: transport=%s headers=%.*s connections=%u streams=%u "
+      "server-threads=%u client-threads=%u request-body=%zu "
+      "response-body=%zu\n",
+      kind, int(HeaderSetName(options.headers).size()),
+      HeaderSetName(options.headers).data(), args.connections,
+      options.streams, args.server_threads, args.client_threads,
+      options.request_body, options.response_body);
+  std::fflush(stdout);
+
+  std::vector<std::thread> server_threads;
+  for (auto& s : servers) {
+    server_threads.emplace_back([&s, &stop_servers] { s->Run(stop_servers); });
+  }
+  std::vector<std::thread> client_threads;
+  for (uint32_t i = 0; i < args.client_threads; ++i) {
+    client_threads.emplace_back([&clients, &targets, &stop_clients, i] {
+      clients[i]->Run(targets[i], stop_clients);
+    });
+  }
+
+  auto cpu = [](std::vector<std::thread>& threads) {
+    double sum = 0;
+    for (std::thread& t : threads) {
+      sum += ThreadCpuSeconds(t);
+    }
+    return sum;
+  };
+
+  std::this_thread::sleep_for(std::chrono::duration<double>(args.warmup_s));
+  const double server_cpu0 = cpu(server_threads);
+  const double client_cpu0 = cpu(client_threads);
+  const double process_cpu0 = ProcessCpuSeconds();
+  const auto t0 = std::chrono::steady_clock::now();
+  measuring.store(true, std::memory_order_relaxed);
+
+  std::this_thread::sleep_for(std::chrono::duration<double>(args.duration_s));
+
+  measuring.store(false, std::memory_order_relaxed);
+  const auto t1 = std::chrono::steady_clock::now();
+  const double server_cpu = cpu(server_threads) - server_cpu0;
+  const double client_cpu = cpu(client_threads) - client_cpu0;
+  const double process_cpu = ProcessCpuSeconds() - process_cpu0;
+
+  stop_clients.store(true, std::memory_order_release);
+  for (auto& c : clients) {
+    c->Transport().Wake();
+  }
+  for (std::thread& t : client_threads) {
+    t.join();
+  }
+  stop_servers.store(true, std::memory_order_release);
+  for (auto& s : servers) {
+    s->Transport().Wake();
+  }
+  for (std::thread& t : server_threads) {
+    t.join();
+  }
+
+  ClientStats total;
+  for (auto& c : clients) {
+    const ClientStats& s = c->Stats();
+    total.completed += s.completed;
+    total.errors += s.errors;
+    total.response_bytes += s.response_bytes;
+    total.latency.Merge(s.latency);
+  }
+
+  const double elapsed = std::chrono::duration<double>(t1 - t0).count();
+  const double n = total.completed ? double(total.completed) : 1.0;
+  std::printf("finished in %.2fs, %.2f req/s, %.2f MB/s response body\n",
+              elapsed, double(total.completed) / elapsed,
+              double(total.response_bytes) / elapsed / 1e6);
+  std::printf("requests: %llu completed, %llu errors\n",
+              static_cast<unsigned long long>(total.completed),
+              static_cast<unsigned long long>(total.errors));
+  std::printf("latency:");
+  PrintDuration("p50", total.latency.Percentile(0.50));
+  PrintDuration("p99", total.latency.Percentile(0.99));
+  PrintDuration("p999", total.latency.Percentile(0.999));
+  PrintDuration("max", total.latency.Max());
+  std::printf("\n");
+  std::printf(
+      "cpu/request: server %.2fus, client %.2fus, process %.2fus\n",
+      server_cpu / n * 1e6, client_cpu / n * 1e6, process_cpu / n * 1e6);
+  return total.completed > 0 && total.errors == 0 ? 0 : 2;
+}
+
+}  // namespace
+}  // namespace bench
+}  // namespace h2v
+
+int main(int argc, char** argv) {
+  h2v::bench::Args args;
+  if (!h2v::bench::ParseArgs(argc, argv, args)) {
+    h2v::bench::Usage();
+    return 1;
+  }
+  return h2v::bench::Run(args);
+}
@@ -0,0 +1,130 @@
+// bench/e2e/header_sets.cc
+#include "e2e/header_sets.h"
+
+#include "h2v/hpack/encoder.h"
+#include "h2v/stream/raw_buffer.h"
+
+namespace h2v {
+namespace bench {
+
+namespace {
+
+// captured from a desktop browser fetching a page of a logged-in site
+constexpr hpack::Header kBrowserRequest[] = {
+    {":method", "GET"},
+    {":scheme", "https"},
+    {":authority", "www.example.com"},
+    {":path", "/account/orders?page=2&sort=recent"},
+    {"user-agent",
+     "Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 (KHTML, like Gecko) "
+     "Chrome/124.0.0.0 Safari/537.36"},
+    {"accept",
+     "text/html,application/xhtml+xml,application/xml;q=0.9,image/avif,"
+     "image/webp,*/*;q=0.8"},
+    {"accept-language", "en-US,en;q=0.9"},
+    {"accept-encoding", "gzip, deflate, br, zstd"},
+    {"referer", "https://www.example.com/account"},
+    {"cookie",
+     "session=9f8e7d6c5b4a39281706f5e4d3c2b1a0; theme=dark; "
+     "_ga=GA1.2.1234567890.1700000000; consent=analytics%3Dno"},
+    {"upgrade-insecure-requests", "1"},
+    {"sec-fetch-dest", "document"},
+    {"sec-fetch-mode", "navigate"},
+    {"sec-fetch-site", "same-origin"},
+    {"priority", "u=0, i"},
+};
+
+constexpr hpack::Header kBrowserResponse[] = {
+    {":status", "200"},
+    {"content-type", "text/html; charset=utf-8"},
+    {"cache-control", "private, max-age=0"},
+    {"server", "h2v"},
+    {"vary", "accept-encoding"},
+};
+
+constexpr hpack::Header kGrpcRequest[] = {
+    {":method", "POST"},
+    {":scheme", "http"},
+    {":path", "/helloworld.Greeter/SayHello"},
+    {":authority", "localhost"},
+    {"content-type", "application/grpc"},
+    {"te", "trailers"},
+    {"grpc-accept-encoding", "identity,deflate,gzip"},
+    {"grpc-timeout", "1S"},
+    {"user-agent", "grpc-c++/1.62.0 grpc-c/39.0.0 (linux; chttp2)"},
+};
+
+constexpr hpack::Header kGrpcResponse[] = {
+    {":status", "200"},
+    {"content-type", "application/grpc"},
+    {"grpc-encoding", "identity"},
+    {"grpc-accept-encoding", "identity,deflate,gzip"},
+};
+
+constexpr hpack::Header kGrpcTrailers[] = {
+    {"grpc-status", "0"},
+    {"grpc-message", ""},
+};
+
+}  // namespace
+
+bool ParseHeaderSetKind(absl::string_view name, HeaderSetKind& out) noexcept {
+  if (name == "browser") {
+    out = HeaderSetKind::Browser;
+    return true;
+  }
+  if (name == "grpc") {
+    out = HeaderSetKind::Grpc;
+    return true;
+  }
+  return false;
+}
+
+absl::string_view HeaderSetName(HeaderSetKind kind) noexcept {
+  return kind == HeaderSetKind::Grpc ? "grpc" : "browser";
+}
+
+absl::Span<const hpack::Header> RequestHeaders(HeaderSetKind kind) noexcept {
+  if (kind == HeaderSetKind::Grpc) {
+    return kGrpcRequest;
+  }
+  return kBrowserRequest;
+}
+
+absl::Span<const hpack::Header> ResponseHeaders(HeaderSetKind kind) noexcept {
+  if (kind == HeaderSetKind::Grpc) {
+    return kGrpcResponse;
+  }
+  return kBrowserResponse;
+}
+
+absl::Span<const hpack::Header> ResponseTrailers(HeaderSetKind kind) noexcept {
+  if (kind == HeaderSetKind::Grpc) {
+    return kGrpcTrailers;
+  }
+  return {};
+}
+
+// -----------------------------------------------------------------------------
+// EncodedBlocks
+// -----------------------------------------------------------------------------
+
+void EncodedBlocks::Build(absl::Span<const hpack::Header> header_fields,
+                          absl::Span<const hpack::Header> trailer_fields) {
+  // one encoder, as on a real connection: the first exchange fills the
+  // peer's table, later ones are mostly indexed
+  hpack::Encoder encoder;
+  auto encode = [&](absl::Span<const hpack::Header> fields,
+                    std::vector<uint8_t>& out) {
+    stream::RawBuffer<> block;
+    encoder.Encode(fields, block);
+    out.assign(block.raw(), block.raw() + block.size());
+  };
+  encode(header_fields, first_headers);
+  encode(trailer_fields, first_trailers);
+  encode(header_fields, headers);
+  encode(trailer_fields, trailers);
+}
+
+}  // namespace bench
+}  // namespace h2v
@@ -0,0 +1,44 @@
+// bench/e2e/header_sets.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+#include "h2v/hpack/header.h"
+
+namespace h2v {
+namespace bench {
+
+/// @brief Request profile the load generator replays.
+enum class HeaderSetKind : uint8_t {
+  /// Browser page load: GET, ~15 fields incl. a long user-agent and cookie.
+  Browser = 0,
+  /// Unary gRPC call: POST with a length-prefixed body and trailers.
+  Grpc = 1
+};
+
+bool ParseHeaderSetKind(absl::string_view name, HeaderSetKind& out) noexcept;
+absl::string_view HeaderSetName(HeaderSetKind kind) noexcept;
+
+absl::Span<const hpack::Header> RequestHeaders(HeaderSetKind kind) noexcept;
+absl::Span<const hpack::Header> ResponseHeaders(HeaderSetKind kind) noexcept;
+/// @brief Trailer fields sent after the body (empty for Browser).
+absl::Span<const hpack::Header> ResponseTrailers(HeaderSetKind kind) noexcept;
+
+/// @brief Header blocks of one connection direction, pre-encoded: the
+///   first exchange populates the peer's table, every later one is indexed.
+struct EncodedBlocks {
+  std::vector<uint8_t> first_headers;
+  std::vector<uint8_t> first_trailers;
+  std::vector<uint8_t> headers;
+  std::vector<uint8_t> trailers;
+
+  void Build(absl::Span<const hpack::Header> header_fields,
+             absl::Span<const hpack::Header> trailer_fields);
+};
+
+}  // namespace bench
+}  // namespace h2v
@@ -0,0 +1,84 @@
+// bench/e2e/latency_histogram.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace h2v {
+namespace bench {
+
+/// @brief Log-linear latency histogram (16 sub-buckets per power of two,
+///   ~6% resolution), fixed size so recording never allocates.
+class LatencyHistogram {
+ public:
+  static constexpr int kSubBits = 4;
+  static constexpr int kSub = 1 << kSubBits;
+  static constexpr int kBuckets = (64 - kSubBits + 1) * kSub;
+
+  void Record(uint64_t ns) noexcept {
+    counts_[Bucket(ns)]++;
+    total_++;
+    if (ns > max_) {
+      max_ = ns;
+    }
+  }
+
+  void Merge(const LatencyHistogram& other) noexcept {
+    for (int i = 0; i < kBuckets; ++i) {
+      counts_[i] += other.counts_[i];
+    }
+    total_ += other.total_;
+    if (other.max_ > max_) {
+      max_ = other.max_;
+    }
+  }
+
+  /// @brief Value at quantile `q` (0..1), midpoint of its bucket.
+  uint64_t Percentile(double q) const noexcept {
+    if (total_ == 0) {
+      return 0;
+    }
+    uint64_t rank = static_cast<uint64_t>(q * double(total_ - 1)) + 1;
+    for (int i = 0; i < kBuckets; ++i) {
+      if (counts_[i] >= rank) {
+        return i + 1 < kBuckets ? (Lower(i) + Lower(i + 1) - 1) / 2 : max_;
+      }
+      rank -= counts_[i];
+    }
+    return max_;
+  }
+
+  uint64_t Count() const noexcept {
+    return total_;
+  }
+  uint64_t Max() const noexcept {
+    return max_;
+  }
+
+ private:
+  uint64_t counts_[kBuckets] = {};
+  uint64_t total_ = 0;
+  uint64_t max_ = 0;
+
+  static int Bucket(uint64_t v) noexcept {
+    if (v < kSub) {
+      return static_cast<int>(v);
+    }
+    const int exp = 63 - __builtin_clzll(v);  // >= kSubBits
+    const int sub = static_cast<int>((v >> (exp - kSubBits)) & (kSub - 1));
+    return (exp - kSubBits + 1) * kSub + sub;
+  }
+
+  /// @brief Smallest value mapping to bucket `i`.
+  static uint64_t Lower(int i) noexcept {
+    if (i < kSub) {
+      return static_cast<uint64_t>(i);
+    }
+    const int exp = i / kSub + kSubBits - 1;
+    const uint64_t sub = static_cast<uint64_t>(i % kSub);
+    return (uint64_t(kSub) + sub) << (exp - kSubBits);
+  }
+};
+
+}  // namespace bench
+}  // namespace h2v
@@ -0,0 +1,46 @@
+// inc/h2v/frame/error_code.h
+#pragma once
+
+#include <cstdint>
+
+namespace h2v {
+namespace frame {
+
+using FrameErrorCode = int32_t;
+
+/// @brief Library-level status codes returned by the frame layer.
+namespace FRAME_ERR {
+
+static constexpr FrameErrorCode NONE = 0;
+static constexpr FrameErrorCode INVALID_ARGS = 1;
+static constexpr FrameErrorCode FRAME_TOO_LARGE = 2;
+static constexpr FrameErrorCode OUT_OF_MEMORY = 3;
+static constexpr FrameErrorCode WOULD_BLOCK = 4;
+static constexpr FrameErrorCode TRANSPORT_ERROR = 5;
+static constexpr FrameErrorCode INVALID_STREAM_ID = 6;
+static constexpr FrameErrorCode CONNECTION_ERROR = 7;
+static constexpr FrameErrorCode FLOW_CONTROL_ERROR = 8;
+
+}  // namespace FRAME_ERR
+
+/// @brief HTTP/2 error codes carried by RST_STREAM and GOAWAY.
+/// @see RFC 9113 §7 “Error Codes”
+enum class Http2ErrorCode : uint32_t {
+  NoError = 0x0,
+  ProtocolError = 0x1,
+  InternalError = 0x2,
+  FlowControlError = 0x3,
+  SettingsTimeout = 0x4,
+  StreamClosed = 0x5,
+  FrameSizeError = 0x6,
+  RefusedStream = 0x7,
+  Cancel = 0x8,
+  CompressionError = 0x9,
+  ConnectError = 0xa,
+  EnhanceYourCalm = 0xb,
+  InadequateSecurity = 0xc,
+  Http11Required = 0xd
+};
+
+}  // namespace frame
+}  // namespace h2v
@@ -0,0 +1,127 @@
+// inc/h2v/frame/flood_guard.h
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "h2v/frame/error_code.h"
+
+namespace h2v {
+namespace frame {
+
+/// @brief Peer behaviours that cost us work without carrying requests.
+enum class FloodEvent : uint8_t {
+  /// RST_STREAM received (rapid reset, CVE-2023-44487).
+  RstStream = 0,
+  /// PING without ACK (we must answer each).
+  Ping = 1,
+  /// SETTINGS without ACK (we must apply and ACK each).
+  Settings = 2,
+  /// DATA with an empty payload and no END_STREAM.
+  EmptyData = 3,
+  /// CONTINUATION without END_HEADERS (CONTINUATION flood).
+  Continuation = 4,
+  /// HPACK decode failure (see hpack/error_code.h).
+  HpackError = 5
+};
+constexpr std::size_t kFloodEventCount = 6;
+
+/// @brief Token bucket parameters for one FloodEvent.
+struct FloodBudget {
+  /// Events allowed back to back.
+  uint32_t burst;
+  /// Sustained events per second (0 = `burst` per connection lifetime).
+  uint32_t per_second;
+};
+
+struct FloodGuardConfig {
+  /// Indexed by FloodEvent.
+  FloodBudget budgets[kFloodEventCount] = {
+      {200, 100},  // RstStream
+      {50, 10},    // Ping
+      {50, 10},    // Settings
+      {100, 50},   // EmptyData
+      {64, 32},    // Continuation
+      {10, 1},     // HpackError
+  };
+  /// Error code of the GOAWAY sent once a budget is exhausted.
+  Http2ErrorCode goaway_code = Http2ErrorCode::EnhanceYourCalm;
+};
+
+/// @brief Per-connection token buckets against control-frame floods.
+/// @details Each bucket is two integers refilled lazily on Charge(): no
+///   allocation, no timers, and the clock is read only when a counted event
+///   arrives, so regular HEADERS/DATA traffic never touches it. Tokens are
+///   kept in millionths so the refill is one multiply.
+///
+///   Not thread-safe: owned by the connection's I/O thread.
+class FloodGuard {
+ public:
+  explicit FloodGuard(const FloodGuardConfig& config = {}) noexcept
+                  : config_(config) {
+    for (std::size_t i = 0; i < kFloodEventCount; ++i) {
+      tokens_[i] = uint64_t(config_.budgets[i].burst) * kScale;
+    }
+  }
+
+  /// @brief Count one event at `now_us` (monotonic microseconds).
+  /// @return false once the budget is exceeded; the guard stays tripped and
+  ///   the connection should be closed with GoawayCode().
+  bool Charge(FloodEvent event, uint64_t now_us) noexcept {
+    if (tripped_) {
+      return false;
+    }
+    const std::size_t i = static_cast<std::size_t>(event);
+    const FloodBudget& b = config_.budgets[i];
+    const uint64_t cap = uint64_t(b.burst) * kScale;
+    if (now_us > last_us_[i]) {
+      const uint64_t refill = (now_us - last_us_[i]) * b.per_second;
+      tokens_[i] = refill >= cap - tokens_[i] ? cap : tokens_[i] + refill;
+      last_us_[i] = now_us;
+    }
+    if (tokens_[i] < kScale) {
+      tripped_ = true;
+      tripped_by_ = event;
+      return false;
+    }
+    tokens_[i] -= kScale;
+    return true;
+  }
+
+  /// @brief Charge() against the monotonic clock; wall-clock steps must
+  ///   neither refill nor freeze the buckets.
+  bool Charge(FloodEvent event) noexcept {
+    const auto now = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch());
+    return Charge(event, uint64_t(now.count()));
+  }
+
+  /// @brief Count an HPACK decode result; success is free.
+  bool ChargeHpackError(int32_t hpack_error_code) noexcept {
+    return hpack_error_code == 0 || Charge(FloodEvent::HpackError);
+  }
+
+  bool Tripped() const noexcept {
+    return tripped_;
+  }
+  /// @brief Event that exhausted its budget (valid once Tripped()).
+  FloodEvent TrippedBy() const noexcept {
+    return tripped_by_;
+  }
+  Http2ErrorCode GoawayCode() const noexcept {
+    return config_.goaway_code;
+  }
+
+ private:
+  static constexpr uint64_t kScale = 1000000;  // tokens per event
+
+  FloodGuardConfig config_;
+  uint64_t tokens_[kFloodEventCount] = {};
+  uint64_t last_us_[kFloodEventCount] = {};
+  bool tripped_ = false;
+  FloodEvent tripped_by_ = FloodEvent::RstStream;
+};
+
+}  // namespace frame
+}  // namespace h2v
@@ -0,0 +1,128 @@
+// inc/h2v/frame/flow_control.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "absl/types/span.h"
+#include "h2v/frame/error_code.h"
+#include "h2v/frame/frame_type.h"
+#include "h2v/frame/frame_writer.h"
+#include "h2v/frame/stream_table.h"
+
+namespace h2v {
+namespace frame {
+
+/// @brief Receive-side flow-control settings.
+struct FlowControlConfig {
+  /// Our SETTINGS_INITIAL_WINDOW_SIZE (starting stream window).
+  int64_t initial_stream_window = kDefaultInitialWindowSize;
+  /// Connection window to grow to right after the preface.
+  int64_t initial_connection_window = kDefaultInitialWindowSize;
+  /// Return credit only once this fraction of the window was consumed.
+  double update_threshold = 0.5;
+  /// Grow windows from bandwidth-delay-product samples.
+  bool auto_tune = true;
+  /// Auto-tuning ceilings.
+  int64_t max_stream_window = 16 * 1024 * 1024;
+  int64_t max_connection_window = 64 * 1024 * 1024;
+  /// Minimum spacing between BDP probe PINGs; doubled (up to 1 s) every
+  /// time a sample does not grow the window.
+  uint64_t min_probe_interval_us = 0;
+};
+
+/// @brief Opaque payload of the PINGs sent as BDP probes.
+constexpr uint8_t kBdpPingPayload[8] = {'h', '2', 'v', 'b', 'd', 'p', 0, 0};
+
+/// @brief Connection- and stream-level receive flow control.
+/// @details
+///   - Inbound DATA is charged against the connection and stream receive
+///     windows; overruns are FLOW_CONTROL_ERROR.
+///   - Credit is returned only for bytes the application consumed, and only
+///     once `update_threshold` of the window accumulated, so a stream of
+///     small DATA frames produces a handful of WINDOW_UPDATEs instead of one
+///     per frame.
+///   - With `auto_tune`, a PING probe is kept in flight while data arrives;
+///     the bytes received during one probe round trip approximate the
+///     bandwidth-delay product. When a sample fills 2/3 of the current
+///     window the windows grow to twice the sample (capped), the extra
+///     credit riding on the next WINDOW_UPDATE.
+///
+///   Time is passed in by the caller (monotonic microseconds) so the
+///   controller stays free of clock calls. Not thread-safe: owned by the
+///   connection's I/O thread.
+class FlowController {
+ public:
+  explicit FlowController(const FlowControlConfig& config = {}) noexcept;
+
+  /// @brief Queue the connection WINDOW_UPDATE raising the connection window
+  ///   from the RFC default to `initial_connection_window`. Call once after
+  ///   the SETTINGS frame.
+  FrameErrorCode Start(FrameWriter& writer) noexcept;
+
+  /// @brief Charge an inbound DATA frame, straight from
+  ///   FrameVisitor::OnData().
+  /// @param stream  nullptr if the stream is already gone (the bytes still
+  ///   count against the connection window).
+  /// @param frame_length  OnData()'s `frame_length`: the full payload,
+  ///   padding included, not the size of its `data`.
+  /// @return NONE, FLOW_CONTROL_ERROR if the peer overran a window (treat
+  ///   as a connection error), or the writer's error for the probe PING.
+  FrameErrorCode OnDataReceived(Stream* stream, uint32_t frame_length,
+                                uint64_t now_us, FrameWriter& writer) noexcept;
+
+  /// @brief The application consumed `bytes` of `stream`'s data (padding
+  ///   should be reported as consumed right away). Queues WINDOW_UPDATEs
+  ///   once the threshold is crossed.
+  FrameErrorCode OnConsumed(Stream* stream, uint32_t bytes,
+                            FrameWriter& writer) noexcept;
+
+  /// @brief Feed a PING ACK.
+  /// @return true if it answered our BDP probe (and was consumed here).
+  bool OnPingAck(absl::Span<const uint8_t> opaque, uint64_t now_us) noexcept;
+
+  int64_t ConnectionWindow() const noexcept {
+    return conn_window_;
+  }
+  int64_t ConnectionWindowSize() const noexcept {
+    return conn_window_size_;
+  }
+  /// @brief Window new and updated streams are grown to.
+  int64_t StreamWindowTarget() const noexcept {
+    return stream_target_;
+  }
+  /// @brief Last probe round trip, 0 before the first sample.
+  uint64_t RttUs() const noexcept {
+    return rtt_us_;
+  }
+  uint64_t WindowUpdatesSent() const noexcept {
+    return updates_sent_;
+  }
+
+ private:
+  static constexpr uint64_t kMaxProbeIntervalUs = 1000000;
+
+  FlowControlConfig config_;
+
+  int64_t conn_window_ = kDefaultInitialWindowSize;
+  int64_t conn_window_size_ = kDefaultInitialWindowSize;
+  int64_t conn_target_;
+  int64_t conn_unacked_ = 0;
+  int64_t stream_target_;
+
+  // BDP probe
+  bool probe_in_flight_ = false;
+  uint64_t probe_sent_us_ = 0;
+  uint64_t probe_bytes_ = 0;
+  uint64_t probe_interval_us_;
+  uint64_t rtt_us_ = 0;
+
+  uint64_t updates_sent_ = 0;
+
+  bool Due(int64_t unacked, int64_t window_size) const noexcept;
+  FrameErrorCode SendUpdate(uint32_t stream_id, int64_t increment,
+                            FrameWriter& writer) noexcept;
+};
+
+}  // namespace frame
+}  // namespace h2v
@@ -0,0 +1,184 @@
+// inc/h2v/frame/frame_parser.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+#include "h2v/frame/error_code.h"
+#include "h2v/frame/flood_guard.h"
+#include "h2v/frame/frame_type.h"
+#include "h2v/frame/stream_state.h"
+#include "h2v/frame/stream_table.h"
+#include "h2v/stream/raw_buffer.h"
+
+namespace h2v {
+namespace frame {
+
+/// @brief Client connection preface (RFC 9113 §3.4).
+constexpr absl::string_view kConnectionPreface =
+    "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n";
+
+/// @brief Default cap on the wire size of one header block.
+constexpr std::size_t kDefaultMaxHeaderBlockSize = 64 * 1024;
+
+/// @brief SETTINGS parameter identifiers (RFC 9113 §6.5.2).
+namespace SETTINGS_ID {
+
+static constexpr uint16_t HEADER_TABLE_SIZE = 0x1;
+static constexpr uint16_t ENABLE_PUSH = 0x2;
+static constexpr uint16_t MAX_CONCURRENT_STREAMS = 0x3;
+static constexpr uint16_t INITIAL_WINDOW_SIZE = 0x4;
+static constexpr uint16_t MAX_FRAME_SIZE = 0x5;
+static constexpr uint16_t MAX_HEADER_LIST_SIZE = 0x6;
+static constexpr uint16_t NO_RFC7540_PRIORITIES = 0x9;
+
+}  // namespace SETTINGS_ID
+
+/// @brief Receives validated frames from FrameParser.
+/// @details Every callback has an empty default so a visitor only overrides
+///   what it consumes. Payload spans are only valid during the call.
+///   `stream` may be nullptr when the frame is delivered for bookkeeping only
+///   (e.g. a header block on a stream that was just reset still has to reach
+///   the HPACK decoder to keep the dynamic table in sync).
+class FrameVisitor {
+ public:
+  virtual ~FrameVisitor() = default;
+
+  /// @brief A DATA frame; `data` has the padding stripped, `frame_length`
+  ///   is the whole payload (pad length octet and padding included), which
+  ///   is what flow control charges (RFC 9113 §6.9). DATA on a stream that
+  ///   was reset or closed arrives with `stream` nullptr, only to be
+  ///   charged against the connection window.
+  virtual void OnData(uint32_t stream_id, Stream* stream,
+                      absl::Span<const uint8_t> data, uint32_t frame_length,
+                      bool end_stream) {}
+  virtual void OnHeaders(uint32_t stream_id, Stream* stream,
+                         absl::Span<const uint8_t> fragment, bool end_headers,
+                         bool end_stream) {}
+  virtual void OnContinuation(uint32_t stream_id, Stream* stream,
+                              absl::Span<const uint8_t> fragment,
+                              bool end_headers) {}
+  virtual void OnPushPromise(uint32_t stream_id, Stream* promised,
+                             absl::Span<const uint8_t> fragment,
+                             bool end_headers) {}
+  virtual void OnRstStream(uint32_t stream_id, Http2ErrorCode code) {}
+  virtual void OnSetting(uint16_t id, uint32_t value) {}
+  virtual void OnSettingsEnd(bool ack) {}
+  virtual void OnPing(bool ack, absl::Span<const uint8_t> opaque) {}
+  virtual void OnGoaway(uint32_t last_stream_id, Http2ErrorCode code,
+                        absl::Span<const uint8_t> debug_data) {}
+  virtual void OnWindowUpdate(uint32_t stream_id, uint32_t increment) {}
+  virtual void OnPriorityUpdate(uint32_t prioritized_stream_id,
+                                absl::string_view field_value) {}
+
+  /// @brief A stream reached `closed`; called right before it is recycled.
+  virtual void OnStreamClosed(Stream* stream) {}
+  /// @brief The peer caused a stream error; the owner should RST_STREAM.
+  virtual void OnStreamError(uint32_t stream_id, Http2ErrorCode code) {}
+  /// @brief The peer caused a connection error; the owner should GOAWAY.
+  virtual void OnConnectionError(Http2ErrorCode code,
+                                 absl::string_view reason) {}
+};
+
+/// @brief Incremental HTTP/2 frame parser.
+/// @details Splits the inbound byte stream into frames, validates them
+///   against RFC 9113 §4-§6 and drives each stream through the table-driven
+///   state machine (stream_state.h), opening and closing streams in the
+///   StreamTable as it goes. Complete frames are delivered straight from the
+///   caller's buffer; only a frame split across reads is copied.
+///
+///   Not thread-safe: owned by the connection's I/O thread.
+class FrameParser {
+ public:
+  /// @param expect_preface  server side: consume the client preface first.
+  FrameParser(StreamTable& streams, FrameVisitor& visitor,
+              bool expect_preface) noexcept;
+
+  /// @brief Our advertised SETTINGS_MAX_FRAME_SIZE (what we accept).
+  FrameErrorCode SetMaxFrameSize(uint32_t max_frame_size) noexcept;
+
+  /// @brief Cap on the wire size of one header block (HEADERS or
+  ///   PUSH_PROMISE plus its CONTINUATIONs); 0 disables the cap.
+  /// @details Checked against each frame header before its payload is
+  ///   buffered, so a CONTINUATION flood is cut off without being read into
+  ///   memory. The HPACK decoder enforces the decoded header list size
+  ///   independently; this bounds the bytes it has to chew through.
+  void SetMaxHeaderBlockSize(std::size_t bytes) noexcept {
+    max_header_block_size_ = bytes;
+  }
+
+  /// @brief Count control-frame floods against `guard` (nullptr disables).
+  /// @details Once a budget is exhausted the parser reports a connection
+  ///   error with FloodGuard::GoawayCode().
+  void SetFloodGuard(FloodGuard* guard) noexcept {
+    guard_ = guard;
+  }
+
+  /// @brief Feed bytes read from the transport.
+  /// @param consumed  bytes taken from `in` (all of it unless an error).
+  /// @return NONE, OUT_OF_MEMORY, or CONNECTION_ERROR once a connection error
+  ///   was reported (the parser stays failed afterwards).
+  FrameErrorCode Parse(absl::Span<const uint8_t> in,
+                       std::size_t& consumed) noexcept;
+
+  /// @brief True while a header block awaits CONTINUATION frames.
+  bool InHeaderBlock() const noexcept {
+    return block_stream_id_ != 0;
+  }
+  bool Failed() const noexcept {
+    return failed_;
+  }
+  uint64_t FramesParsed() const noexcept {
+    return frames_parsed_;
+  }
+
+ private:
+  StreamTable& streams_;
+  FrameVisitor& visitor_;
+  FloodGuard* guard_ = nullptr;
+  stream::RawBuffer<> pending_;
+  uint32_t max_frame_size_ = kDefaultMaxFrameSize;
+  std::size_t max_header_block_size_ = kDefaultMaxHeaderBlockSize;
+  std::size_t preface_pos_;
+  bool failed_ = false;
+  uint64_t frames_parsed_ = 0;
+
+  // open header block (HEADERS/PUSH_PROMISE without END_HEADERS)
+  uint32_t block_stream_id_ = 0;
+  std::size_t block_bytes_ = 0;
+  bool block_end_stream_ = false;
+  bool block_accepted_ = false;
+
+  /// @brief Size checks on a frame header, before its payload is read.
+  bool Admissible(const FrameHeader& h);
+  bool Dispatch(const FrameHeader& h, absl::Span<const uint8_t> p) noexcept;
+  /// @brief Charge `h` to the flood guard if it is a counted frame.
+  bool ChargeFlood(const FrameHeader& h, absl::Span<const uint8_t> p);
+  bool OnDataFrame(const FrameHeader& h, absl::Span<const uint8_t> p);
+  bool OnHeadersFrame(const FrameHeader& h, absl::Span<const uint8_t> p);
+  bool OnContinuationFrame(const FrameHeader& h, absl::Span<const uint8_t> p);
+  bool OnPushPromiseFrame(const FrameHeader& h, absl::Span<const uint8_t> p);
+  bool OnRstStreamFrame(const FrameHeader& h, absl::Span<const uint8_t> p);
+  bool OnSettingsFrame(const FrameHeader& h, absl::Span<const uint8_t> p);
+  bool OnWindowUpdateFrame(const FrameHeader& h, absl::Span<const uint8_t> p);
+
+  /// @brief Strip the Pad Length octet and trailing padding.
+  bool StripPadding(const FrameHeader& h, absl::Span<const uint8_t>& p);
+
+  /// @brief Current state of `id`, idle/closed for ids not in the table.
+  StreamState StateOf(uint32_t id, Stream*& stream) noexcept;
+
+  /// @brief Apply a received event; handles stream errors and closing.
+  /// @return the transition, or a Connection-scope cell (already reported).
+  StreamTransition Receive(uint32_t id, Stream*& stream, StreamEvent event);
+
+  void FinishHeaderBlock();
+  void StreamError(uint32_t id, Stream* stream, Http2ErrorCode code) noexcept;
+  void CloseStream(Stream* stream) noexcept;
+  bool ConnectionError(Http2ErrorCode code, absl::string_view reason);
+};
+
+}  // namespace frame
+}  // namespace h2v
@@ -0,0 +1,109 @@
+// inc/h2v/frame/frame_type.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace h2v {
+namespace frame {
+
+/// @brief Size of the fixed HTTP/2 frame header on the wire.
+/// @see RFC 9113 §4.1 “Frame Format”
+constexpr std::size_t kFrameHeaderSize = 9;
+
+/// @brief Default (and minimum) SETTINGS_MAX_FRAME_SIZE.
+constexpr uint32_t kDefaultMaxFrameSize = 16384;
+
+/// @brief Largest payload SETTINGS_MAX_FRAME_SIZE may ever advertise.
+constexpr uint32_t kMaxAllowedFrameSize = (1u << 24) - 1;
+
+/// @brief Initial flow-control window for the connection and new streams.
+/// @see RFC 9113 §6.9.2
+constexpr int32_t kDefaultInitialWindowSize = 65535;
+
+/// @brief Largest flow-control window allowed (2^31 - 1).
+constexpr int64_t kMaxWindowSize = 0x7FFFFFFF;
+
+/// @brief Stream identifiers are 31-bit; the high bit is reserved.
+constexpr uint32_t kStreamIdMask = 0x7FFFFFFFu;
+
+/// @brief HTTP/2 frame type octet.
+/// @see RFC 9113 §6, RFC 9218 §7.1 (PRIORITY_UPDATE)
+enum class FrameType : uint8_t {
+  Data = 0x0,
+  Headers = 0x1,
+  Priority = 0x2,
+  RstStream = 0x3,
+  Settings = 0x4,
+  PushPromise = 0x5,
+  Ping = 0x6,
+  Goaway = 0x7,
+  WindowUpdate = 0x8,
+  Continuation = 0x9,
+  PriorityUpdate = 0x10
+};
+
+/// @brief Frame flag bits. Meaning depends on the frame type.
+namespace FRAME_FLAG {
+
+static constexpr uint8_t NONE = 0x0;
+static constexpr uint8_t END_STREAM = 0x1;   ///< DATA, HEADERS
+static constexpr uint8_t ACK = 0x1;          ///< SETTINGS, PING
+static constexpr uint8_t END_HEADERS = 0x4;  ///< HEADERS, PUSH_PROMISE, CONT.
+static constexpr uint8_t PADDED = 0x8;       ///< DATA, HEADERS, PUSH_PROMISE
+static constexpr uint8_t PRIORITY = 0x20;    ///< HEADERS
+
+}  // namespace FRAME_FLAG
+
+/// @brief Decoded 9-octet frame header.
+struct FrameHeader {
+  /// Payload length (24-bit).
+  uint32_t length = 0;
+  FrameType type = FrameType::Data;
+  uint8_t flags = FRAME_FLAG::NONE;
+  /// Stream identifier (31-bit, reserved bit stripped).
+  uint32_t stream_id = 0;
+};
+
+/// @brief Serialize `h` into exactly kFrameHeaderSize octets at `out`.
+inline void EncodeFrameHeader(const FrameHeader& h, uint8_t* out) noexcept {
+  out[0] = uint8_t(h.length >> 16);
+  out[1] = uint8_t(h.length >> 8);
+  out[2] = uint8_t(h.length);
+  out[3] = static_cast<uint8_t>(h.type);
+  out[4] = h.flags;
+  const uint32_t sid = h.stream_id & kStreamIdMask;
+  out[5] = uint8_t(sid >> 24);
+  out[6] = uint8_t(sid >> 16);
+  out[7] = uint8_t(sid >> 8);
+  out[8] = uint8_t(sid);
+}
+
+/// @brief Parse kFrameHeaderSize octets at `in` into a FrameHeader.
+inline FrameHeader DecodeFrameHeader(const uint8_t* in) noexcept {
+  FrameHeader h;
+  h.length = (uint32_t(in[0]) << 16) | (uint32_t(in[1]) << 8) | in[2];
+  h.type = static_cast<FrameType>(in[3]);
+  h.flags = in[4];
+  h.stream_id = ((uint32_t(in[5]) << 24) | (uint32_t(in[6]) << 16) |
+                 (uint32_t(in[7]) << 8) | in[8]) &
+                kStreamIdMask;
+  return h;
+}
+
+/// @brief Write `v` as 4 big-endian octets.
+inline void PutUint32BE(uint8_t* out, uint32_t v) noexcept {
+  out[0] = uint8_t(v >> 24);
+  out[1] = uint8_t(v >> 16);
+  out[2] = uint8_t(v >> 8);
+  out[3] = uint8_t(v);
+}
+
+/// @brief Read 4 big-endian octets.
+inline uint32_t GetUint32BE(const uint8_t* in) noexcept {
+  return (uint32_t(in[0]) << 24) | (uint32_t(in[1]) << 16) |
+         (uint32_t(in[2]) << 8) | in[3];
+}
+
+}  // namespace frame
+}  // namespace h2v
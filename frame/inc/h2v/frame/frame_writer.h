@@ -0,0 +1,191 @@
+// inc/h2v/frame/frame_writer.h
+#pragma once
+
+#include <sys/uio.h>
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "absl/types/span.h"
+#include "h2v/frame/error_code.h"
+#include "h2v/frame/frame_type.h"
+#include "h2v/stream/raw_buffer.h"
+
+namespace h2v {
+namespace frame {
+
+#if defined(IOV_MAX)
+constexpr int kIovMax = IOV_MAX;
+#else
+constexpr int kIovMax = 1024;
+#endif
+
+/// @brief Writev half of a "Bring Your Own Transport" connection.
+/// @details The frame layer never touches sockets; it hands gathered
+///   segments to a sink that may call writev(2), sendmsg(2), queue an
+///   io_uring SQE, or copy into a TLS record. `iovcnt` never exceeds kIovMax.
+class FrameSink {
+ public:
+  virtual ~FrameSink() = default;
+
+  /// @brief Submit up to `iovcnt` segments, in order.
+  /// @return bytes accepted (a short count is allowed), 0 when the transport
+  ///   would block, or a negative value on a fatal transport error.
+  virtual int64_t Writev(const struct iovec* iov, int iovcnt) noexcept = 0;
+};
+
+/// @brief Pool of fixed-size slots holding serialized frame headers.
+/// @details Each slot fits one 9-octet header plus a small inline payload, so
+///   control frames (PING, WINDOW_UPDATE, RST_STREAM, short SETTINGS/GOAWAY)
+///   need no separate buffer. Slots are carved from blocks that are never
+///   moved, so iovecs pointing into them stay valid until released.
+class HeaderArena {
+ public:
+  static constexpr std::size_t kSlotSize = 64;
+  static constexpr std::size_t kInlinePayload = kSlotSize - kFrameHeaderSize;
+
+  explicit HeaderArena(std::size_t slots_per_block = 256) noexcept;
+  HeaderArena(const HeaderArena&) = delete;
+  HeaderArena& operator=(const HeaderArena&) = delete;
+
+  /// @brief Take one slot; grows by a block when the free list is empty.
+  /// @return slot pointer, or nullptr on allocation failure.
+  uint8_t* Acquire() noexcept;
+
+  /// @brief Return a slot previously obtained from Acquire().
+  void Release(uint8_t* slot) noexcept;
+
+  std::size_t InUse() const noexcept {
+    return in_use_;
+  }
+  std::size_t Capacity() const noexcept {
+    return blocks_.size() * slots_per_block_;
+  }
+
+ private:
+  union Slot {
+    Slot* next;
+    alignas(8) uint8_t bytes[kSlotSize];
+  };
+
+  std::vector<std::unique_ptr<Slot[]>> blocks_;
+  Slot* free_ = nullptr;
+  std::size_t slots_per_block_;
+  std::size_t in_use_ = 0;
+};
+
+/// @brief Scatter-gather frame serializer.
+/// @details Frames are queued as iovec lists: the header comes from the
+///   HeaderArena, payloads reference caller memory in place (a RawBuffer, or
+///   a chain of spans). Nothing is copied except headers and inline control
+///   payloads. Flush() drains up to kIovMax segments per sink call and keeps
+///   the remainder on a short write.
+///
+///   Zero-copy payloads must stay alive until FlushedOffset() reaches the
+///   offset returned by QueuedOffset() right after they were queued.
+///
+///   Not thread-safe: owned by the connection's I/O thread.
+class FrameWriter {
+ public:
+  explicit FrameWriter(uint32_t max_frame_size = kDefaultMaxFrameSize) noexcept;
+  ~FrameWriter();
+  FrameWriter(const FrameWriter&) = delete;
+  FrameWriter& operator=(const FrameWriter&) = delete;
+
+  /// @brief Peer's SETTINGS_MAX_FRAME_SIZE; larger payloads are split.
+  FrameErrorCode SetMaxFrameSize(uint32_t max_frame_size) noexcept;
+  uint32_t MaxFrameSize() const noexcept {
+    return max_frame_size_;
+  }
+
+  /// @brief Queue DATA frame(s) referencing `payload` in place.
+  FrameErrorCode WriteData(uint32_t stream_id,
+                           absl::Span<const uint8_t> payload,
+                           bool end_stream) noexcept;
+
+  /// @brief Queue DATA frame(s) over a chain of buffers, in place.
+  /// @details Frame boundaries are independent of chain boundaries; a frame
+  ///   may span several links and a link may span several frames.
+  FrameErrorCode WriteDataChain(
+      uint32_t stream_id, absl::Span<const absl::Span<const uint8_t>> chain,
+      bool end_stream) noexcept;
+
+  template <typename Allocator>
+  FrameErrorCode WriteData(uint32_t stream_id,
+                           const stream::RawBuffer<Allocator>& payload,
+                           bool end_stream) noexcept {
+    return WriteData(stream_id, payload.data(), end_stream);
+  }
+
+  /// @brief Queue an encoded header block as HEADERS + CONTINUATION frames.
+  FrameErrorCode WriteHeaders(uint32_t stream_id,
+                              absl::Span<const uint8_t> block,
+                              bool end_stream) noexcept;
+
+  /// @brief Queue an arbitrary frame; the payload is referenced in place and
+  ///   `header.length` is taken from it.
+  FrameErrorCode WriteFrame(const FrameHeader& header,
+                            absl::Span<const uint8_t> payload) noexcept;
+
+  /// @brief Queue a small frame whose payload is copied into the header slot.
+  /// @return FRAME_ERR::FRAME_TOO_LARGE if payload exceeds kInlinePayload.
+  FrameErrorCode WriteControl(FrameType type, uint8_t flags,
+                              uint32_t stream_id,
+                              absl::Span<const uint8_t> payload) noexcept;
+
+  /// @brief Drain queued segments into `sink`.
+  /// @return NONE when fully drained, WOULD_BLOCK on a short write (remaining
+  ///   bytes stay queued), TRANSPORT_ERROR when the sink failed.
+  FrameErrorCode Flush(FrameSink& sink) noexcept;
+
+  /// @brief Drop everything queued and return header slots to the arena.
+  void Clear() noexcept;
+
+  bool Empty() const noexcept {
+    return head_ == segments_.size();
+  }
+  std::size_t PendingSegments() const noexcept {
+    return segments_.size() - head_;
+  }
+  std::size_t PendingBytes() const noexcept {
+    return static_cast<std::size_t>(queued_offset_ - flushed_offset_);
+  }
+  /// @brief Total bytes ever queued on this writer.
+  uint64_t QueuedOffset() const noexcept {
+    return queued_offset_;
+  }
+  /// @brief Total bytes ever accepted by a sink.
+  uint64_t FlushedOffset() const noexcept {
+    return flushed_offset_;
+  }
+  /// @brief Number of sink calls issued (writev/sendmsg syscalls).
+  uint64_t SinkCalls() const noexcept {
+    return sink_calls_;
+  }
+  const HeaderArena& Arena() const noexcept {
+    return arena_;
+  }
+
+ private:
+  HeaderArena arena_;
+  // segments_[i] is handed to the sink as-is; owners_[i] is the arena slot
+  // backing it (nullptr for caller-owned payloads).
+  std::vector<struct iovec> segments_;
+  std::vector<uint8_t*> owners_;
+  std::size_t head_ = 0;
+  uint32_t max_frame_size_;
+  uint64_t queued_offset_ = 0;
+  uint64_t flushed_offset_ = 0;
+  uint64_t sink_calls_ = 0;
+
+  uint8_t* PushHeader(const FrameHeader& header) noexcept;
+  void PushPayload(const uint8_t* data, std::size_t len) noexcept;
+  void Rollback(std::size_t mark, uint64_t mark_offset) noexcept;
+  void Compact() noexcept;
+};
+
+}  // namespace frame
+}  // namespace h2v
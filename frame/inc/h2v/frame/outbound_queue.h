@@ -0,0 +1,161 @@
+// inc/h2v/frame/outbound_queue.h
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "absl/base/optimization.h"
+#include "absl/types/span.h"
+#include "h2v/frame/error_code.h"
+#include "h2v/frame/frame_type.h"
+#include "h2v/frame/frame_writer.h"
+
+namespace h2v {
+namespace frame {
+
+class OutboundQueue;
+
+/// @brief Descriptor of one frame handed from a worker to the I/O thread.
+/// @details Intrusive queue node: the producer owns the storage (embed it in
+///   a response object or a per-thread pool) so enqueueing never allocates.
+///   The payload is referenced, not copied, and must stay valid until
+///   `on_done` runs.
+struct OutboundFrame {
+  enum class Kind : uint8_t {
+    /// DATA frame(s); split at the peer's max frame size.
+    Data = 0,
+    /// Encoded header block; HEADERS + CONTINUATION as needed.
+    Headers = 1,
+    /// Any other frame, payload referenced in place.
+    Frame = 2,
+    /// Small frame, payload copied into the writer's header slot.
+    Control = 3
+  };
+
+  Kind kind = Kind::Frame;
+  FrameType type = FrameType::Data;  ///< Frame/Control only
+  uint8_t flags = FRAME_FLAG::NONE;  ///< Frame/Control only
+  bool end_stream = false;           ///< Data/Headers only
+  uint32_t stream_id = 0;
+  absl::Span<const uint8_t> payload;
+
+  /// @brief Called on the I/O thread once the frame's bytes were accepted
+  ///   by the sink (`written` true) or dropped (`written` false). The node
+  ///   may be reused or freed from here.
+  void (*on_done)(OutboundFrame* frame, bool written) = nullptr;
+  void* user_data = nullptr;
+
+ private:
+  friend class OutboundQueue;
+  std::atomic<OutboundFrame*> next_{nullptr};
+  OutboundFrame* inflight_next_ = nullptr;
+  uint64_t done_offset_ = 0;  ///< writer offset that completes this frame
+};
+
+/// @brief Lock-free multi-producer / single-consumer outbound frame queue.
+/// @details One per connection. Worker threads Push() descriptors; the
+///   connection's I/O thread drains them in batches into its FrameWriter.
+///
+///   - Push() is wait-free: one atomic exchange on the tail plus one store
+///     (Vyukov's intrusive MPSC list), no allocation, no lock.
+///   - Wakeups are coalesced: Push() returns true only for the producer that
+///     finds the consumer idle, so a burst of frames costs one eventfd
+///     write / futex wake, however many threads contribute.
+///   - Drained frames wait on an in-flight list until the writer's flushed
+///     offset passes them, then `on_done` releases them, so payloads can be
+///     recycled without the producer tracking the socket.
+///
+///   Frames from one producer keep their order; frames of different
+///   producers interleave at frame boundaries.
+class OutboundQueue {
+ public:
+  OutboundQueue() noexcept;
+  ~OutboundQueue();
+  OutboundQueue(const OutboundQueue&) = delete;
+  OutboundQueue& operator=(const OutboundQueue&) = delete;
+
+  /// @brief Enqueue `frame` (any thread).
+  /// @return true if the caller must wake the I/O thread.
+  bool Push(OutboundFrame* frame) noexcept {
+    frame->next_.store(nullptr, std::memory_order_relaxed);
+    OutboundFrame* prev = tail_.exchange(frame, std::memory_order_seq_cst);
+    prev->next_.store(frame, std::memory_order_release);
+    // the link must be visible before the flag is read, or a consumer
+    // that just re-armed it and found the link missing is never woken;
+    // pairs with the fence in Drain()
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    // cheap read first: while the consumer is already scheduled, producers
+    // do not write the shared flag at all
+    return !wake_pending_.load(std::memory_order_seq_cst) &&
+           !wake_pending_.exchange(true, std::memory_order_seq_cst);
+  }
+
+  /// @brief Pop up to `max_frames` descriptors and pass each to `fn`
+  ///   (I/O thread only). Re-arms the wakeup first, so a frame pushed while
+  ///   draining either lands in this batch or triggers a new wakeup.
+  /// @return number of frames popped.
+  template <typename Fn>
+  std::size_t Drain(Fn&& fn, std::size_t max_frames = SIZE_MAX) noexcept {
+    wake_pending_.store(false, std::memory_order_seq_cst);
+    // re-arm before looking at the links; pairs with the fence in Push()
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::size_t n = 0;
+    while (n < max_frames) {
+      OutboundFrame* f = Pop();
+      if (!f) {
+        break;
+      }
+      fn(f);
+      n++;
+    }
+    if (n == max_frames && !Empty()) {
+      // batch limit hit: stay scheduled so producers need not wake us
+      wake_pending_.store(true, std::memory_order_seq_cst);
+    }
+    return n;
+  }
+
+  /// @brief Drain into `writer`; frames complete through Reap().
+  /// @return NONE, or the writer's error; the failing frame and the rest
+  ///   of the batch are completed with written=false so nothing is sent out
+  ///   of order.
+  FrameErrorCode DrainInto(FrameWriter& writer,
+                           std::size_t max_frames = SIZE_MAX) noexcept;
+
+  /// @brief Complete in-flight frames the writer has flushed.
+  /// @return number of frames completed.
+  std::size_t Reap(const FrameWriter& writer) noexcept;
+
+  /// @brief Complete every queued and in-flight frame with written=false
+  ///   (connection teardown; no producer may Push() concurrently).
+  void Abort() noexcept;
+
+  /// @brief Best-effort emptiness check (I/O thread).
+  bool Empty() const noexcept {
+    OutboundFrame* head = head_;
+    return head == &stub_ &&
+           stub_.next_.load(std::memory_order_acquire) == nullptr &&
+           tail_.load(std::memory_order_acquire) == &stub_;
+  }
+  std::size_t InFlight() const noexcept {
+    return inflight_count_;
+  }
+
+ private:
+  // producers contend on tail_, the consumer owns head_: keep them apart
+  alignas(64) std::atomic<OutboundFrame*> tail_;
+  alignas(64) std::atomic<bool> wake_pending_{false};
+  alignas(64) OutboundFrame* head_;
+  OutboundFrame stub_;
+
+  OutboundFrame* inflight_head_ = nullptr;
+  OutboundFrame* inflight_tail_ = nullptr;
+  std::size_t inflight_count_ = 0;
+
+  OutboundFrame* Pop() noexcept;
+  void Track(OutboundFrame* frame, uint64_t done_offset) noexcept;
+};
+
+}  // namespace frame
+}  // namespace h2v
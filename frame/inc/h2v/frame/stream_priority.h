@@ -0,0 +1,37 @@
+// inc/h2v/frame/stream_priority.h
+#pragma once
+
+#include <cstdint>
+
+#include "absl/strings/string_view.h"
+
+namespace h2v {
+namespace frame {
+
+/// @brief Lowest (least urgent) RFC 9218 urgency.
+constexpr uint8_t kMaxUrgency = 7;
+
+/// @brief RFC 9218 urgency used when none was signalled.
+constexpr uint8_t kDefaultUrgency = 3;
+
+/// @brief Extensible priority parameters of a stream.
+/// @see RFC 9218 §4 “Priority Parameters”
+struct StreamPriority {
+  /// 0 (most urgent) .. 7 (least urgent).
+  uint8_t urgency = kDefaultUrgency;
+  /// Response may be processed incrementally (share bandwidth round-robin).
+  bool incremental = false;
+};
+
+/// @brief Parse a Priority Field Value (`priority` header or the payload of
+///   a PRIORITY_UPDATE frame), e.g. `u=1, i`.
+/// @details Parameters not present keep the value already in `out`, so pass
+///   the current priority to apply an update, or a default-constructed one
+///   for a fresh request. Unknown keys and out-of-range values are ignored
+///   as RFC 9218 §4 requires.
+/// @return false if the field is not a syntactically valid dictionary; `out`
+///   is left untouched in that case.
+bool ParsePriorityField(absl::string_view field, StreamPriority& out) noexcept;
+
+}  // namespace frame
+}  // namespace h2v
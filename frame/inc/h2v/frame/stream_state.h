@@ -0,0 +1,223 @@
+// inc/h2v/frame/stream_state.h
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "h2v/frame/error_code.h"
+
+namespace h2v {
+namespace frame {
+
+/// @brief HTTP/2 stream lifecycle states.
+/// @see RFC 9113 §5.1 “Stream States”
+enum class StreamState : uint8_t {
+  Idle = 0,
+  ReservedLocal = 1,
+  ReservedRemote = 2,
+  Open = 3,
+  HalfClosedLocal = 4,
+  HalfClosedRemote = 5,
+  Closed = 6
+};
+constexpr std::size_t kStreamStateCount = 7;
+
+/// @brief Inputs of the stream state machine.
+/// @details END_STREAM is modelled as its own event, applied after the
+///   HEADERS or DATA frame that carries the flag. PushPromise applies to the
+///   *promised* stream.
+enum class StreamEvent : uint8_t {
+  Headers = 0,
+  Data = 1,
+  EndStream = 2,
+  RstStream = 3,
+  PushPromise = 4,
+  Priority = 5,
+  WindowUpdate = 6
+};
+constexpr std::size_t kStreamEventCount = 7;
+
+enum class StreamDirection : uint8_t { Send = 0, Recv = 1 };
+
+/// @brief How severe a rejected transition is.
+enum class TransitionScope : uint8_t {
+  /// Legal; move to `next`.
+  None = 0,
+  /// Stream error: RST_STREAM with `code` (RFC 9113 §5.4.2).
+  Stream = 1,
+  /// Connection error: GOAWAY with `code` (RFC 9113 §5.4.1).
+  Connection = 2,
+  /// We tried to send something the state forbids (caller bug).
+  Local = 3
+};
+
+/// @brief One cell of the transition table.
+/// @details Rejected cells keep `next` equal to the current state, so
+///   callers can assign `next` unconditionally.
+struct StreamTransition {
+  StreamState next;
+  TransitionScope scope;
+  uint8_t code;  ///< Http2ErrorCode, valid when scope != None
+
+  constexpr bool ok() const noexcept {
+    return scope == TransitionScope::None;
+  }
+  constexpr Http2ErrorCode error() const noexcept {
+    return static_cast<Http2ErrorCode>(code);
+  }
+};
+
+namespace stream_state_internal {
+
+constexpr std::size_t Slot(StreamState s, StreamEvent e,
+                           StreamDirection d) noexcept {
+  return (static_cast<std::size_t>(s) * kStreamEventCount +
+          static_cast<std::size_t>(e)) *
+             2 +
+         static_cast<std::size_t>(d);
+}
+
+using Table = std::array<StreamTransition, kStreamStateCount *
+                                               kStreamEventCount * 2>;
+
+constexpr void Allow(Table& t, StreamState from, StreamEvent e,
+                     StreamDirection d, StreamState to) {
+  t[Slot(from, e, d)] = {to, TransitionScope::None, 0};
+}
+
+constexpr void Reject(Table& t, StreamState from, StreamEvent e,
+                      StreamDirection d, TransitionScope scope,
+                      Http2ErrorCode code) {
+  t[Slot(from, e, d)] = {from, scope, static_cast<uint8_t>(code)};
+}
+
+constexpr Table Build() {
+  using S = StreamState;
+  using E = StreamEvent;
+  constexpr auto kSend = StreamDirection::Send;
+  constexpr auto kRecv = StreamDirection::Recv;
+
+  Table t{};
+  // default: anything not listed below is a connection PROTOCOL_ERROR when
+  // received and a local misuse when sent
+  for (std::size_t s = 0; s < kStreamStateCount; ++s) {
+    for (std::size_t e = 0; e < kStreamEventCount; ++e) {
+      Reject(t, S(s), E(e), kRecv, TransitionScope::Connection,
+             Http2ErrorCode::ProtocolError);
+      Reject(t, S(s), E(e), kSend, TransitionScope::Local,
+             Http2ErrorCode::InternalError);
+    }
+  }
+
+  // PRIORITY is legal in every state, both directions
+  for (std::size_t s = 0; s < kStreamStateCount; ++s) {
+    Allow(t, S(s), E::Priority, kRecv, S(s));
+    Allow(t, S(s), E::Priority, kSend, S(s));
+  }
+
+  // idle
+  Allow(t, S::Idle, E::Headers, kRecv, S::Open);
+  Allow(t, S::Idle, E::Headers, kSend, S::Open);
+  Allow(t, S::Idle, E::PushPromise, kRecv, S::ReservedRemote);
+  Allow(t, S::Idle, E::PushPromise, kSend, S::ReservedLocal);
+
+  // reserved (local)
+  Allow(t, S::ReservedLocal, E::Headers, kSend, S::HalfClosedRemote);
+  Allow(t, S::ReservedLocal, E::RstStream, kSend, S::Closed);
+  Allow(t, S::ReservedLocal, E::RstStream, kRecv, S::Closed);
+  Allow(t, S::ReservedLocal, E::WindowUpdate, kRecv, S::ReservedLocal);
+
+  // reserved (remote)
+  Allow(t, S::ReservedRemote, E::Headers, kRecv, S::HalfClosedLocal);
+  Allow(t, S::ReservedRemote, E::RstStream, kSend, S::Closed);
+  Allow(t, S::ReservedRemote, E::RstStream, kRecv, S::Closed);
+  Allow(t, S::ReservedRemote, E::WindowUpdate, kSend, S::ReservedRemote);
+
+  // open
+  for (auto d : {kSend, kRecv}) {
+    Allow(t, S::Open, E::Headers, d, S::Open);
+    Allow(t, S::Open, E::Data, d, S::Open);
+    Allow(t, S::Open, E::WindowUpdate, d, S::Open);
+    Allow(t, S::Open, E::RstStream, d, S::Closed);
+  }
+  Allow(t, S::Open, E::EndStream, kSend, S::HalfClosedLocal);
+  Allow(t, S::Open, E::EndStream, kRecv, S::HalfClosedRemote);
+
+  // half-closed (local): we are done sending
+  Allow(t, S::HalfClosedLocal, E::Headers, kRecv, S::HalfClosedLocal);
+  Allow(t, S::HalfClosedLocal, E::Data, kRecv, S::HalfClosedLocal);
+  Allow(t, S::HalfClosedLocal, E::EndStream, kRecv, S::Closed);
+  Allow(t, S::HalfClosedLocal, E::WindowUpdate, kRecv, S::HalfClosedLocal);
+  Allow(t, S::HalfClosedLocal, E::WindowUpdate, kSend, S::HalfClosedLocal);
+  Allow(t, S::HalfClosedLocal, E::RstStream, kRecv, S::Closed);
+  Allow(t, S::HalfClosedLocal, E::RstStream, kSend, S::Closed);
+
+  // half-closed (remote): the peer is done sending
+  Allow(t, S::HalfClosedRemote, E::Headers, kSend, S::HalfClosedRemote);
+  Allow(t, S::HalfClosedRemote, E::Data, kSend, S::HalfClosedRemote);
+  Allow(t, S::HalfClosedRemote, E::EndStream, kSend, S::Closed);
+  Allow(t, S::HalfClosedRemote, E::WindowUpdate, kSend, S::HalfClosedRemote);
+  Allow(t, S::HalfClosedRemote, E::WindowUpdate, kRecv, S::HalfClosedRemote);
+  Allow(t, S::HalfClosedRemote, E::RstStream, kRecv, S::Closed);
+  Allow(t, S::HalfClosedRemote, E::RstStream, kSend, S::Closed);
+  for (auto e : {E::Headers, E::Data, E::EndStream}) {
+    Reject(t, S::HalfClosedRemote, e, kRecv, TransitionScope::Stream,
+           Http2ErrorCode::StreamClosed);
+  }
+
+  // closed: late WINDOW_UPDATE / RST_STREAM are ignored, new content is a
+  // stream error
+  Allow(t, S::Closed, E::WindowUpdate, kRecv, S::Closed);
+  Allow(t, S::Closed, E::RstStream, kRecv, S::Closed);
+  Allow(t, S::Closed, E::RstStream, kSend, S::Closed);
+  for (auto e : {E::Headers, E::Data, E::EndStream}) {
+    Reject(t, S::Closed, e, kRecv, TransitionScope::Stream,
+           Http2ErrorCode::StreamClosed);
+  }
+
+  return t;
+}
+
+}  // namespace stream_state_internal
+
+/// @brief Complete (state, event, direction) transition table.
+inline constexpr stream_state_internal::Table kStreamTransitions =
+    stream_state_internal::Build();
+
+/// @brief Branch-free lookup into kStreamTransitions.
+constexpr StreamTransition LookupTransition(StreamState state,
+                                            StreamEvent event,
+                                            StreamDirection dir) noexcept {
+  return kStreamTransitions[stream_state_internal::Slot(state, event, dir)];
+}
+
+/// @brief Look up and apply a transition to `state`.
+/// @return the table cell; `state` is unchanged when the cell is rejected.
+inline StreamTransition ApplyTransition(StreamState& state, StreamEvent event,
+                                        StreamDirection dir) noexcept {
+  const StreamTransition t = LookupTransition(state, event, dir);
+  state = t.next;
+  return t;
+}
+
+// A few spot checks of the table itself.
+static_assert(LookupTransition(StreamState::Idle, StreamEvent::Headers,
+                               StreamDirection::Recv)
+                      .next == StreamState::Open,
+              "idle + recv HEADERS opens the stream");
+static_assert(LookupTransition(StreamState::Idle, StreamEvent::Data,
+                               StreamDirection::Recv)
+                      .scope == TransitionScope::Connection,
+              "DATA on an idle stream is a connection error");
+static_assert(LookupTransition(StreamState::HalfClosedLocal,
+                               StreamEvent::EndStream, StreamDirection::Recv)
+                      .next == StreamState::Closed,
+              "END_STREAM closes a half-closed (local) stream");
+static_assert(LookupTransition(StreamState::HalfClosedRemote,
+                               StreamEvent::Data, StreamDirection::Recv)
+                      .error() == Http2ErrorCode::StreamClosed,
+              "DATA after END_STREAM is STREAM_CLOSED");
+
+}  // namespace frame
+}  // namespace h2v
@@ -0,0 +1,178 @@
+// inc/h2v/frame/stream_table.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/types/span.h"
+#include "h2v/frame/error_code.h"
+#include "h2v/frame/frame_type.h"
+#include "h2v/frame/stream_priority.h"
+#include "h2v/frame/stream_state.h"
+
+namespace h2v {
+namespace frame {
+
+/// @brief Per-stream state owned by the StreamTable slab.
+/// @details Pointers stay valid from Open() until Close(); slots are recycled
+///   afterwards, so never keep a Stream* past Close().
+struct Stream {
+  uint32_t id = 0;
+  StreamState state = StreamState::Idle;
+  /// RFC 9218 priority; change it through WriteScheduler::SetPriority().
+  StreamPriority priority;
+  /// Bytes we may still send on this stream (may go negative after a
+  /// SETTINGS_INITIAL_WINDOW_SIZE decrease, RFC 9113 §6.9.2).
+  int64_t send_window = kDefaultInitialWindowSize;
+  /// Bytes the peer may still send on this stream.
+  int64_t recv_window = kDefaultInitialWindowSize;
+  /// Opaque application pointer (request object, handler, ...).
+  void* user_data = nullptr;
+
+ private:
+  friend class StreamTable;
+  friend class WriteScheduler;
+  friend class FlowController;
+  uint32_t active_pos_ = 0;  ///< position in StreamTable::active_
+  Stream* next_free_ = nullptr;
+
+  // WriteScheduler bookkeeping (intrusive bucket list)
+  Stream* sched_prev_ = nullptr;
+  Stream* sched_next_ = nullptr;
+  uint64_t sched_pending_ = 0;
+  int8_t sched_bucket_ = -1;  ///< -1 while not queued
+  bool sched_fin_ = false;
+
+  // FlowController bookkeeping
+  int64_t recv_window_size_ = kDefaultInitialWindowSize;  ///< advertised
+  int64_t recv_unacked_ = 0;  ///< consumed, not yet returned
+};
+
+/// @brief Registry of the open streams of one connection.
+/// @details
+///   - Stream objects live in a slab of fixed-size chunks (stable addresses,
+///     no per-stream heap allocation once warmed up).
+///   - Lookup by id goes through a direct-mapped window indexed by
+///     `(id >> 1) & mask`. Because ids grow monotonically, consecutive
+///     streams land in consecutive slots; a long-lived straggler that would
+///     be overwritten by a newer id moves to a small flat overflow map.
+///   - Active streams are also kept in a dense pointer array, so iteration
+///     is a linear scan and removal is an O(1) swap.
+///
+///   Not thread-safe: owned by the connection's I/O thread.
+class StreamTable {
+ public:
+  /// @param is_server  server side: peer opens odd ids, we open even ids.
+  /// @param initial_window  initial id-window slots (rounded to a power of 2).
+  explicit StreamTable(bool is_server,
+                       std::size_t initial_window = 64) noexcept;
+  ~StreamTable();
+  StreamTable(const StreamTable&) = delete;
+  StreamTable& operator=(const StreamTable&) = delete;
+
+  /// @brief Find an open stream.
+  /// @return the stream, or nullptr if `id` is idle or already closed.
+  Stream* Find(uint32_t id) noexcept {
+    Stream* s = window_[(id >> 1) & window_mask_];
+    if (s && s->id == id) {
+      return s;
+    }
+    return overflow_.empty() ? nullptr : FindOverflow(id);
+  }
+
+  /// @brief Open stream `id`.
+  /// @return NONE on success, INVALID_STREAM_ID if `id` is 0 or not greater
+  ///   than every id previously opened by the same endpoint (RFC 9113
+  ///   §5.1.1), OUT_OF_MEMORY if the slab cannot grow.
+  FrameErrorCode Open(uint32_t id, Stream*& out) noexcept;
+
+  /// @brief Close and recycle a stream obtained from Open()/Find().
+  void Close(Stream* stream) noexcept;
+
+  /// @brief Windows new streams start with: the peer's and our
+  ///   SETTINGS_INITIAL_WINDOW_SIZE. Streams already open are not touched
+  ///   (see WriteScheduler::OnInitialWindowSizeChange()).
+  void SetInitialWindows(int64_t send_window, int64_t recv_window) noexcept {
+    initial_send_window_ = send_window;
+    initial_recv_window_ = recv_window;
+  }
+
+  /// @brief True if `id` was never opened (it is above the high-water mark
+  ///   of the endpoint that owns its parity).
+  bool IsIdle(uint32_t id) const noexcept {
+    return IsPeerInitiated(id) ? id > last_peer_id_ : id > last_local_id_;
+  }
+
+  bool IsServer() const noexcept {
+    return is_server_;
+  }
+
+  bool IsPeerInitiated(uint32_t id) const noexcept {
+    return ((id & 1u) == 1u) == is_server_;
+  }
+
+  /// @brief Dense view over active streams. Invalidated by Open()/Close().
+  absl::Span<Stream* const> Active() const noexcept {
+    return {active_.data(), active_.size()};
+  }
+
+  /// @brief Visit every active stream; `fn` may Close() the visited stream.
+  template <typename Fn>
+  void ForEachActive(Fn&& fn) {
+    // walk backwards so swap-removal of the current element is safe
+    for (std::size_t i = active_.size(); i-- > 0;) {
+      if (i < active_.size()) {
+        fn(active_[i]);
+      }
+    }
+  }
+
+  std::size_t ActiveCount() const noexcept {
+    return active_.size();
+  }
+  /// @brief Highest peer-initiated id ever opened (GOAWAY last-stream-id).
+  uint32_t LastPeerStreamId() const noexcept {
+    return last_peer_id_;
+  }
+  uint32_t LastLocalStreamId() const noexcept {
+    return last_local_id_;
+  }
+  /// @brief Next id this endpoint may use for a new stream.
+  uint32_t NextLocalStreamId() const noexcept {
+    return last_local_id_ == 0 ? (is_server_ ? 2u : 1u) : last_local_id_ + 2;
+  }
+  std::size_t WindowSize() const noexcept {
+    return window_.size();
+  }
+  std::size_t OverflowSize() const noexcept {
+    return overflow_.size();
+  }
+
+ private:
+  static constexpr std::size_t kChunkSize = 64;
+
+  bool is_server_;
+  uint32_t last_peer_id_ = 0;
+  uint32_t last_local_id_ = 0;
+  int64_t initial_send_window_ = kDefaultInitialWindowSize;
+  int64_t initial_recv_window_ = kDefaultInitialWindowSize;
+
+  std::vector<std::unique_ptr<Stream[]>> chunks_;
+  Stream* free_ = nullptr;
+  std::vector<Stream*> active_;
+
+  std::vector<Stream*> window_;
+  std::size_t window_mask_ = 0;
+  absl::flat_hash_map<uint32_t, Stream*> overflow_;
+
+  Stream* FindOverflow(uint32_t id) noexcept;
+  Stream* AllocStream() noexcept;
+  bool GrowWindow() noexcept;
+  void IndexInsert(Stream* s);
+};
+
+}  // namespace frame
+}  // namespace h2v
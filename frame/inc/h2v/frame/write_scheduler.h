@@ -0,0 +1,117 @@
+// inc/h2v/frame/write_scheduler.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "absl/strings/string_view.h"
+#include "h2v/frame/error_code.h"
+#include "h2v/frame/frame_type.h"
+#include "h2v/frame/stream_priority.h"
+#include "h2v/frame/stream_table.h"
+
+namespace h2v {
+namespace frame {
+
+/// @brief One scheduling decision: send `bytes` of `stream`'s queued data.
+struct WriteGrant {
+  Stream* stream = nullptr;
+  /// Payload bytes the caller may put in the next DATA frame (may be 0 for
+  /// a bare END_STREAM).
+  uint32_t bytes = 0;
+  /// Set END_STREAM on this frame: no data is left and the stream was
+  /// marked finished.
+  bool end_stream = false;
+};
+
+/// @brief RFC 9218 extensible-priority scheduler for outbound DATA.
+/// @details Streams with pending data sit in one of 16 intrusive FIFO
+///   buckets: two per urgency level, non-incremental before incremental.
+///   A 16-bit occupancy mask makes picking the most urgent bucket a single
+///   count-trailing-zeros, so Next() is O(1) regardless of stream count.
+///
+///   - Non-incremental streams are served one at a time in arrival order:
+///     the head keeps the bucket until it drains (RFC 9218 §10).
+///   - Incremental streams rotate to the tail after every grant, sharing
+///     the bandwidth of their urgency level round-robin.
+///   - Grants are capped by the stream and connection send windows; a
+///     stream whose own window is exhausted leaves its bucket and comes back
+///     on WINDOW_UPDATE, so it never stalls the streams behind it.
+///
+///   The scheduler only does bookkeeping on Stream objects owned by the
+///   StreamTable; call Remove() before closing a queued stream.
+///   Not thread-safe: owned by the connection's I/O thread.
+class WriteScheduler {
+ public:
+  explicit WriteScheduler(
+      int64_t connection_window = kDefaultInitialWindowSize) noexcept;
+
+  /// @brief Queue `bytes` more payload on `stream`.
+  /// @param end_stream  the queued data ends the stream; Next() reports
+  ///   END_STREAM on the grant that drains it.
+  void Push(Stream* stream, uint64_t bytes, bool end_stream) noexcept;
+
+  /// @brief Pick the next frame to write.
+  /// @param max_frame_size  peer's SETTINGS_MAX_FRAME_SIZE.
+  /// @return false when nothing is sendable (idle, or the connection window
+  ///   is exhausted).
+  bool Next(uint32_t max_frame_size, WriteGrant& out) noexcept;
+
+  /// @brief Re-prioritize a stream in O(1).
+  void SetPriority(Stream* stream, StreamPriority priority) noexcept;
+
+  /// @brief Apply a PRIORITY_UPDATE frame (RFC 9218 §7).
+  /// @details Updates for streams that are not open are dropped; a field
+  ///   that does not parse is ignored as the RFC requires.
+  void OnPriorityUpdate(StreamTable& streams, uint32_t stream_id,
+                        absl::string_view field) noexcept;
+
+  /// @brief Apply a WINDOW_UPDATE (stream_id 0 = connection).
+  /// @return NONE, or FLOW_CONTROL_ERROR if the window would exceed 2^31-1
+  ///   (RFC 9113 §6.9.1); the caller resets the stream / connection.
+  FrameErrorCode OnWindowUpdate(Stream* stream, uint32_t increment) noexcept;
+  FrameErrorCode OnConnectionWindowUpdate(uint32_t increment) noexcept;
+
+  /// @brief Apply a change of the peer's SETTINGS_INITIAL_WINDOW_SIZE to
+  ///   every open stream (RFC 9113 §6.9.2).
+  FrameErrorCode OnInitialWindowSizeChange(StreamTable& streams,
+                                           int64_t delta) noexcept;
+
+  /// @brief Drop everything queued for `stream` (reset / close).
+  void Remove(Stream* stream) noexcept;
+
+  bool Empty() const noexcept {
+    return mask_ == 0;
+  }
+  int64_t ConnectionWindow() const noexcept {
+    return connection_window_;
+  }
+  /// @brief Queued bytes of `stream` not yet granted.
+  static uint64_t Pending(const Stream* stream) noexcept {
+    return stream->sched_pending_;
+  }
+  /// @brief True if `stream` has data but waits for a stream WINDOW_UPDATE.
+  static bool Blocked(const Stream* stream) noexcept {
+    return stream->sched_bucket_ < 0 &&
+           (stream->sched_pending_ > 0 || stream->sched_fin_);
+  }
+
+ private:
+  static constexpr std::size_t kBuckets = (kMaxUrgency + 1) * 2;
+
+  Stream* head_[kBuckets] = {};
+  Stream* tail_[kBuckets] = {};
+  uint16_t mask_ = 0;  ///< bit b set <=> bucket b non-empty
+  int64_t connection_window_;
+
+  static int8_t BucketOf(const StreamPriority& p) noexcept {
+    return int8_t(p.urgency * 2 + (p.incremental ? 1 : 0));
+  }
+  void Link(Stream* s) noexcept;
+  void Unlink(Stream* s) noexcept;
+  /// @brief Queue `s` if it has something sendable and is not queued yet.
+  void Wake(Stream* s) noexcept;
+};
+
+}  // namespace frame
+}  // namespace h2v
@@ -0,0 +1,171 @@
+// src/h2v/frame/flow_control.cc
+#include "h2v/frame/flow_control.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace h2v {
+namespace frame {
+
+FlowController::FlowController(const FlowControlConfig& config) noexcept
+                : config_(config),
+                  conn_target_(std::min(config.initial_connection_window,
+                                        kMaxWindowSize)),
+                  stream_target_(std::min(config.initial_stream_window,
+                                          kMaxWindowSize)),
+                  probe_interval_us_(config.min_probe_interval_us) {
+  config_.max_stream_window = std::min(config_.max_stream_window,
+                                       kMaxWindowSize);
+  config_.max_connection_window = std::min(config_.max_connection_window,
+                                           kMaxWindowSize);
+}
+
+bool FlowController::Due(int64_t unacked, int64_t window_size) const noexcept {
+  return unacked > 0 &&
+         double(unacked) >= double(window_size) * config_.update_threshold;
+}
+
+FrameErrorCode FlowController::SendUpdate(uint32_t stream_id, int64_t increment,
+                                          FrameWriter& writer) noexcept {
+  uint8_t payload[4];
+  PutUint32BE(payload, uint32_t(increment));
+  const FrameErrorCode rc = writer.WriteControl(
+      FrameType::WindowUpdate, FRAME_FLAG::NONE, stream_id, payload);
+  if (rc == FRAME_ERR::NONE) {
+    updates_sent_++;
+  }
+  return rc;
+}
+
+FrameErrorCode FlowController::Start(FrameWriter& writer) noexcept {
+  if (conn_target_ <= conn_window_size_) {
+    return FRAME_ERR::NONE;
+  }
+  const int64_t increment = conn_target_ - conn_window_size_;
+  const FrameErrorCode rc = SendUpdate(0, increment, writer);
+  if (rc == FRAME_ERR::NONE) {
+    conn_window_ += increment;
+    conn_window_size_ = conn_target_;
+  }
+  return rc;
+}
+
+FrameErrorCode FlowController::OnDataReceived(Stream* stream,
+                                              uint32_t frame_length,
+                                              uint64_t now_us,
+                                              FrameWriter& writer) noexcept {
+  if (int64_t(frame_length) > conn_window_) {
+    return FRAME_ERR::FLOW_CONTROL_ERROR;
+  }
+  if (stream && int64_t(frame_length) > stream->recv_window) {
+    return FRAME_ERR::FLOW_CONTROL_ERROR;
+  }
+  conn_window_ -= frame_length;
+  if (stream) {
+    stream->recv_window -= frame_length;
+  }
+
+  if (!config_.auto_tune || frame_length == 0) {
+    return FRAME_ERR::NONE;
+  }
+  if (probe_in_flight_) {
+    probe_bytes_ += frame_length;
+    return FRAME_ERR::NONE;
+  }
+  if (conn_target_ >= config_.max_connection_window &&
+      stream_target_ >= config_.max_stream_window) {
+    return FRAME_ERR::NONE;  // nothing left to tune
+  }
+  if (probe_sent_us_ != 0 && now_us - probe_sent_us_ < probe_interval_us_) {
+    return FRAME_ERR::NONE;
+  }
+  const FrameErrorCode rc = writer.WriteControl(
+      FrameType::Ping, FRAME_FLAG::NONE, 0,
+      absl::Span<const uint8_t>(kBdpPingPayload, sizeof(kBdpPingPayload)));
+  if (rc != FRAME_ERR::NONE) {
+    return rc;
+  }
+  probe_in_flight_ = true;
+  probe_sent_us_ = now_us;
+  probe_bytes_ = frame_length;
+  return FRAME_ERR::NONE;
+}
+
+FrameErrorCode FlowController::OnConsumed(Stream* stream, uint32_t bytes,
+                                          FrameWriter& writer) noexcept {
+  conn_unacked_ += bytes;
+  if (Due(conn_unacked_, conn_window_size_) ||
+      conn_target_ > conn_window_size_) {
+    const int64_t increment =
+        conn_unacked_ + (conn_target_ - conn_window_size_);
+    if (increment > 0) {
+      const FrameErrorCode rc = SendUpdate(0, increment, writer);
+      if (rc != FRAME_ERR::NONE) {
+        return rc;
+      }
+      conn_window_ += increment;
+      conn_window_size_ = conn_target_;
+      conn_unacked_ = 0;
+    }
+  }
+
+  // no point returning stream credit once the peer stopped sending
+  if (!stream || stream->state == StreamState::HalfClosedRemote ||
+      stream->state == StreamState::Closed) {
+    return FRAME_ERR::NONE;
+  }
+  stream->recv_unacked_ += bytes;
+  const int64_t size = std::max(stream->recv_window_size_, stream_target_);
+  if (!Due(stream->recv_unacked_, stream->recv_window_size_)) {
+    return FRAME_ERR::NONE;
+  }
+  const int64_t increment =
+      stream->recv_unacked_ + (size - stream->recv_window_size_);
+  const FrameErrorCode rc = SendUpdate(stream->id, increment, writer);
+  if (rc != FRAME_ERR::NONE) {
+    return rc;
+  }
+  stream->recv_window += increment;
+  stream->recv_window_size_ = size;
+  stream->recv_unacked_ = 0;
+  return FRAME_ERR::NONE;
+}
+
+bool FlowController::OnPingAck(absl::Span<const uint8_t> opaque,
+                               uint64_t now_us) noexcept {
+  if (!probe_in_flight_ || opaque.size() != sizeof(kBdpPingPayload) ||
+      std::memcmp(opaque.data(), kBdpPingPayload, sizeof(kBdpPingPayload)) !=
+          0) {
+    return false;
+  }
+  probe_in_flight_ = false;
+  rtt_us_ = now_us > probe_sent_us_ ? now_us - probe_sent_us_ : 1;
+
+  // the window limited this round trip if the sample nearly filled it
+  const int64_t sample = int64_t(probe_bytes_);
+  bool grew = false;
+  if (sample * 3 >= conn_window_size_ * 2 &&
+      conn_target_ < config_.max_connection_window) {
+    conn_target_ = std::min(config_.max_connection_window,
+                            std::max(conn_target_, sample * 2));
+    grew = true;
+  }
+  if (sample * 3 >= stream_target_ * 2 &&
+      stream_target_ < config_.max_stream_window) {
+    stream_target_ = std::min(config_.max_stream_window,
+                              std::max(stream_target_, sample * 2));
+    grew = true;
+  }
+
+  if (grew) {
+    probe_interval_us_ = config_.min_probe_interval_us;
+  } else {
+    probe_interval_us_ =
+        std::min(kMaxProbeIntervalUs,
+                 std::max<uint64_t>(probe_interval_us_ * 2, rtt_us_));
+  }
+  return true;
+}
+
+}  // namespace frame
+}  // namespace h2v
@@ -0,0 +1,623 @@
+// src/h2v/frame/frame_parser.cc
+#include "h2v/frame/frame_parser.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace h2v {
+namespace frame {
+
+FrameParser::FrameParser(StreamTable& streams, FrameVisitor& visitor,
+                         bool expect_preface) noexcept
+                : streams_(streams),
+                  visitor_(visitor),
+                  preface_pos_(expect_preface ? 0 : kConnectionPreface.size()) {
+}
+
+FrameErrorCode FrameParser::SetMaxFrameSize(uint32_t max_frame_size) noexcept {
+  if (max_frame_size < kDefaultMaxFrameSize ||
+      max_frame_size > kMaxAllowedFrameSize) {
+    return FRAME_ERR::INVALID_ARGS;
+  }
+  max_frame_size_ = max_frame_size;
+  return FRAME_ERR::NONE;
+}
+
+FrameErrorCode FrameParser::Parse(absl::Span<const uint8_t> in,
+                                  std::size_t& consumed) noexcept {
+  consumed = 0;
+  if (failed_) {
+    return FRAME_ERR::CONNECTION_ERROR;
+  }
+
+  std::size_t pos = 0;
+
+  // 1) connection preface (server side only)
+  while (preface_pos_ < kConnectionPreface.size() && pos < in.size()) {
+    if (in[pos] != static_cast<uint8_t>(kConnectionPreface[preface_pos_])) {
+      consumed = pos;
+      ConnectionError(Http2ErrorCode::ProtocolError, "invalid preface");
+      return FRAME_ERR::CONNECTION_ERROR;
+    }
+    pos++;
+    preface_pos_++;
+  }
+
+  // 2) frames
+  while (pos < in.size()) {
+    if (pending_.size() > 0) {
+      // finish a frame that straddled the previous read
+      if (pending_.size() < kFrameHeaderSize) {
+        const std::size_t take =
+            std::min(kFrameHeaderSize - pending_.size(), in.size() - pos);
+        uint8_t* dst = pending_.append(take);
+        if (!dst) {
+          consumed = pos;
+          return FRAME_ERR::OUT_OF_MEMORY;
+        }
+        std::memcpy(dst, in.data() + pos, take);
+        pos += take;
+        if (pending_.size() < kFrameHeaderSize) {
+          break;
+        }
+      }
+      const FrameHeader h = DecodeFrameHeader(pending_.raw());
+      if (!Admissible(h)) {
+        consumed = pos;
+        return FRAME_ERR::CONNECTION_ERROR;
+      }
+      const std::size_t frame_size = kFrameHeaderSize + h.length;
+      const std::size_t take =
+          std::min(frame_size - pending_.size(), in.size() - pos);
+      if (take > 0) {
+        uint8_t* dst = pending_.append(take);
+        if (!dst) {
+          consumed = pos;
+          return FRAME_ERR::OUT_OF_MEMORY;
+        }
+        std::memcpy(dst, in.data() + pos, take);
+        pos += take;
+      }
+      if (pending_.size() < frame_size) {
+        break;
+      }
+      const bool ok = Dispatch(
+          h, absl::Span<const uint8_t>(pending_.raw() + kFrameHeaderSize,
+                                       h.length));
+      pending_.clear();
+      if (!ok) {
+        consumed = pos;
+        return FRAME_ERR::CONNECTION_ERROR;
+      }
+      continue;
+    }
+
+    const std::size_t avail = in.size() - pos;
+    if (avail >= kFrameHeaderSize) {
+      const FrameHeader h = DecodeFrameHeader(in.data() + pos);
+      if (!Admissible(h)) {
+        consumed = pos;
+        return FRAME_ERR::CONNECTION_ERROR;
+      }
+      if (avail >= kFrameHeaderSize + h.length) {
+        // zero-copy: the whole frame is in the caller's buffer
+        const bool ok =
+            Dispatch(h, in.subspan(pos + kFrameHeaderSize, h.length));
+        pos += kFrameHeaderSize + h.length;
+        if (!ok) {
+          consumed = pos;
+          return FRAME_ERR::CONNECTION_ERROR;
+        }
+        continue;
+      }
+    }
+
+    // partial frame: stash the tail until the next read
+    uint8_t* dst = pending_.append(avail);
+    if (!dst) {
+      consumed = pos;
+      return FRAME_ERR::OUT_OF_MEMORY;
+    }
+    std::memcpy(dst, in.data() + pos, avail);
+    pos += avail;
+  }
+
+  consumed = pos;
+  return FRAME_ERR::NONE;
+}
+
+bool FrameParser::Admissible(const FrameHeader& h) {
+  if (h.length > max_frame_size_) {
+    return ConnectionError(Http2ErrorCode::FrameSizeError, "frame too large");
+  }
+  // refuse a header block that outgrows the cap before buffering its payload
+  const bool block_frame = h.type == FrameType::Headers ||
+                           h.type == FrameType::PushPromise ||
+                           h.type == FrameType::Continuation;
+  if (block_frame && max_header_block_size_ > 0) {
+    const std::size_t total =
+        (h.type == FrameType::Continuation ? block_bytes_ : 0) + h.length;
+    if (total > max_header_block_size_) {
+      return ConnectionError(Http2ErrorCode::EnhanceYourCalm,
+                             "header block too large");
+    }
+  }
+  return true;
+}
+
+bool FrameParser::Dispatch(const FrameHeader& h,
+                           absl::Span<const uint8_t> p) noexcept {
+  frames_parsed_++;
+
+  // RFC 9113 §6.10: nothing may interleave with an open header block
+  if (block_stream_id_ != 0 && h.type != FrameType::Continuation) {
+    return ConnectionError(Http2ErrorCode::ProtocolError,
+                           "expected CONTINUATION");
+  }
+  if (guard_ && !ChargeFlood(h, p)) {
+    return false;
+  }
+
+  switch (h.type) {
+    case FrameType::Data:
+      return OnDataFrame(h, p);
+    case FrameType::Headers:
+      return OnHeadersFrame(h, p);
+    case FrameType::Continuation:
+      return OnContinuationFrame(h, p);
+    case FrameType::PushPromise:
+      return OnPushPromiseFrame(h, p);
+    case FrameType::RstStream:
+      return OnRstStreamFrame(h, p);
+    case FrameType::Settings:
+      return OnSettingsFrame(h, p);
+    case FrameType::WindowUpdate:
+      return OnWindowUpdateFrame(h, p);
+
+    case FrameType::Priority: {
+      if (h.stream_id == 0) {
+        return ConnectionError(Http2ErrorCode::ProtocolError,
+                               "PRIORITY on stream 0");
+      }
+      if (h.length != 5) {
+        StreamError(h.stream_id, streams_.Find(h.stream_id),
+                    Http2ErrorCode::FrameSizeError);
+        return true;
+      }
+      // RFC 9113 §5.3.2: the RFC 7540 priority scheme is deprecated; the
+      // frame is validated and otherwise ignored
+      return true;
+    }
+
+    case FrameType::Ping:
+      if (h.stream_id != 0) {
+        return ConnectionError(Http2ErrorCode::ProtocolError,
+                               "PING on a stream");
+      }
+      if (h.length != 8) {
+        return ConnectionError(Http2ErrorCode::FrameSizeError,
+                               "PING length");
+      }
+      visitor_.OnPing((h.flags & FRAME_FLAG::ACK) != 0, p);
+      return true;
+
+    case FrameType::Goaway:
+      if (h.stream_id != 0) {
+        return ConnectionError(Http2ErrorCode::ProtocolError,
+                               "GOAWAY on a stream");
+      }
+      if (h.length < 8) {
+        return ConnectionError(Http2ErrorCode::FrameSizeError,
+                               "GOAWAY length");
+      }
+      visitor_.OnGoaway(GetUint32BE(p.data()) & kStreamIdMask,
+                        static_cast<Http2ErrorCode>(GetUint32BE(p.data() + 4)),
+                        p.subspan(8));
+      return true;
+
+    case FrameType::PriorityUpdate:
+      if (h.stream_id != 0) {
+        return ConnectionError(Http2ErrorCode::ProtocolError,
+                               "PRIORITY_UPDATE on a stream");
+      }
+      if (h.length < 4) {
+        return ConnectionError(Http2ErrorCode::FrameSizeError,
+                               "PRIORITY_UPDATE length");
+      }
+      visitor_.OnPriorityUpdate(
+          GetUint32BE(p.data()) & kStreamIdMask,
+          absl::string_view(reinterpret_cast<const char*>(p.data()) + 4,
+                            p.size() - 4));
+      return true;
+
+    default:
+      // RFC 9113 §4.1: unknown frame types MUST be ignored
+      return true;
+  }
+}
+
+bool FrameParser::ChargeFlood(const FrameHeader& h,
+                              absl::Span<const uint8_t> p) {
+  FloodEvent event;
+  switch (h.type) {
+    case FrameType::RstStream:
+      event = FloodEvent::RstStream;
+      break;
+    case FrameType::Ping:
+      if (h.flags & FRAME_FLAG::ACK) {
+        return true;
+      }
+      event = FloodEvent::Ping;
+      break;
+    case FrameType::Settings:
+      if (h.flags & FRAME_FLAG::ACK) {
+        return true;
+      }
+      event = FloodEvent::Settings;
+      break;
+    case FrameType::Data: {
+      if (h.flags & FRAME_FLAG::END_STREAM) {
+        return true;
+      }
+      // padding only counts as empty too
+      const bool padded = (h.flags & FRAME_FLAG::PADDED) != 0;
+      if (padded ? (!p.empty() && std::size_t(p[0]) + 1 < p.size())
+                 : !p.empty()) {
+        return true;
+      }
+      event = FloodEvent::EmptyData;
+      break;
+    }
+    case FrameType::Continuation:
+      if (h.flags & FRAME_FLAG::END_HEADERS) {
+        return true;
+      }
+      event = FloodEvent::Continuation;
+      break;
+    default:
+      return true;
+  }
+  if (guard_->Charge(event)) {
+    return true;
+  }
+  return ConnectionError(guard_->GoawayCode(), "flood budget exhausted");
+}
+
+bool FrameParser::StripPadding(const FrameHeader& h,
+                               absl::Span<const uint8_t>& p) {
+  if ((h.flags & FRAME_FLAG::PADDED) == 0) {
+    return true;
+  }
+  if (p.empty()) {
+    return ConnectionError(Http2ErrorCode::FrameSizeError, "missing pad");
+  }
+  const std::size_t pad = p[0];
+  if (pad >= p.size()) {
+    return ConnectionError(Http2ErrorCode::ProtocolError, "pad too long");
+  }
+  p = p.subspan(1, p.size() - 1 - pad);
+  return true;
+}
+
+StreamState FrameParser::StateOf(uint32_t id, Stream*& stream) noexcept {
+  stream = streams_.Find(id);
+  if (stream) {
+    return stream->state;
+  }
+  return streams_.IsIdle(id) ? StreamState::Idle : StreamState::Closed;
+}
+
+StreamTransition FrameParser::Receive(uint32_t id, Stream*& stream,
+                                      StreamEvent event) {
+  const StreamState st = StateOf(id, stream);
+  if (!stream && st == StreamState::Idle &&
+      (event == StreamEvent::Headers || event == StreamEvent::PushPromise) &&
+      !streams_.IsPeerInitiated(id)) {
+    ConnectionError(Http2ErrorCode::ProtocolError, "stream id parity");
+    return {st, TransitionScope::Connection,
+            static_cast<uint8_t>(Http2ErrorCode::ProtocolError)};
+  }
+
+  const StreamTransition t =
+      LookupTransition(st, event, StreamDirection::Recv);
+  switch (t.scope) {
+    case TransitionScope::None:
+      break;
+    case TransitionScope::Stream:
+      StreamError(id, stream, t.error());
+      stream = nullptr;
+      return t;
+    default:
+      ConnectionError(t.error(), "frame not allowed in stream state");
+      return t;
+  }
+
+  if (!stream && st == StreamState::Idle && t.next != StreamState::Idle) {
+    if (streams_.Open(id, stream) != FRAME_ERR::NONE) {
+      visitor_.OnStreamError(id, Http2ErrorCode::RefusedStream);
+      return {st, TransitionScope::Stream,
+              static_cast<uint8_t>(Http2ErrorCode::RefusedStream)};
+    }
+  }
+  if (stream) {
+    stream->state = t.next;
+  }
+  return t;
+}
+
+void FrameParser::StreamError(uint32_t id, Stream* stream,
+                              Http2ErrorCode code) noexcept {
+  visitor_.OnStreamError(id, code);
+  if (stream) {
+    stream->state = StreamState::Closed;
+    CloseStream(stream);
+  }
+}
+
+void FrameParser::CloseStream(Stream* stream) noexcept {
+  visitor_.OnStreamClosed(stream);
+  streams_.Close(stream);
+}
+
+bool FrameParser::OnDataFrame(const FrameHeader& h,
+                              absl::Span<const uint8_t> p) {
+  if (h.stream_id == 0) {
+    return ConnectionError(Http2ErrorCode::ProtocolError, "DATA on stream 0");
+  }
+  if (!StripPadding(h, p)) {
+    return false;
+  }
+  Stream* s = nullptr;
+  const StreamTransition t = Receive(h.stream_id, s, StreamEvent::Data);
+  if (t.scope == TransitionScope::Connection) {
+    return false;
+  }
+  const bool end_stream = (h.flags & FRAME_FLAG::END_STREAM) != 0;
+  if (!t.ok()) {
+    // still counts against the connection window
+    visitor_.OnData(h.stream_id, nullptr, p, h.length, end_stream);
+    return !failed_;
+  }
+  visitor_.OnData(h.stream_id, s, p, h.length, end_stream);
+  if (end_stream) {
+    const StreamTransition es =
+        Receive(h.stream_id, s, StreamEvent::EndStream);
+    if (es.scope == TransitionScope::Connection) {
+      return false;
+    }
+  }
+  if (s && s->state == StreamState::Closed) {
+    CloseStream(s);
+  }
+  return true;
+}
+
+bool FrameParser::OnHeadersFrame(const FrameHeader& h,
+                                 absl::Span<const uint8_t> p) {
+  if (h.stream_id == 0) {
+    return ConnectionError(Http2ErrorCode::ProtocolError,
+                           "HEADERS on stream 0");
+  }
+  if (!StripPadding(h, p)) {
+    return false;
+  }
+  if (h.flags & FRAME_FLAG::PRIORITY) {
+    if (p.size() < 5) {
+      return ConnectionError(Http2ErrorCode::FrameSizeError,
+                             "HEADERS priority");
+    }
+    p = p.subspan(5);
+  }
+
+  Stream* s = nullptr;
+  const StreamTransition t = Receive(h.stream_id, s, StreamEvent::Headers);
+  if (t.scope == TransitionScope::Connection) {
+    return false;
+  }
+
+  const bool end_headers = (h.flags & FRAME_FLAG::END_HEADERS) != 0;
+  block_stream_id_ = h.stream_id;
+  block_bytes_ = h.length;
+  block_end_stream_ = (h.flags & FRAME_FLAG::END_STREAM) != 0;
+  block_accepted_ = t.ok();
+
+  // delivered even when rejected so the HPACK decoder stays in sync
+  visitor_.OnHeaders(h.stream_id, t.ok() ? s : nullptr, p, end_headers,
+                     block_end_stream_);
+  if (end_headers) {
+    FinishHeaderBlock();
+  }
+  return !failed_;
+}
+
+bool FrameParser::OnContinuationFrame(const FrameHeader& h,
+                                      absl::Span<const uint8_t> p) {
+  if (block_stream_id_ == 0 || h.stream_id != block_stream_id_) {
+    return ConnectionError(Http2ErrorCode::ProtocolError,
+                           "unexpected CONTINUATION");
+  }
+  block_bytes_ += h.length;
+  const bool end_headers = (h.flags & FRAME_FLAG::END_HEADERS) != 0;
+  Stream* s = block_accepted_ ? streams_.Find(h.stream_id) : nullptr;
+  visitor_.OnContinuation(h.stream_id, s, p, end_headers);
+  if (end_headers) {
+    FinishHeaderBlock();
+  }
+  return !failed_;
+}
+
+void FrameParser::FinishHeaderBlock() {
+  const uint32_t id = block_stream_id_;
+  const bool apply_es = block_accepted_ && block_end_stream_;
+  block_stream_id_ = 0;
+  block_bytes_ = 0;
+  block_end_stream_ = false;
+  block_accepted_ = false;
+
+  Stream* s = nullptr;
+  if (apply_es) {
+    // END_STREAM on HEADERS takes effect once the whole block arrived
+    Receive(id, s, StreamEvent::EndStream);
+  } else {
+    s = streams_.Find(id);
+  }
+  if (s && s->state == StreamState::Closed) {
+    CloseStream(s);
+  }
+}
+
+bool FrameParser::OnPushPromiseFrame(const FrameHeader& h,
+                                     absl::Span<const uint8_t> p) {
+  if (streams_.IsServer()) {
+    return ConnectionError(Http2ErrorCode::ProtocolError,
+                           "PUSH_PROMISE from a client");
+  }
+  if (h.stream_id == 0) {
+    return ConnectionError(Http2ErrorCode::ProtocolError,
+                           "PUSH_PROMISE on stream 0");
+  }
+  if (!StripPadding(h, p)) {
+    return false;
+  }
+  if (p.size() < 4) {
+    return ConnectionError(Http2ErrorCode::FrameSizeError,
+                           "PUSH_PROMISE length");
+  }
+
+  Stream* assoc = nullptr;
+  const StreamState assoc_state = StateOf(h.stream_id, assoc);
+  if (assoc_state != StreamState::Open &&
+      assoc_state != StreamState::HalfClosedLocal) {
+    return ConnectionError(Http2ErrorCode::ProtocolError,
+                           "PUSH_PROMISE on a non-open stream");
+  }
+
+  const uint32_t promised_id = GetUint32BE(p.data()) & kStreamIdMask;
+  Stream* promised = nullptr;
+  const StreamTransition t =
+      Receive(promised_id, promised, StreamEvent::PushPromise);
+  if (t.scope == TransitionScope::Connection) {
+    return false;
+  }
+
+  const bool end_headers = (h.flags & FRAME_FLAG::END_HEADERS) != 0;
+  block_stream_id_ = h.stream_id;
+  block_bytes_ = h.length;
+  block_end_stream_ = false;
+  block_accepted_ = t.ok();
+  visitor_.OnPushPromise(h.stream_id, t.ok() ? promised : nullptr,
+                         p.subspan(4), end_headers);
+  if (end_headers) {
+    FinishHeaderBlock();
+  }
+  return !failed_;
+}
+
+bool FrameParser::OnRstStreamFrame(const FrameHeader& h,
+                                   absl::Span<const uint8_t> p) {
+  if (h.stream_id == 0) {
+    return ConnectionError(Http2ErrorCode::ProtocolError,
+                           "RST_STREAM on stream 0");
+  }
+  if (h.length != 4) {
+    return ConnectionError(Http2ErrorCode::FrameSizeError,
+                           "RST_STREAM length");
+  }
+  Stream* s = nullptr;
+  const StreamTransition t = Receive(h.stream_id, s, StreamEvent::RstStream);
+  if (t.scope == TransitionScope::Connection) {
+    return false;
+  }
+  visitor_.OnRstStream(h.stream_id,
+                       static_cast<Http2ErrorCode>(GetUint32BE(p.data())));
+  if (s && s->state == StreamState::Closed) {
+    CloseStream(s);
+  }
+  return true;
+}
+
+bool FrameParser::OnSettingsFrame(const FrameHeader& h,
+                                  absl::Span<const uint8_t> p) {
+  if (h.stream_id != 0) {
+    return ConnectionError(Http2ErrorCode::ProtocolError,
+                           "SETTINGS on a stream");
+  }
+  const bool ack = (h.flags & FRAME_FLAG::ACK) != 0;
+  if ((ack && h.length != 0) || h.length % 6 != 0) {
+    return ConnectionError(Http2ErrorCode::FrameSizeError, "SETTINGS length");
+  }
+  for (std::size_t off = 0; off < p.size(); off += 6) {
+    const uint16_t id = uint16_t((p[off] << 8) | p[off + 1]);
+    const uint32_t value = GetUint32BE(p.data() + off + 2);
+    switch (id) {
+      case SETTINGS_ID::ENABLE_PUSH:
+        if (value > 1) {
+          return ConnectionError(Http2ErrorCode::ProtocolError,
+                                 "SETTINGS_ENABLE_PUSH");
+        }
+        break;
+      case SETTINGS_ID::INITIAL_WINDOW_SIZE:
+        if (value > 0x7FFFFFFFu) {
+          return ConnectionError(Http2ErrorCode::FlowControlError,
+                                 "SETTINGS_INITIAL_WINDOW_SIZE");
+        }
+        break;
+      case SETTINGS_ID::MAX_FRAME_SIZE:
+        if (value < kDefaultMaxFrameSize || value > kMaxAllowedFrameSize) {
+          return ConnectionError(Http2ErrorCode::ProtocolError,
+                                 "SETTINGS_MAX_FRAME_SIZE");
+        }
+        break;
+      default:
+        break;
+    }
+    visitor_.OnSetting(id, value);
+  }
+  visitor_.OnSettingsEnd(ack);
+  return true;
+}
+
+bool FrameParser::OnWindowUpdateFrame(const FrameHeader& h,
+                                      absl::Span<const uint8_t> p) {
+  if (h.length != 4) {
+    return ConnectionError(Http2ErrorCode::FrameSizeError,
+                           "WINDOW_UPDATE length");
+  }
+  const uint32_t increment = GetUint32BE(p.data()) & 0x7FFFFFFFu;
+  if (h.stream_id == 0) {
+    if (increment == 0) {
+      return ConnectionError(Http2ErrorCode::ProtocolError,
+                             "WINDOW_UPDATE increment 0");
+    }
+    visitor_.OnWindowUpdate(0, increment);
+    return true;
+  }
+
+  Stream* s = nullptr;
+  const StreamTransition t =
+      Receive(h.stream_id, s, StreamEvent::WindowUpdate);
+  if (t.scope == TransitionScope::Connection) {
+    return false;
+  }
+  if (!t.ok()) {
+    return true;
+  }
+  if (increment == 0) {
+    StreamError(h.stream_id, s, Http2ErrorCode::ProtocolError);
+    return true;
+  }
+  visitor_.OnWindowUpdate(h.stream_id, increment);
+  return true;
+}
+
+bool FrameParser::ConnectionError(Http2ErrorCode code,
+                                  absl::string_view reason) {
+  if (!failed_) {
+    failed_ = true;
+    visitor_.OnConnectionError(code, reason);
+  }
+  return false;
+}
+
+}  // namespace frame
+}  // namespace h2v
@@ -0,0 +1,347 @@
+// src/h2v/frame/frame_writer.cc
+#include "h2v/frame/frame_writer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace h2v {
+namespace frame {
+
+// -----------------------------------------------------------------------------
+// HeaderArena
+// -----------------------------------------------------------------------------
+
+HeaderArena::HeaderArena(std::size_t slots_per_block) noexcept
+                : slots_per_block_(slots_per_block ? slots_per_block : 1) {}
+
+uint8_t* HeaderArena::Acquire() noexcept {
+  if (!free_) {
+    Slot* block = new (std::nothrow) Slot[slots_per_block_];
+    if (!block) {
+      return nullptr;
+    }
+    try {
+      blocks_.emplace_back(block);
+    } catch (...) {
+      delete[] block;
+      return nullptr;
+    }
+    // thread the new block onto the free list, lowest address first
+    for (std::size_t i = slots_per_block_; i-- > 0;) {
+      block[i].next = free_;
+      free_ = &block[i];
+    }
+  }
+  Slot* s = free_;
+  free_ = s->next;
+  in_use_++;
+  return s->bytes;
+}
+
+void HeaderArena::Release(uint8_t* slot) noexcept {
+  if (!slot) {
+    return;
+  }
+  Slot* s = reinterpret_cast<Slot*>(slot);
+  s->next = free_;
+  free_ = s;
+  in_use_--;
+}
+
+// -----------------------------------------------------------------------------
+// FrameWriter
+// -----------------------------------------------------------------------------
+
+FrameWriter::FrameWriter(uint32_t max_frame_size) noexcept
+                : max_frame_size_(kDefaultMaxFrameSize) {
+  SetMaxFrameSize(max_frame_size);
+}
+
+FrameWriter::~FrameWriter() {
+  Clear();
+}
+
+FrameErrorCode FrameWriter::SetMaxFrameSize(uint32_t max_frame_size) noexcept {
+  if (max_frame_size < kDefaultMaxFrameSize ||
+      max_frame_size > kMaxAllowedFrameSize) {
+    return FRAME_ERR::INVALID_ARGS;
+  }
+  max_frame_size_ = max_frame_size;
+  return FRAME_ERR::NONE;
+}
+
+uint8_t* FrameWriter::PushHeader(const FrameHeader& header) noexcept {
+  uint8_t* slot = arena_.Acquire();
+  if (!slot) {
+    return nullptr;
+  }
+  EncodeFrameHeader(header, slot);
+  try {
+    segments_.push_back({slot, kFrameHeaderSize});
+    owners_.push_back(slot);
+  } catch (...) {
+    if (segments_.size() > owners_.size()) {
+      segments_.pop_back();
+    }
+    arena_.Release(slot);
+    return nullptr;
+  }
+  queued_offset_ += kFrameHeaderSize;
+  return slot;
+}
+
+void FrameWriter::PushPayload(const uint8_t* data, std::size_t len) noexcept {
+  // capacity was reserved by the caller, so this never throws
+  segments_.push_back({const_cast<uint8_t*>(data), len});
+  owners_.push_back(nullptr);
+  queued_offset_ += len;
+}
+
+FrameErrorCode FrameWriter::WriteData(uint32_t stream_id,
+                                      absl::Span<const uint8_t> payload,
+                                      bool end_stream) noexcept {
+  const absl::Span<const uint8_t> chain[1] = {payload};
+  return WriteDataChain(stream_id, chain, end_stream);
+}
+
+FrameErrorCode FrameWriter::WriteDataChain(
+    uint32_t stream_id, absl::Span<const absl::Span<const uint8_t>> chain,
+    bool end_stream) noexcept {
+  if (stream_id == 0) {
+    return FRAME_ERR::INVALID_ARGS;
+  }
+
+  std::size_t total = 0;
+  for (const auto& link : chain) {
+    total += link.size();
+  }
+
+  // worst case: every frame boundary and every link adds one segment
+  const std::size_t frames =
+      total == 0 ? 1 : (total + max_frame_size_ - 1) / max_frame_size_;
+  const std::size_t mark = segments_.size();
+  const uint64_t mark_offset = queued_offset_;
+  try {
+    segments_.reserve(mark + frames * 2 + chain.size());
+    owners_.reserve(mark + frames * 2 + chain.size());
+  } catch (...) {
+    return FRAME_ERR::OUT_OF_MEMORY;
+  }
+
+  std::size_t link = 0, link_pos = 0, remaining = total;
+  do {
+    const uint32_t len =
+        static_cast<uint32_t>(std::min<std::size_t>(remaining, max_frame_size_));
+    remaining -= len;
+
+    FrameHeader h;
+    h.length = len;
+    h.type = FrameType::Data;
+    h.flags = (end_stream && remaining == 0) ? FRAME_FLAG::END_STREAM
+                                             : FRAME_FLAG::NONE;
+    h.stream_id = stream_id;
+    if (!PushHeader(h)) {
+      Rollback(mark, mark_offset);
+      return FRAME_ERR::OUT_OF_MEMORY;
+    }
+
+    std::size_t need = len;
+    while (need > 0) {
+      const auto& cur = chain[link];
+      const std::size_t take = std::min(need, cur.size() - link_pos);
+      if (take > 0) {
+        PushPayload(cur.data() + link_pos, take);
+      }
+      need -= take;
+      link_pos += take;
+      if (link_pos == cur.size()) {
+        link++;
+        link_pos = 0;
+      }
+    }
+    // skip empty links so the next frame starts on real bytes
+    while (link < chain.size() && chain[link].size() == link_pos) {
+      link++;
+      link_pos = 0;
+    }
+  } while (remaining > 0);
+
+  return FRAME_ERR::NONE;
+}
+
+FrameErrorCode FrameWriter::WriteHeaders(uint32_t stream_id,
+                                         absl::Span<const uint8_t> block,
+                                         bool end_stream) noexcept {
+  if (stream_id == 0) {
+    return FRAME_ERR::INVALID_ARGS;
+  }
+  const std::size_t frames =
+      block.empty() ? 1 : (block.size() + max_frame_size_ - 1) / max_frame_size_;
+  const std::size_t mark = segments_.size();
+  const uint64_t mark_offset = queued_offset_;
+  try {
+    segments_.reserve(mark + frames * 2);
+    owners_.reserve(mark + frames * 2);
+  } catch (...) {
+    return FRAME_ERR::OUT_OF_MEMORY;
+  }
+
+  std::size_t pos = 0;
+  bool first = true;
+  do {
+    const uint32_t len = static_cast<uint32_t>(
+        std::min<std::size_t>(block.size() - pos, max_frame_size_));
+    const bool last = pos + len == block.size();
+
+    FrameHeader h;
+    h.length = len;
+    h.type = first ? FrameType::Headers : FrameType::Continuation;
+    h.flags = last ? FRAME_FLAG::END_HEADERS : FRAME_FLAG::NONE;
+    if (first && end_stream) {
+      h.flags |= FRAME_FLAG::END_STREAM;
+    }
+    h.stream_id = stream_id;
+    if (!PushHeader(h)) {
+      Rollback(mark, mark_offset);
+      return FRAME_ERR::OUT_OF_MEMORY;
+    }
+    if (len > 0) {
+      PushPayload(block.data() + pos, len);
+    }
+    pos += len;
+    first = false;
+  } while (pos < block.size());
+
+  return FRAME_ERR::NONE;
+}
+
+FrameErrorCode FrameWriter::WriteFrame(
+    const FrameHeader& header, absl::Span<const uint8_t> payload) noexcept {
+  if (payload.size() > max_frame_size_) {
+    return FRAME_ERR::FRAME_TOO_LARGE;
+  }
+  try {
+    segments_.reserve(segments_.size() + 2);
+    owners_.reserve(owners_.size() + 2);
+  } catch (...) {
+    return FRAME_ERR::OUT_OF_MEMORY;
+  }
+  FrameHeader h = header;
+  h.length = static_cast<uint32_t>(payload.size());
+  if (!PushHeader(h)) {
+    return FRAME_ERR::OUT_OF_MEMORY;
+  }
+  if (!payload.empty()) {
+    PushPayload(payload.data(), payload.size());
+  }
+  return FRAME_ERR::NONE;
+}
+
+FrameErrorCode FrameWriter::WriteControl(
+    FrameType type, uint8_t flags, uint32_t stream_id,
+    absl::Span<const uint8_t> payload) noexcept {
+  if (payload.size() > HeaderArena::kInlinePayload) {
+    return FRAME_ERR::FRAME_TOO_LARGE;
+  }
+  FrameHeader h;
+  h.length = static_cast<uint32_t>(payload.size());
+  h.type = type;
+  h.flags = flags;
+  h.stream_id = stream_id;
+  uint8_t* slot = PushHeader(h);
+  if (!slot) {
+    return FRAME_ERR::OUT_OF_MEMORY;
+  }
+  if (!payload.empty()) {
+    std::memcpy(slot + kFrameHeaderSize, payload.data(), payload.size());
+    segments_.back().iov_len += payload.size();
+    queued_offset_ += payload.size();
+  }
+  return FRAME_ERR::NONE;
+}
+
+FrameErrorCode FrameWriter::Flush(FrameSink& sink) noexcept {
+  while (head_ < segments_.size()) {
+    const int count = static_cast<int>(
+        std::min<std::size_t>(segments_.size() - head_, kIovMax));
+    std::size_t offered = 0;
+    for (int i = 0; i < count; ++i) {
+      offered += segments_[head_ + i].iov_len;
+    }
+
+    const int64_t n = sink.Writev(&segments_[head_], count);
+    sink_calls_++;
+    if (n < 0) {
+      return FRAME_ERR::TRANSPORT_ERROR;
+    }
+    if (n == 0) {
+      return FRAME_ERR::WOULD_BLOCK;
+    }
+
+    std::size_t written = static_cast<std::size_t>(n);
+    flushed_offset_ += written;
+    while (written > 0) {
+      struct iovec& seg = segments_[head_];
+      if (written >= seg.iov_len) {
+        written -= seg.iov_len;
+        arena_.Release(owners_[head_]);
+        head_++;
+      } else {
+        seg.iov_base = static_cast<uint8_t*>(seg.iov_base) + written;
+        seg.iov_len -= written;
+        written = 0;
+      }
+    }
+    // retire zero-length segments left at the head
+    while (head_ < segments_.size() && segments_[head_].iov_len == 0) {
+      arena_.Release(owners_[head_]);
+      head_++;
+    }
+
+    if (static_cast<std::size_t>(n) < offered) {
+      Compact();
+      return FRAME_ERR::WOULD_BLOCK;
+    }
+  }
+  Compact();
+  return FRAME_ERR::NONE;
+}
+
+void FrameWriter::Rollback(std::size_t mark, uint64_t mark_offset) noexcept {
+  // unwind a partially queued frame sequence so the stream stays whole
+  for (std::size_t i = mark; i < segments_.size(); ++i) {
+    arena_.Release(owners_[i]);
+  }
+  segments_.resize(mark);
+  owners_.resize(mark);
+  queued_offset_ = mark_offset;
+}
+
+void FrameWriter::Compact() noexcept {
+  if (head_ == segments_.size()) {
+    segments_.clear();
+    owners_.clear();
+    head_ = 0;
+    return;
+  }
+  // only pay for the move once the consumed prefix dominates
+  if (head_ > 64 && head_ * 2 > segments_.size()) {
+    segments_.erase(segments_.begin(), segments_.begin() + head_);
+    owners_.erase(owners_.begin(), owners_.begin() + head_);
+    head_ = 0;
+  }
+}
+
+void FrameWriter::Clear() noexcept {
+  for (std::size_t i = head_; i < owners_.size(); ++i) {
+    arena_.Release(owners_[i]);
+  }
+  segments_.clear();
+  owners_.clear();
+  head_ = 0;
+  flushed_offset_ = queued_offset_;
+}
+
+}  // namespace frame
+}  // namespace h2v
@@ -0,0 +1,138 @@
+// src/h2v/frame/outbound_queue.cc
+#include "h2v/frame/outbound_queue.h"
+
+namespace h2v {
+namespace frame {
+
+OutboundQueue::OutboundQueue() noexcept : tail_(&stub_), head_(&stub_) {}
+
+OutboundQueue::~OutboundQueue() {
+  Abort();
+}
+
+OutboundFrame* OutboundQueue::Pop() noexcept {
+  OutboundFrame* head = head_;
+  OutboundFrame* next = head->next_.load(std::memory_order_acquire);
+  if (head == &stub_) {
+    if (!next) {
+      return nullptr;
+    }
+    head_ = next;
+    head = next;
+    next = next->next_.load(std::memory_order_acquire);
+  }
+  if (next) {
+    head_ = next;
+    return head;
+  }
+  if (head != tail_.load(std::memory_order_seq_cst)) {
+    // a producer swapped the tail but has not linked its node yet; it
+    // reads the wakeup flag behind a fence after linking, so it sees the
+    // flag Drain() cleared and wakes us
+    return nullptr;
+  }
+  // `head` is the last node: park the stub behind it so it can be taken
+  stub_.next_.store(nullptr, std::memory_order_relaxed);
+  OutboundFrame* prev = tail_.exchange(&stub_, std::memory_order_seq_cst);
+  prev->next_.store(&stub_, std::memory_order_release);
+  next = head->next_.load(std::memory_order_acquire);
+  if (next) {
+    head_ = next;
+    return head;
+  }
+  return nullptr;
+}
+
+void OutboundQueue::Track(OutboundFrame* frame, uint64_t done_offset) noexcept {
+  frame->done_offset_ = done_offset;
+  frame->inflight_next_ = nullptr;
+  if (inflight_tail_) {
+    inflight_tail_->inflight_next_ = frame;
+  } else {
+    inflight_head_ = frame;
+  }
+  inflight_tail_ = frame;
+  inflight_count_++;
+}
+
+FrameErrorCode OutboundQueue::DrainInto(FrameWriter& writer,
+                                        std::size_t max_frames) noexcept {
+  FrameErrorCode rc = FRAME_ERR::NONE;
+  Drain(
+      [&](OutboundFrame* f) {
+        if (rc != FRAME_ERR::NONE) {
+          // an earlier frame failed: later ones must not overtake it
+          if (f->on_done) {
+            f->on_done(f, false);
+          }
+          return;
+        }
+        switch (f->kind) {
+          case OutboundFrame::Kind::Data:
+            rc = writer.WriteData(f->stream_id, f->payload, f->end_stream);
+            break;
+          case OutboundFrame::Kind::Headers:
+            rc = writer.WriteHeaders(f->stream_id, f->payload, f->end_stream);
+            break;
+          case OutboundFrame::Kind::Frame: {
+            FrameHeader h;
+            h.type = f->type;
+            h.flags = f->flags;
+            h.stream_id = f->stream_id;
+            rc = writer.WriteFrame(h, f->payload);
+            break;
+          }
+          case OutboundFrame::Kind::Control:
+            rc = writer.WriteControl(f->type, f->flags, f->stream_id,
+                                     f->payload);
+            break;
+        }
+        if (rc != FRAME_ERR::NONE) {
+          if (f->on_done) {
+            f->on_done(f, false);
+          }
+          return;
+        }
+        Track(f, writer.QueuedOffset());
+      },
+      max_frames);
+  return rc;
+}
+
+std::size_t OutboundQueue::Reap(const FrameWriter& writer) noexcept {
+  const uint64_t flushed = writer.FlushedOffset();
+  std::size_t n = 0;
+  while (inflight_head_ && inflight_head_->done_offset_ <= flushed) {
+    OutboundFrame* f = inflight_head_;
+    inflight_head_ = f->inflight_next_;
+    if (!inflight_head_) {
+      inflight_tail_ = nullptr;
+    }
+    inflight_count_--;
+    n++;
+    if (f->on_done) {
+      f->on_done(f, true);
+    }
+  }
+  return n;
+}
+
+void OutboundQueue::Abort() noexcept {
+  while (inflight_head_) {
+    OutboundFrame* f = inflight_head_;
+    inflight_head_ = f->inflight_next_;
+    if (f->on_done) {
+      f->on_done(f, false);
+    }
+  }
+  inflight_tail_ = nullptr;
+  inflight_count_ = 0;
+  Drain([](OutboundFrame* f) {
+    if (f->on_done) {
+      f->on_done(f, false);
+    }
+  });
+}
+
+}  // namespace frame
+}  // namespace h2v
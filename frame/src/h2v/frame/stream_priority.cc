@@ -0,0 +1,152 @@
+// src/h2v/frame/stream_priority.cc
+#include "h2v/frame/stream_priority.h"
+
+namespace h2v {
+namespace frame {
+
+namespace {
+
+bool IsLcAlpha(char c) noexcept {
+  return c >= 'a' && c <= 'z';
+}
+
+bool IsDigit(char c) noexcept {
+  return c >= '0' && c <= '9';
+}
+
+bool IsKeyChar(char c) noexcept {
+  return IsLcAlpha(c) || IsDigit(c) || c == '_' || c == '-' || c == '.' ||
+         c == '*';
+}
+
+void SkipOws(absl::string_view s, std::size_t& i) noexcept {
+  while (i < s.size() && (s[i] == ' ' || s[i] == '\t')) {
+    i++;
+  }
+}
+
+/// @brief Skip a bare item we do not interpret; only the shapes a priority
+///   field can reasonably carry are accepted (RFC 8941 §3.3).
+bool SkipBareItem(absl::string_view s, std::size_t& i) noexcept {
+  if (i >= s.size()) {
+    return false;
+  }
+  const char c = s[i];
+  if (c == '"') {
+    for (i++; i < s.size(); i++) {
+      if (s[i] == '\\') {
+        i++;
+      } else if (s[i] == '"') {
+        i++;
+        return true;
+      }
+    }
+    return false;
+  }
+  if (c == '?') {
+    if (i + 1 >= s.size() || (s[i + 1] != '0' && s[i + 1] != '1')) {
+      return false;
+    }
+    i += 2;
+    return true;
+  }
+  const std::size_t start = i;
+  while (i < s.size() && s[i] != ',' && s[i] != ';' && s[i] != ' ' &&
+         s[i] != '\t') {
+    i++;
+  }
+  return i > start;
+}
+
+/// @brief Skip `;key[=item]` parameters attached to a member.
+bool SkipParameters(absl::string_view s, std::size_t& i) noexcept {
+  while (i < s.size() && s[i] == ';') {
+    i++;
+    SkipOws(s, i);
+    const std::size_t start = i;
+    while (i < s.size() && IsKeyChar(s[i])) {
+      i++;
+    }
+    if (i == start) {
+      return false;
+    }
+    if (i < s.size() && s[i] == '=') {
+      i++;
+      if (!SkipBareItem(s, i)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+bool ParsePriorityField(absl::string_view s, StreamPriority& out) noexcept {
+  StreamPriority p = out;
+  std::size_t i = 0;
+  SkipOws(s, i);
+  while (i < s.size()) {
+    // key
+    if (!IsLcAlpha(s[i]) && s[i] != '*') {
+      return false;
+    }
+    const std::size_t key_start = i;
+    while (i < s.size() && IsKeyChar(s[i])) {
+      i++;
+    }
+    const absl::string_view key = s.substr(key_start, i - key_start);
+
+    // value: a bare key means boolean true
+    if (i < s.size() && s[i] == '=') {
+      i++;
+      if (key == "u" && i < s.size() && IsDigit(s[i])) {
+        // 15 digits fit a uint64_t: out-of-range values are ignored, not
+        // wrapped into range
+        uint64_t v = 0;
+        std::size_t digits = 0;
+        while (i < s.size() && IsDigit(s[i]) && digits < 15) {
+          v = v * 10 + uint64_t(s[i] - '0');
+          i++;
+          digits++;
+        }
+        if (i < s.size() && IsDigit(s[i])) {
+          return false;  // sf-integer has at most 15 digits
+        }
+        if (v <= kMaxUrgency) {
+          p.urgency = uint8_t(v);
+        }
+      } else if (key == "i" && i + 1 < s.size() && s[i] == '?' &&
+                 (s[i + 1] == '0' || s[i + 1] == '1')) {
+        p.incremental = s[i + 1] == '1';
+        i += 2;
+      } else if (!SkipBareItem(s, i)) {
+        return false;
+      }
+    } else if (key == "i") {
+      p.incremental = true;
+    }
+    if (!SkipParameters(s, i)) {
+      return false;
+    }
+
+    // separator
+    SkipOws(s, i);
+    if (i == s.size()) {
+      break;
+    }
+    if (s[i] != ',') {
+      return false;
+    }
+    i++;
+    SkipOws(s, i);
+    if (i == s.size()) {
+      return false;  // trailing comma
+    }
+  }
+  out = p;
+  return true;
+}
+
+}  // namespace frame
+}  // namespace h2v
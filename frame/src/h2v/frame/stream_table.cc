@@ -0,0 +1,170 @@
+// src/h2v/frame/stream_table.cc
+#include "h2v/frame/stream_table.h"
+
+#include <new>
+
+namespace h2v {
+namespace frame {
+
+namespace {
+
+std::size_t RoundUpPow2(std::size_t n) noexcept {
+  std::size_t p = 1;
+  while (p < n) {
+    p <<= 1;
+  }
+  return p;
+}
+
+}  // namespace
+
+StreamTable::StreamTable(bool is_server, std::size_t initial_window) noexcept
+                : is_server_(is_server) {
+  const std::size_t n = RoundUpPow2(initial_window < 2 ? 2 : initial_window);
+  try {
+    window_.assign(n, nullptr);
+    active_.reserve(n / 2);
+  } catch (...) {
+    window_.clear();
+  }
+  if (window_.empty()) {
+    // degrade to the overflow map only; Find() still works
+    window_.resize(1, nullptr);
+  }
+  window_mask_ = window_.size() - 1;
+}
+
+StreamTable::~StreamTable() = default;
+
+Stream* StreamTable::FindOverflow(uint32_t id) noexcept {
+  auto it = overflow_.find(id);
+  return it == overflow_.end() ? nullptr : it->second;
+}
+
+Stream* StreamTable::AllocStream() noexcept {
+  if (!free_) {
+    Stream* chunk = new (std::nothrow) Stream[kChunkSize];
+    if (!chunk) {
+      return nullptr;
+    }
+    try {
+      chunks_.emplace_back(chunk);
+    } catch (...) {
+      delete[] chunk;
+      return nullptr;
+    }
+    for (std::size_t i = kChunkSize; i-- > 0;) {
+      chunk[i].next_free_ = free_;
+      free_ = &chunk[i];
+    }
+  }
+  Stream* s = free_;
+  free_ = s->next_free_;
+  *s = Stream{};
+  return s;
+}
+
+void StreamTable::IndexInsert(Stream* s) {
+  Stream*& slot = window_[(s->id >> 1) & window_mask_];
+  if (slot && slot != s) {
+    // an older stream still owns this slot: park it in the overflow map
+    overflow_.emplace(slot->id, slot);
+  }
+  slot = s;
+}
+
+bool StreamTable::GrowWindow() noexcept {
+  std::vector<Stream*> bigger;
+  absl::flat_hash_map<uint32_t, Stream*> overflow;
+  try {
+    bigger.assign(window_.size() * 2, nullptr);
+    // pre-size the overflow map so re-indexing below cannot throw
+    overflow.reserve(active_.size());
+  } catch (...) {
+    return false;
+  }
+  window_.swap(bigger);
+  window_mask_ = window_.size() - 1;
+  overflow_.swap(overflow);
+  for (Stream* s : active_) {
+    IndexInsert(s);
+  }
+  return true;
+}
+
+FrameErrorCode StreamTable::Open(uint32_t id, Stream*& out) noexcept {
+  out = nullptr;
+  if (id == 0 || (id & ~0x7FFFFFFFu) != 0) {
+    return FRAME_ERR::INVALID_STREAM_ID;
+  }
+  const bool peer = IsPeerInitiated(id);
+  if (id <= (peer ? last_peer_id_ : last_local_id_)) {
+    return FRAME_ERR::INVALID_STREAM_ID;
+  }
+
+  // keep the window at most half full so monotonic ids rarely collide
+  if ((active_.size() + 1) * 2 > window_.size()) {
+    GrowWindow();
+  }
+
+  Stream* s = AllocStream();
+  if (!s) {
+    return FRAME_ERR::OUT_OF_MEMORY;
+  }
+  s->id = id;
+  s->send_window = initial_send_window_;
+  s->recv_window = initial_recv_window_;
+  s->recv_window_size_ = initial_recv_window_;
+  try {
+    active_.push_back(s);
+  } catch (...) {
+    s->next_free_ = free_;
+    free_ = s;
+    return FRAME_ERR::OUT_OF_MEMORY;
+  }
+  s->active_pos_ = static_cast<uint32_t>(active_.size() - 1);
+  try {
+    IndexInsert(s);
+  } catch (...) {
+    active_.pop_back();
+    s->next_free_ = free_;
+    free_ = s;
+    return FRAME_ERR::OUT_OF_MEMORY;
+  }
+
+  if (peer) {
+    last_peer_id_ = id;
+  } else {
+    last_local_id_ = id;
+  }
+  out = s;
+  return FRAME_ERR::NONE;
+}
+
+void StreamTable::Close(Stream* stream) noexcept {
+  if (!stream || stream->id == 0) {
+    return;
+  }
+
+  Stream*& slot = window_[(stream->id >> 1) & window_mask_];
+  if (slot == stream) {
+    slot = nullptr;
+  } else {
+    overflow_.erase(stream->id);
+  }
+
+  // O(1) swap-removal from the dense active array
+  const uint32_t pos = stream->active_pos_;
+  Stream* last = active_.back();
+  active_[pos] = last;
+  last->active_pos_ = pos;
+  active_.pop_back();
+
+  stream->id = 0;
+  stream->user_data = nullptr;
+  stream->next_free_ = free_;
+  free_ = stream;
+}
+
+}  // namespace frame
+}  // namespace h2v
@@ -0,0 +1,179 @@
+// src/h2v/frame/write_scheduler.cc
+#include "h2v/frame/write_scheduler.h"
+
+#include <algorithm>
+
+namespace h2v {
+namespace frame {
+
+WriteScheduler::WriteScheduler(int64_t connection_window) noexcept
+                : connection_window_(connection_window) {}
+
+void WriteScheduler::Link(Stream* s) noexcept {
+  const int8_t b = BucketOf(s->priority);
+  s->sched_bucket_ = b;
+  s->sched_next_ = nullptr;
+  s->sched_prev_ = tail_[b];
+  if (tail_[b]) {
+    tail_[b]->sched_next_ = s;
+  } else {
+    head_[b] = s;
+  }
+  tail_[b] = s;
+  mask_ |= uint16_t(1u << b);
+}
+
+void WriteScheduler::Unlink(Stream* s) noexcept {
+  const int8_t b = s->sched_bucket_;
+  if (b < 0) {
+    return;
+  }
+  if (s->sched_prev_) {
+    s->sched_prev_->sched_next_ = s->sched_next_;
+  } else {
+    head_[b] = s->sched_next_;
+  }
+  if (s->sched_next_) {
+    s->sched_next_->sched_prev_ = s->sched_prev_;
+  } else {
+    tail_[b] = s->sched_prev_;
+  }
+  if (!head_[b]) {
+    mask_ &= uint16_t(~(1u << b));
+  }
+  s->sched_prev_ = s->sched_next_ = nullptr;
+  s->sched_bucket_ = -1;
+}
+
+void WriteScheduler::Wake(Stream* s) noexcept {
+  if (s->sched_bucket_ >= 0) {
+    return;
+  }
+  // a bare END_STREAM needs no window
+  if (s->sched_pending_ > 0 ? s->send_window > 0 : s->sched_fin_) {
+    Link(s);
+  }
+}
+
+void WriteScheduler::Push(Stream* stream, uint64_t bytes,
+                          bool end_stream) noexcept {
+  stream->sched_pending_ += bytes;
+  stream->sched_fin_ = stream->sched_fin_ || end_stream;
+  Wake(stream);
+}
+
+bool WriteScheduler::Next(uint32_t max_frame_size, WriteGrant& out) noexcept {
+  while (mask_ != 0) {
+    const int b = __builtin_ctz(mask_);
+    Stream* s = head_[b];
+
+    uint64_t allowed = 0;
+    if (s->sched_pending_ > 0) {
+      if (s->send_window <= 0) {
+        // window shrank (SETTINGS) while queued: park until WINDOW_UPDATE
+        Unlink(s);
+        continue;
+      }
+      if (connection_window_ <= 0) {
+        return false;
+      }
+      allowed = std::min<uint64_t>({s->sched_pending_, max_frame_size,
+                                    uint64_t(s->send_window),
+                                    uint64_t(connection_window_)});
+    }
+
+    s->sched_pending_ -= allowed;
+    s->send_window -= int64_t(allowed);
+    connection_window_ -= int64_t(allowed);
+
+    out.stream = s;
+    out.bytes = uint32_t(allowed);
+    out.end_stream = s->sched_pending_ == 0 && s->sched_fin_;
+
+    if (s->sched_pending_ == 0) {
+      s->sched_fin_ = false;
+      Unlink(s);
+    } else if (s->send_window <= 0) {
+      Unlink(s);  // blocked on its own window
+    } else if (s->priority.incremental && s->sched_next_) {
+      // round-robin within the urgency level
+      Unlink(s);
+      Link(s);
+    }
+    return true;
+  }
+  return false;
+}
+
+void WriteScheduler::SetPriority(Stream* stream,
+                                 StreamPriority priority) noexcept {
+  if (priority.urgency > kMaxUrgency) {
+    priority.urgency = kMaxUrgency;
+  }
+  const bool queued = stream->sched_bucket_ >= 0;
+  if (queued && BucketOf(priority) == stream->sched_bucket_) {
+    stream->priority = priority;
+    return;
+  }
+  Unlink(stream);
+  stream->priority = priority;
+  if (queued) {
+    Link(stream);
+  }
+}
+
+void WriteScheduler::OnPriorityUpdate(StreamTable& streams, uint32_t stream_id,
+                                      absl::string_view field) noexcept {
+  Stream* s = streams.Find(stream_id);
+  if (!s) {
+    return;
+  }
+  StreamPriority p = s->priority;
+  if (ParsePriorityField(field, p)) {
+    SetPriority(s, p);
+  }
+}
+
+FrameErrorCode WriteScheduler::OnWindowUpdate(Stream* stream,
+                                              uint32_t increment) noexcept {
+  if (stream->send_window + int64_t(increment) > kMaxWindowSize) {
+    return FRAME_ERR::FLOW_CONTROL_ERROR;
+  }
+  stream->send_window += increment;
+  Wake(stream);
+  return FRAME_ERR::NONE;
+}
+
+FrameErrorCode WriteScheduler::OnConnectionWindowUpdate(
+    uint32_t increment) noexcept {
+  if (connection_window_ + int64_t(increment) > kMaxWindowSize) {
+    return FRAME_ERR::FLOW_CONTROL_ERROR;
+  }
+  connection_window_ += increment;
+  return FRAME_ERR::NONE;
+}
+
+FrameErrorCode WriteScheduler::OnInitialWindowSizeChange(
+    StreamTable& streams, int64_t delta) noexcept {
+  FrameErrorCode rc = FRAME_ERR::NONE;
+  for (Stream* s : streams.Active()) {
+    if (s->send_window + delta > kMaxWindowSize) {
+      rc = FRAME_ERR::FLOW_CONTROL_ERROR;
+      continue;
+    }
+    s->send_window += delta;
+    if (delta > 0) {
+      Wake(s);
+    }
+  }
+  return rc;
+}
+
+void WriteScheduler::Remove(Stream* stream) noexcept {
+  Unlink(stream);
+  stream->sched_pending_ = 0;
+  stream->sched_fin_ = false;
+}
+
+}  // namespace frame
+}  // namespace h2v
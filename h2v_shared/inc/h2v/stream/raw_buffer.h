@@ -144,6 +144,14 @@ class RawBuffer {
     size_ = 0;
   }
 
+  /// Drop the bytes past the first `n` (a no-op if there are fewer);
+  /// capacity is retained.
+  void truncate(std::size_t n) noexcept {
+    if (n < size_) {
+      size_ = n;
+    }
+  }
+
   /// Release all memory.
   void reset() noexcept {
     clear_storage();
@@ -0,0 +1,104 @@
+// include/h2v/hpack/admission_policy.h
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "absl/strings/string_view.h"
+#include "h2v/hpack/header_id.h"
+
+namespace h2v {
+namespace hpack {
+
+/// @brief A literal the encoder could insert into the dynamic table.
+struct AdmissionCandidate {
+  HeaderId id = HeaderId::Unknown;
+  absl::string_view name;
+  absl::string_view value;
+  uint64_t field_hash = 0;  ///< of (name, value)
+  uint64_t name_hash = 0;
+  /// Inserting it evicts at least the oldest entry, `victim_hash`.
+  bool evicts = false;
+  uint64_t victim_hash = 0;
+};
+
+/// @brief Decides which literals the Encoder indexes.
+/// @details Record() sees every field the encoder is given, indexed or not;
+///   Admit() is asked only for fields the tables do not hold yet and that
+///   may legally be indexed. Implementations run on the connection's I/O
+///   thread and must not allocate on these calls.
+class AdmissionPolicy {
+ public:
+  virtual ~AdmissionPolicy() = default;
+  virtual void Record(uint64_t field_hash, uint64_t name_hash,
+                      uint64_t value_hash) noexcept = 0;
+  virtual bool Admit(const AdmissionCandidate& candidate) noexcept = 0;
+};
+
+/// @brief Index every literal that fits (the classic HPACK encoder).
+class AdmitAll final : public AdmissionPolicy {
+ public:
+  void Record(uint64_t, uint64_t, uint64_t) noexcept override {}
+  bool Admit(const AdmissionCandidate&) noexcept override {
+    return true;
+  }
+};
+
+/// @brief TinyLFU-style admission: the Encoder's default policy.
+/// @details
+///   - Frequencies of (name, value) pairs live in a 4-row count-min sketch
+///     of saturating 4-bit counters, halved every 10 × width records so
+///     the estimate follows the recent traffic mix.
+///   - While the table has room every candidate is admitted; once an
+///     insertion would evict, the candidate must be seen more often than
+///     the entry it pushes out, so one-off values stop flushing entries
+///     that are reused on every request.
+///   - Per-name value cardinality is tracked in small linear-counting
+///     bitmaps over 32-record windows. Names whose values are mostly
+///     distinct (`:path`, `date`, request ids, ...) are never admitted, and
+///     fields that change on every message (content-length, etag, ...)
+///     are rejected up front.
+///
+///   Fixed footprint (~6 KiB), no allocation. Not thread-safe: owned by
+///   the encoder.
+class TinyLfuAdmission final : public AdmissionPolicy {
+ public:
+  void Record(uint64_t field_hash, uint64_t name_hash,
+              uint64_t value_hash) noexcept override;
+  bool Admit(const AdmissionCandidate& candidate) noexcept override;
+
+  /// @brief Estimated recent frequency of a (name, value) hash, 0..15.
+  uint32_t Frequency(uint64_t field_hash) const noexcept;
+  /// @brief The name's recent values are mostly distinct.
+  bool HighCardinality(uint64_t name_hash) const noexcept;
+
+ private:
+  static constexpr int kDepth = 4;
+  static constexpr int kWidthBits = 10;
+  static constexpr std::size_t kWidth = std::size_t(1) << kWidthBits;
+  static constexpr uint32_t kResetAfter = 10 * kWidth;
+  static constexpr std::size_t kNameSlots = 128;
+  static constexpr uint32_t kWindow = 32;
+
+  struct NameSlot {
+    uint64_t name_hash = 0;
+    uint64_t bitmap = 0;   ///< one bit per value hash, current window
+    uint32_t seen = 0;     ///< records in the current window
+    bool high = false;     ///< verdict of the last full window
+    bool judged = false;   ///< a full window was observed
+  };
+
+  /// counters of one row are packed two per byte
+  std::array<std::array<uint8_t, kWidth / 2>, kDepth> sketch_{};
+  uint32_t records_ = 0;
+  std::array<NameSlot, kNameSlots> names_{};
+
+  static std::size_t Cell(uint64_t hash, int row) noexcept;
+  uint32_t Counter(int row, std::size_t cell) const noexcept;
+  void Age() noexcept;
+  static bool MostlyDistinct(const NameSlot& slot) noexcept;
+};
+
+}  // namespace hpack
+}  // namespace h2v
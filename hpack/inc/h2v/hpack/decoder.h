@@ -0,0 +1,239 @@
+// include/h2v/hpack/decoder.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+#include "h2v/hpack/dynamic_table.h"
+#include "h2v/hpack/entry_type.h"
+#include "h2v/hpack/error_code.h"
+#include "h2v/hpack/header_id.h"
+#include "h2v/hpack/hpack_config.h"
+#include "h2v/hpack/hpack_stats.h"
+#include "h2v/stream/raw_buffer.h"
+
+namespace h2v {
+namespace hpack {
+
+/// @brief One decoded header field.
+/// @details `name` and `value` view decoder- or table-owned bytes and are
+///   only valid during HeaderHandler::OnHeader(). Dynamic table hits view
+///   the entry itself, with no copy or reference count; pinning the table
+///   (DynamicTable::Pin()) from OnHeader() keeps those views valid until
+///   the matching Unpin().
+struct DecodedHeader {
+  absl::string_view name;
+  absl::string_view value;
+  /// Representation the field arrived in.
+  EntryType type = EntryType::IndexedHeader;
+  /// Table index the name (or the whole field) came from; 0 for a literal
+  /// name.
+  uint32_t index = 0;
+  /// Well-known name id; free for table hits, one hash probe for literal
+  /// names.
+  HeaderId id = HeaderId::Unknown;
+  /// Name and value octets as they were on the wire, Huffman-coded when
+  /// the matching flag is set, so a Transcoder can forward them without
+  /// re-encoding. Set for literals and dynamic table hits (`has_wire`);
+  /// static table hits and joined cookies only carry the decoded form.
+  absl::string_view wire_name;
+  absl::string_view wire_value;
+  bool wire_name_huffman = false;
+  bool wire_value_huffman = false;
+  bool has_wire = false;
+  /// FieldHash() of `name` and `value`, for interning or routing without
+  /// another pass. Set (`has_hash`) for dynamic table hits and for literals
+  /// indexed into it, whose Huffman strings were hashed while decoded.
+  uint64_t name_hash = 0;
+  uint64_t value_hash = 0;
+  bool has_hash = false;
+  /// The value's dynamic table entry interned it in
+  /// HpackConfig::value_pool: copy this reference to keep the value past
+  /// OnHeader() without copying its bytes. nullptr otherwise.
+  const PooledString* pooled_value = nullptr;
+};
+
+class RequestPseudoHeaders;
+
+/// @brief Receives the fields of a header block as they are decoded.
+class HeaderHandler {
+ public:
+  virtual ~HeaderHandler() = default;
+  virtual void OnHeader(const DecodedHeader& header) = 0;
+};
+
+/// @brief Streaming HPACK decoder (RFC 7541), one per connection.
+/// @details Header block fragments (HEADERS / CONTINUATION payloads) are fed
+///   as they arrive; every complete representation is decoded immediately,
+///   only an incomplete tail is carried to the next fragment.
+///
+///   The header list size (decoded name + value + 32 per field, RFC 9113
+///   §6.5.2) is counted as the block is decoded and checked against
+///   `max_header_list_size_bytes` before any string is buffered, using a
+///   lower bound of its decoded length. Once the limit is crossed the
+///   decoder stops emitting and copying fields and only keeps the dynamic
+///   table in sync: strings that cannot reach the table are skipped in
+///   place, across fragments, without being buffered. Memory held for an
+///   in-progress block is therefore bounded by the limit (or by the table
+///   size once over it), however many CONTINUATION frames the peer sends.
+///
+///   With `validate_fields`, every literal name and value is checked
+///   against RFC 9113 §8.2.1. Huffman strings get their character classes
+///   from the decode table itself, raw ones from one table lookup per
+///   octet; the verdict is stored with a new dynamic table entry, so
+///   indexed references are never rescanned. The first violation makes the
+///   rest of the block suppressed, as a malformed pseudo-header does.
+///
+///   With `join_cookies`, cookie crumbs are held until END_HEADERS and
+///   emitted as one `cookie` field joined with "; ". Crumbs that are
+///   dynamic table entries are referenced, not copied; the joined value is
+///   built in one allocation of exactly its size, and a lone crumb is
+///   emitted in place.
+///
+///   Not thread-safe: owned by the connection's I/O thread.
+class Decoder {
+ public:
+  explicit Decoder(const HpackConfig& config = {}) noexcept;
+
+  /// @brief Decode one fragment of the current header block.
+  /// @param end_of_block  the fragment carried END_HEADERS.
+  /// @return NONE; DECODE_HEADER_LIST_TOO_LARGE at the end of a block that
+  ///   crossed the limit, or DECODE_MALFORMED_FIELD at the end of a block
+  ///   holding a field that fails `validate_fields` (stream errors, the
+  ///   decoder stays usable; Violation() tells which rule); any other code
+  ///   is a COMPRESSION_ERROR and the decoder stays failed.
+  HpackErrorCode Decode(absl::Span<const uint8_t> fragment, bool end_of_block,
+                        HeaderHandler& handler) noexcept;
+
+  /// @brief Decode a request header block, extracting its pseudo-header
+  ///   section into `pseudo` (cleared when the block starts) instead of
+  ///   emitting it; only regular fields reach `handler`. Pass the same
+  ///   `pseudo` for every fragment of the block.
+  /// @return as above, plus DECODE_MALFORMED_REQUEST at the end of a block
+  ///   whose pseudo-headers break RFC 9113 §8.3.1 (a stream error: from the
+  ///   offending field on, nothing more is emitted and the decoder only
+  ///   keeps the dynamic table in sync).
+  HpackErrorCode Decode(absl::Span<const uint8_t> fragment, bool end_of_block,
+                        HeaderHandler& handler,
+                        RequestPseudoHeaders& pseudo) noexcept;
+
+  /// @brief Our SETTINGS_HEADER_TABLE_SIZE, once acknowledged by the peer;
+  ///   the ceiling for dynamic table size updates.
+  void SetMaxTableSizeLimit(std::size_t bytes) noexcept {
+    max_table_size_limit_ = bytes;
+  }
+  /// @brief First field rule broken by the current or last block.
+  FieldViolation Violation() const noexcept {
+    return violation_;
+  }
+  void SetMaxHeaderListSize(std::size_t bytes) noexcept {
+    config_.max_header_list_size_bytes = bytes;
+  }
+
+  /// @brief True between the first fragment of a block and END_HEADERS.
+  bool InBlock() const noexcept {
+    return in_block_;
+  }
+  /// @brief Header list size of the block so far.
+  std::size_t HeaderListSize() const noexcept {
+    return list_size_;
+  }
+  /// @brief The current block crossed max_header_list_size_bytes.
+  bool ListTooLarge() const noexcept {
+    return overflow_;
+  }
+  /// @brief The current request block has malformed pseudo-headers.
+  bool MalformedRequest() const noexcept {
+    return malformed_;
+  }
+  bool Failed() const noexcept {
+    return failed_;
+  }
+  /// @brief Bytes held for the in-progress block (carried partial field).
+  std::size_t BufferedBytes() const noexcept {
+    return carry_.size();
+  }
+
+  DynamicTable& Table() noexcept {
+    return table_;
+  }
+  void SnapshotStats(HpackStats& out) const noexcept;
+
+ private:
+  HpackConfig config_;
+  DynamicTable table_;
+  std::size_t max_table_size_limit_;
+
+  stream::RawBuffer<> carry_;    ///< incomplete representation
+  stream::RawBuffer<> scratch_;  ///< Huffman output of the current field
+
+  /// @brief A cookie crumb held until the end of the block: a dynamic
+  ///   table entry `owner` (readable under pin_), or `length` bytes of
+  ///   crumb_bytes_.
+  struct Crumb {
+    const DynamicTable::Entry* owner = nullptr;
+    uint32_t offset = 0;
+    uint32_t length = 0;
+  };
+  std::vector<Crumb> crumbs_;
+  stream::RawBuffer<> crumb_bytes_;  ///< literal crumbs
+  stream::RawBuffer<> cookie_;       ///< joined cookie
+
+  bool failed_ = false;
+  bool in_block_ = false;
+  bool overflow_ = false;
+  bool malformed_ = false;
+  FieldViolation violation_ = FieldViolation::None;
+  bool size_update_allowed_ = true;
+  RequestPseudoHeaders* pseudo_ = nullptr;  ///< request block in progress
+  /// Table epoch pinned from the first fragment of a block to its end, so
+  /// entries the block references survive its own evictions.
+  uint64_t pin_ = 0;
+  std::size_t list_size_ = 0;
+
+  // skipping a string that straddles fragments (only once over the limit)
+  uint64_t skip_remaining_ = 0;
+  bool skip_value_pending_ = false;
+
+  uint64_t decoded_headers_ = 0;
+  uint64_t decoded_bytes_ = 0;
+
+  /// @brief Decode one representation from `in`.
+  /// @return NONE with `used` set, INTEGER_DECODE_TRUNCATED if more input
+  ///   is needed, or an error.
+  HpackErrorCode DecodeOne(const uint8_t* in, std::size_t in_size,
+                           std::size_t& used, HeaderHandler& handler) noexcept;
+  HpackErrorCode DecodeLiteral(const uint8_t* in, std::size_t in_size,
+                               std::size_t& used,
+                               HeaderHandler& handler) noexcept;
+  /// @brief Record the first violation; the block is malformed from here.
+  void Reject(FieldViolation violation) noexcept;
+  HpackErrorCode SkipString(const uint8_t* in, std::size_t in_size,
+                            std::size_t& used) noexcept;
+
+  /// @brief Fields are no longer emitted, only the table is kept in sync.
+  bool Suppressed() const noexcept {
+    return overflow_ || malformed_;
+  }
+  HpackErrorCode DecodeFragment(absl::Span<const uint8_t> fragment,
+                                bool end_of_block,
+                                HeaderHandler& handler) noexcept;
+  /// @brief Count a field; false once the header list limit is crossed.
+  bool Admit(std::size_t field_size) noexcept;
+  /// @param owner  dynamic table entry holding `header.value`, if any.
+  HpackErrorCode Emit(HeaderHandler& handler, const DecodedHeader& header,
+                      const DynamicTable::Entry* owner = nullptr) noexcept;
+  HpackErrorCode HoldCrumb(const DecodedHeader& header,
+                           const DynamicTable::Entry* owner) noexcept;
+  HpackErrorCode EmitCookie(HeaderHandler& handler) noexcept;
+  absl::string_view CrumbValue(const Crumb& crumb) const noexcept;
+  HpackErrorCode Fail(HpackErrorCode rc) noexcept;
+  void Unpin() noexcept;
+};
+
+}  // namespace hpack
+}  // namespace h2v
@@ -4,46 +4,140 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
+#include "absl/container/inlined_vector.h"
 #include "absl/container/node_hash_map.h"
 #include "absl/strings/string_view.h"
 #include "absl/synchronization/mutex.h"
 #include "h2v/hpack/entry_type.h"
 #include "h2v/hpack/error_tracer.h"
+#include "h2v/hpack/field_class.h"
+#include "h2v/hpack/field_hash.h"
+#include "h2v/hpack/header_id.h"
 #include "h2v/hpack/hpack_stats.h"
-#include "h2v/stream/raw_buffer.h"
+#include "h2v/hpack/memory_budget.h"
+#include "h2v/hpack/value_pool.h"
 
 namespace h2v {
 namespace hpack {
 
+/// @brief Per-entry overhead counted by the table size (RFC 7541 §4.1).
+constexpr std::size_t kEntryOverhead = 32;
+
 /// @brief Dynamic table for HPACK: wire‐exact bytes + decoded entry cache.
+/// @details Entries form a FIFO: index 62 (static size + 1) is always the
+///   newest entry, eviction drops the oldest. The table size is accounted
+///   as decoded name + value + 32 per entry, exactly as the peer computes
+///   it, so both sides evict in lock-step.
+///
+///   Nothing is allocated until the first insertion, and a size update to
+///   0 gives the ring and index storage back. With a MemoryBudget, entry
+///   sizes and ring slots are charged as they are added and released as
+///   they go; the peer decides what we hold, so charges cannot fail.
+///   With a ValuePool, values of at least its `min_bytes` are interned
+///   there rather than copied into the entry.
+///
+///   Lookups return plain pointers, with no reference count to bump per
+///   hit. An entry is freed when it is evicted, unless an epoch pinned
+///   before its eviction is still held: it is then retired and freed once
+///   every such pin is released. The Decoder pins the table for each
+///   header block, so the names and values of table hits, and the cookie
+///   crumbs it holds until END_HEADERS, are zero-copy views that stay
+///   valid until the block ends, whatever the block itself evicts. A
+///   handler that Pin()s the table during OnHeader() keeps the views it
+///   has seen readable until it calls Unpin().
 class DynamicTable {
  public:
   struct Entry {
     absl::string_view raw_name, raw_value;
     std::string decoded_name, decoded_value;
-    uint32_t index;  ///< 1-based HPACK index
+    /// The value when it is interned in the ValuePool (decoded_value is
+    /// then empty); read it through Value().
+    PooledString pooled_value;
+    /// Insertion sequence number; the current HPACK index is IndexOf().
+    uint32_t index;
     EntryType type;
+    /// Well-known name id, resolved once at insertion.
+    HeaderId id;
+    /// raw_name / raw_value are Huffman-coded.
+    bool name_huffman = false;
+    bool value_huffman = false;
+    /// Verdict of the decoder's field validation at insertion.
+    FieldViolation name_violation = FieldViolation::None;
+    FieldViolation value_violation = FieldViolation::None;
+    /// FieldHash() of decoded_name / decoded_value, computed while they
+    /// were decoded; the name lookup and eviction never rehash.
+    uint64_t name_hash = 0;
+    uint64_t value_hash = 0;
+    /// Backing bytes of raw_name + raw_value.
+    std::string raw;
+    /// Table bookkeeping while evicted but pinned: the epoch current at
+    /// eviction, and the next retired entry.
+    uint64_t retired_epoch = 0;
+    Entry* next_retired = nullptr;
+
+    absl::string_view Value() const noexcept {
+      return pooled_value ? pooled_value.view()
+                          : absl::string_view(decoded_value);
+    }
+
+    /// @brief Size charged against the table (RFC 7541 §4.1).
+    std::size_t Size() const noexcept {
+      return decoded_name.size() + Value().size() + kEntryOverhead;
+    }
   };
 
-  explicit DynamicTable(std::size_t max_bytes) noexcept;
+  explicit DynamicTable(std::size_t max_bytes,
+                        MemoryBudget* budget = nullptr,
+                        ValuePool* pool = nullptr) noexcept;
   ~DynamicTable();
 
-  /// Lookup by raw name slice.
-  std::shared_ptr<Entry> Find(absl::string_view name_slice) noexcept;
+  /// Lookup by decoded name (newest entry with that name).
+  /// @return the entry, valid until it is evicted or, if an epoch pinned
+  ///   before that is held, until every such pin is released; nullptr if
+  ///   there is none.
+  const Entry* Find(absl::string_view name) noexcept {
+    return Find(name, FieldHash(name));
+  }
+  /// @param name_hash  FieldHash(name), e.g. from DecodedHeader.
+  const Entry* Find(absl::string_view name, uint64_t name_hash) noexcept;
 
-  /// Lookup by HPACK index (static table offset + dynamic index).
-  std::shared_ptr<Entry> FindByIndex(uint32_t index) noexcept;
+  /// Lookup by HPACK index (static table offset + dynamic index); the
+  /// entry stays valid as for Find().
+  const Entry* FindByIndex(uint32_t index) noexcept;
 
   /// Insert new entry, evicting oldest if needed.
-  std::shared_ptr<Entry> Insert(absl::string_view name_slice,
+  /// @param name_hash, value_hash  FieldHash() of the decoded strings.
+  /// @return the entry; nullptr if it is larger than the whole table (the
+  ///   table is emptied, as RFC 7541 §4.4 requires) or on allocation failure.
+  Entry* Insert(absl::string_view name_slice,
                                 absl::string_view value_slice,
-                                std::string&& decoded_name,
-                                std::string&& decoded_value,
-                                EntryType type) noexcept;
+                                absl::string_view decoded_name,
+                                absl::string_view decoded_value,
+                                EntryType type, HeaderId id,
+                                uint64_t name_hash,
+                                uint64_t value_hash) noexcept;
+
+  /// @brief Current HPACK index of `entry`, 0 if it was evicted.
+  uint32_t IndexOf(const Entry& entry) const noexcept;
+
+  /// @brief Evict every entry (an oversized insertion, RFC 7541 §4.4).
+  void EvictAll() noexcept;
+
+  /// @brief Start a new epoch and pin it: entries evicted from now on stay
+  ///   readable until Unpin() of this epoch (and of any older one).
+  /// @return the epoch, never 0; 0 on allocation failure (nothing pinned).
+  uint64_t Pin() noexcept;
+  /// @brief Release a Pin(); frees the retired entries no pin can see.
+  void Unpin(uint64_t epoch) noexcept;
+  /// @brief Evicted entries waiting for a pin to go.
+  std::size_t RetiredCount() const noexcept;
 
   std::size_t BytesUsed() const noexcept;
+  std::size_t MaxBytes() const noexcept;
+  std::size_t EntryCount() const noexcept;
   void Clear() noexcept;
   void SnapshotStats(HpackStats& out) const noexcept;
   /// @brief Dynamically change the maximum byte capacity and evict if needed.
@@ -51,15 +145,43 @@ class DynamicTable {
 
  private:
   mutable absl::Mutex mutex_;
-  stream::RawBuffer<> raw_buffer_;
-  absl::node_hash_map<absl::string_view, std::shared_ptr<Entry>> cache_;
-  std::vector<std::shared_ptr<Entry>> queue_;
-  std::size_t head_ = 0, tail_ = 0;
+  /// Decoded name of an entry with its FieldHash: the map never hashes.
+  struct NameKey {
+    absl::string_view name;
+    uint64_t hash;
+    bool operator==(const NameKey& o) const noexcept {
+      return hash == o.hash && name == o.name;
+    }
+  };
+  struct NameKeyHash {
+    std::size_t operator()(const NameKey& k) const noexcept {
+      return static_cast<std::size_t>(k.hash);
+    }
+  };
+  absl::node_hash_map<NameKey, Entry*, NameKeyHash> cache_;
+  /// Ring of entries, oldest at head_.
+  std::vector<std::unique_ptr<Entry>> queue_;
+  std::size_t head_ = 0, count_ = 0;
+  uint32_t inserted_ = 0;
   std::size_t max_bytes_, current_bytes_ = 0;
   HpackStats stats_;
+  MemoryBudget* budget_;
+  ValuePool* pool_;
+
+  uint64_t epoch_ = 0;  ///< last epoch handed out by Pin()
+  absl::InlinedVector<uint64_t, 4> pins_;
+  /// Evicted entries still pinned, oldest (lowest retired_epoch) first.
+  Entry* retired_head_ = nullptr;
+  Entry* retired_tail_ = nullptr;
+  std::size_t retired_count_ = 0;
 
   void EvictIfNeeded(std::size_t need) noexcept;
   void EvictOne() noexcept;
+  /// @brief Free `e` now, or retire it while a pin can still see it.
+  void Drop(std::unique_ptr<Entry> e) noexcept;
+  void Reclaim() noexcept;
+  bool GrowQueue() noexcept;
+  void ReleaseStorage() noexcept;
 };
 
 }  // namespace hpack
@@ -0,0 +1,254 @@
+// include/h2v/hpack/encoder.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <utility>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+#include "h2v/hpack/admission_policy.h"
+#include "h2v/hpack/decoder.h"
+#include "h2v/hpack/error_code.h"
+#include "h2v/hpack/header.h"
+#include "h2v/hpack/header_id.h"
+#include "h2v/hpack/hpack_config.h"
+#include "h2v/hpack/hpack_stats.h"
+#include "h2v/hpack/memory_budget.h"
+#include "h2v/stream/raw_buffer.h"
+
+namespace h2v {
+namespace hpack {
+
+/// @brief Dynamic table size the peer starts with (RFC 9113 §6.5.2).
+constexpr std::size_t kDefaultHeaderTableSize = 4096;
+
+/// @brief Fields a new connection's encoder is expected to send, prepared
+///   once per process (`server`, `content-type: application/grpc`, ...).
+/// @details Build() resolves each field's static name index and encodes
+///   its literal-with-incremental-indexing representation (Huffman when
+///   shorter) into one buffer. Encoders share a built template read-only
+///   through Encoder::UseTemplate(): cloning it into a connection costs a
+///   pointer and a bit mask, and the first use of each field replays its
+///   prepared bytes and inserts it, bypassing the AdmissionPolicy. Exact
+///   static matches, sensitive fields, duplicates and fields over half the
+///   default table are left out.
+///
+///   Immutable once built: safe to share between threads.
+class DynamicTableTemplate {
+ public:
+  static constexpr std::size_t kMaxEntries = 64;
+
+  /// @brief Prepare `fields`, in order, up to kMaxEntries.
+  /// @return NONE or OUT_OF_MEMORY.
+  HpackErrorCode Build(absl::Span<const Header> fields) noexcept;
+
+  std::size_t Size() const noexcept {
+    return slots_.size();
+  }
+  /// @brief Slot of (name, value), -1 if absent.
+  int Find(absl::string_view name, absl::string_view value) const noexcept {
+    const auto it = index_.find(FieldKey(name, value));
+    return it == index_.end() ? -1 : it->second;
+  }
+  /// @brief Prepared representation of a slot.
+  absl::Span<const uint8_t> Wire(int slot) const noexcept {
+    const Slot& s = slots_[slot];
+    return absl::MakeConstSpan(wire_.raw() + s.offset, s.length);
+  }
+
+ private:
+  using FieldKey = std::pair<absl::string_view, absl::string_view>;
+  struct Slot {
+    std::string name;
+    std::string value;
+    uint32_t offset;
+    uint32_t length;
+  };
+
+  std::deque<Slot> slots_;  ///< stable: index_ views into it
+  absl::flat_hash_map<FieldKey, int> index_;
+  stream::RawBuffer<> wire_;
+};
+
+/// @brief HPACK encoder (RFC 7541), one per connection.
+/// @details Mirrors the peer decoder's dynamic table, so exact repeats are
+///   sent as a single index and repeated names as a name reference:
+///
+///   - exact static / dynamic matches are indexed (static lookups go
+///     through the HeaderId catalogue, not a table scan);
+///   - other fields that fit in half the table are offered to the
+///     AdmissionPolicy; admitted ones are added with incremental indexing,
+///     evicting the oldest entries, the rest are sent without indexing.
+///     The default TinyLfuAdmission keeps one-off and high-cardinality
+///     values (`:path`, `date`, request ids, content-length, ...) from
+///     flushing entries that are reused on every request;
+///   - authorization headers and cookie crumbs shorter than 20 bytes are
+///     literals never indexed (RFC 7541 §7.1.3);
+///   - strings use Huffman when it is shorter.
+///
+///   With a MemoryBudget, entries are charged as they are inserted; a
+///   field that would cross the limit is sent without indexing, and a
+///   pressure level change caps the table (with a size update) at the
+///   start of the next block or on CheckMemoryPressure().
+///
+///   A DynamicTableTemplate pre-warms a new connection: the fields it
+///   holds are inserted the first time they are sent, from bytes encoded
+///   once for the whole process.
+///
+///   With `crumble_cookies`, a cookie is split into one field per
+///   cookie-pair (RFC 9113 §8.2.3): a 3 KiB cookie where one crumb changed
+///   costs one literal plus an index per unchanged crumb.
+///
+///   Not thread-safe: owned by the connection's I/O thread.
+class Encoder {
+ public:
+  explicit Encoder(const HpackConfig& config = {}) noexcept;
+  ~Encoder();
+  Encoder(const Encoder&) = delete;
+  Encoder& operator=(const Encoder&) = delete;
+
+  /// @brief Encode one header block, appending it to `out`. Blocks must be
+  ///   sent in the order they were encoded.
+  /// @return NONE, or OUT_OF_MEMORY; the encoder is then out of sync with
+  ///   the peer and the connection must be closed.
+  HpackErrorCode Encode(absl::Span<const Header> fields,
+                        stream::RawBuffer<>& out) noexcept;
+
+  /// @brief Streaming form of Encode() for Transcoder: BeginBlock(), then
+  ///   one Transcode() per field of the block, all into the same `out`.
+  HpackErrorCode BeginBlock(stream::RawBuffer<>& out) noexcept;
+  /// @brief Re-encode a field decoded from another connection. Its
+  ///   HeaderId is reused, literal strings are copied in their wire form
+  ///   (no Huffman pass) and a never-indexed field stays never-indexed.
+  HpackErrorCode Transcode(const DecodedHeader& header,
+                           stream::RawBuffer<>& out) noexcept;
+
+  /// @brief Encode() for names in any letter case, as an HTTP/1.1 peer
+  ///   sends them. Well-known names are matched case-insensitively and
+  ///   sent as their catalogue form. Any other name is folded, validated,
+  ///   hashed and Huffman-encoded straight into `out` in one pass
+  ///   (FoldEncodeName); when its hash shows the dynamic table cannot hold
+  ///   it, that code is sent as is, else the field is encoded as Encode()
+  ///   would from the folded copy.
+  /// @return as Encode(), or ENCODE_INVALID_FIELD_NAME for an empty name
+  ///   or one holding a non-token octet: nothing of that field is written
+  ///   and the encoder stays usable, `out` holds the fields before it.
+  HpackErrorCode EncodeFolded(absl::Span<const Header> fields,
+                              stream::RawBuffer<>& out) noexcept;
+  /// @brief Streaming form of EncodeFolded(): one field of the block
+  ///   started with BeginBlock().
+  HpackErrorCode EncodeFoldedField(absl::string_view name,
+                                   absl::string_view value,
+                                   stream::RawBuffer<>& out) noexcept;
+
+  /// @brief The peer's SETTINGS_HEADER_TABLE_SIZE. The table shrinks at
+  ///   once; the size update is signalled at the start of the next block.
+  void SetPeerMaxTableSize(std::size_t bytes) noexcept;
+
+  /// @brief Use at most `bytes` of the table the peer allows (see
+  ///   TableSizeController); SIZE_MAX lifts the cap. Signalled like a
+  ///   SETTINGS change. Dropping to 0 also releases the lookup maps.
+  void SetTableTarget(std::size_t bytes) noexcept;
+
+  std::size_t TableBytes() const noexcept {
+    return used_;
+  }
+  std::size_t MaxTableBytes() const noexcept {
+    return max_bytes_;
+  }
+  /// @brief The most SetTableTarget() can reach: min(peer, config).
+  std::size_t TableLimit() const noexcept;
+
+  /// @brief Pre-warm from `tmpl` (not owned, must outlive the encoder);
+  ///   nullptr drops it. Best called before the first block.
+  void UseTemplate(const DynamicTableTemplate* tmpl) noexcept;
+
+  /// @brief Apply the budget's current pressure level now, e.g. from its
+  ///   pressure callback on an idle connection. Frees evicted entries at
+  ///   once; the size update goes out with the next block.
+  void CheckMemoryPressure() noexcept;
+  std::size_t EntryCount() const noexcept {
+    return entries_.size();
+  }
+
+  /// @brief Replace the indexing policy (not owned, must outlive the
+  ///   encoder); nullptr restores the built-in TinyLfuAdmission.
+  void SetAdmissionPolicy(AdmissionPolicy* policy) noexcept {
+    policy_ = policy ? policy : &default_policy_;
+  }
+
+  /// @brief cache_hits / cache_misses count indexed vs literal fields;
+  ///   admission_rejects the literals the policy kept out of the table.
+  void SnapshotStats(HpackStats& out) const noexcept {
+    out = stats_;
+  }
+
+ private:
+  struct Entry {
+    std::string name;
+    std::string value;
+    uint64_t hash;      ///< field hash given to the AdmissionPolicy
+    uint64_t name_key;  ///< FieldHash() of the name
+    uint32_t seq;       ///< insertion sequence number
+  };
+  using FieldKey = std::pair<absl::string_view, absl::string_view>;
+
+  HpackConfig config_;
+  std::deque<Entry> entries_;  ///< oldest first; views below point into it
+  absl::flat_hash_map<FieldKey, uint32_t> fields_;  ///< -> newest seq
+  absl::flat_hash_map<absl::string_view, uint32_t> names_;
+  /// name_key -> names in names_ with that FieldHash; a name missing here
+  /// is in no entry, which EncodeFoldedField() checks before it has the
+  /// name as a string
+  absl::flat_hash_map<uint64_t, uint32_t> name_keys_;
+  std::size_t peer_max_bytes_ = kDefaultHeaderTableSize;
+  std::size_t max_bytes_ = kDefaultHeaderTableSize;
+  std::size_t target_bytes_ = SIZE_MAX;
+  std::size_t pressure_cap_ = SIZE_MAX;
+  uint32_t budget_generation_ = 0;
+  std::size_t used_ = 0;
+  uint32_t inserted_ = 0;
+
+  bool size_update_pending_ = false;
+  std::size_t min_size_pending_ = SIZE_MAX;
+  bool failed_ = false;
+
+  const DynamicTableTemplate* template_ = nullptr;
+  uint64_t template_pending_ = 0;  ///< template slots not sent yet
+
+  std::string folded_;  ///< lowercase name of the current EncodeFolded field
+
+  TinyLfuAdmission default_policy_;
+  AdmissionPolicy* policy_ = &default_policy_;
+  HpackStats stats_;
+
+  void ApplyTableLimit() noexcept;
+  HpackErrorCode EncodeHeader(absl::string_view name, absl::string_view value,
+                              HeaderId id, stream::RawBuffer<>& out,
+                              const DecodedHeader* wire) noexcept;
+  HpackErrorCode EncodeField(absl::string_view name, absl::string_view value,
+                             HeaderId id, stream::RawBuffer<>& out,
+                             const DecodedHeader* wire) noexcept;
+  bool ShouldIndex(HeaderId id, absl::string_view name,
+                   absl::string_view value, uint64_t field_hash,
+                   uint64_t name_hash) noexcept;
+  HpackErrorCode EncodeNewName(absl::string_view name, absl::string_view value,
+                               std::size_t name_prefix,
+                               std::size_t huffman_size, uint64_t name_key,
+                               std::size_t start,
+                               stream::RawBuffer<>& out) noexcept;
+  HpackErrorCode Insert(absl::string_view name, absl::string_view value,
+                        uint64_t hash, uint64_t name_key) noexcept;
+  bool ReplayTemplate(absl::string_view name, absl::string_view value,
+                      uint64_t hash, stream::RawBuffer<>& out,
+                      HpackErrorCode& rc) noexcept;
+  void EvictTo(std::size_t bytes) noexcept;
+  uint32_t DynamicIndex(uint32_t seq) const noexcept;
+};
+
+}  // namespace hpack
+}  // namespace h2v
@@ -47,6 +47,19 @@ static constexpr HpackErrorCode HUFFMAN_DECODE_INVALID_EOS_PADDING_NIBBLE = 9;
 static constexpr HpackErrorCode HUFFMAN_DECODE_INVALID_EOS_PADDING_FBYTE = 10;
 static constexpr HpackErrorCode HPACK_HUFFMAN_DECODE_PAD_INVALID = 11;
 static constexpr HpackErrorCode HPACK_HUFFMAN_DECODE_INVALID_EOS = 12;
+static constexpr HpackErrorCode INTEGER_DECODE_TRUNCATED = 13;
+static constexpr HpackErrorCode INTEGER_DECODE_OVERFLOW = 14;
+static constexpr HpackErrorCode DECODE_INVALID_INDEX = 15;
+static constexpr HpackErrorCode DECODE_INVALID_TABLE_SIZE_UPDATE = 16;
+static constexpr HpackErrorCode DECODE_HEADER_LIST_TOO_LARGE = 17;
+static constexpr HpackErrorCode DECODE_BLOCK_TRUNCATED = 18;
+static constexpr HpackErrorCode DECODE_FAILED = 19;
+static constexpr HpackErrorCode OUT_OF_MEMORY = 20;
+static constexpr HpackErrorCode DECODE_MALFORMED_REQUEST = 21;
+static constexpr HpackErrorCode ENCODE_FAILED = 22;
+static constexpr HpackErrorCode DECODE_MALFORMED_FIELD = 23;
+static constexpr HpackErrorCode ENCODE_INVALID_FIELD_NAME = 24;
+static constexpr HpackErrorCode CONVERT_MALFORMED_HTTP1 = 25;
 
 }  // namespace HPACK_ERR
 }  // namespace hpack
@@ -0,0 +1,151 @@
+// include/h2v/hpack/field_class.h
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace h2v {
+namespace hpack {
+
+/// @brief Character classes of field octets (RFC 9113 §8.2.1), as a 4-bit
+///   mask. The same bits are baked into the low nibble of every
+///   kNibbleDecodeTable entry (OR of the octets it emits), so a Huffman
+///   string is classified while it is decoded.
+namespace FIELD_CLASS {
+/// 'A'..'Z': field names must be lowercase.
+static constexpr uint8_t UPPER = 0x1;
+/// 0x00..0x20 and 0x7f..0xff: never valid in a field name.
+static constexpr uint8_t NAME_FORBIDDEN = 0x2;
+/// Other visible octets outside tchar (RFC 9110 §5.6.2), ':' included.
+static constexpr uint8_t NON_TOKEN = 0x4;
+/// NUL, CR, LF: never valid in a field value.
+static constexpr uint8_t VALUE_FORBIDDEN = 0x8;
+}  // namespace FIELD_CLASS
+
+/// @brief Why a decoded field is malformed.
+enum class FieldViolation : uint8_t {
+  None = 0,
+  UppercaseName,       ///< name holds 'A'..'Z'
+  InvalidNameChar,     ///< empty name, CTL, SP, non-ASCII or non-tchar
+  ForbiddenValueChar,  ///< value holds NUL, CR or LF
+  ValueWhitespace      ///< value starts or ends with SP or HTAB
+};
+
+constexpr uint8_t FieldClassOf(uint8_t c) noexcept {
+  if (c <= 0x20 || c >= 0x7f) {
+    return FIELD_CLASS::NAME_FORBIDDEN |
+           ((c == 0 || c == '\r' || c == '\n') ? FIELD_CLASS::VALUE_FORBIDDEN
+                                               : 0);
+  }
+  if (c >= 'A' && c <= 'Z') {
+    return FIELD_CLASS::UPPER;
+  }
+  if ((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9')) {
+    return 0;
+  }
+  switch (c) {
+    case '!': case '#': case '$': case '%': case '&': case '\'': case '*':
+    case '+': case '-': case '.': case '^': case '_': case '`': case '|':
+    case '~':
+      return 0;
+    default:
+      return FIELD_CLASS::NON_TOKEN;
+  }
+}
+
+namespace detail {
+constexpr std::array<uint8_t, 256> MakeFieldClassTable() noexcept {
+  std::array<uint8_t, 256> t{};
+  for (int c = 0; c < 256; ++c) {
+    t[c] = FieldClassOf(static_cast<uint8_t>(c));
+  }
+  return t;
+}
+}  // namespace detail
+
+/// @brief FieldClassOf() for every octet, for strings sent raw.
+inline constexpr std::array<uint8_t, 256> kFieldClass =
+    detail::MakeFieldClassTable();
+
+/// @brief OR of the classes of `n` raw octets.
+inline uint8_t ClassifyField(const uint8_t* p, std::size_t n) noexcept {
+  uint8_t classes = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    classes |= kFieldClass[p[i]];
+  }
+  return classes;
+}
+
+/// @brief ASCII lowercase of `c`; other octets are returned unchanged.
+constexpr uint8_t LowerAscii(uint8_t c) noexcept {
+  return static_cast<uint8_t>(c | (uint8_t(c - 'A') < 26 ? 0x20 : 0));
+}
+
+/// @brief Copy a field name of any letter case (HTTP/1.1) to `out` folded
+///   to lowercase, and return the classes of the folded octets (UPPER is
+///   never set). Eight octets are folded at a time in a 64-bit register;
+///   the class lookups of the same octets ride in that loop, so folding
+///   and validating take one pass and no temporary string.
+inline uint8_t FoldFieldName(const uint8_t* in, std::size_t n,
+                             uint8_t* out) noexcept {
+  constexpr uint64_t kOnes = 0x0101010101010101ull;
+  uint8_t classes = 0;
+  std::size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    uint64_t w;
+    std::memcpy(&w, in + i, 8);
+    // per octet: high bit of ge_a set from 'A' up, of gt_z above 'Z';
+    // octets with the high bit set are never letters
+    const uint64_t low7 = w & (kOnes * 0x7f);
+    const uint64_t ge_a = low7 + kOnes * (0x80 - 'A');
+    const uint64_t gt_z = low7 + kOnes * (0x80 - 'Z' - 1);
+    w |= (ge_a & ~gt_z & ~w & (kOnes * 0x80)) >> 2;
+    std::memcpy(out + i, &w, 8);
+    for (std::size_t k = i; k < i + 8; ++k) {
+      classes |= kFieldClass[in[k]];
+    }
+  }
+  for (; i < n; ++i) {
+    out[i] = LowerAscii(in[i]);
+    classes |= kFieldClass[in[i]];
+  }
+  return static_cast<uint8_t>(classes & ~FIELD_CLASS::UPPER);
+}
+
+/// @brief Validate a name from its classes; only a NON_TOKEN hit rescans
+///   it, to accept the ':' leading a pseudo-header.
+inline FieldViolation CheckFieldName(const uint8_t* p, std::size_t n,
+                                     uint8_t classes) noexcept {
+  if (n == 0 || (classes & FIELD_CLASS::NAME_FORBIDDEN)) {
+    return FieldViolation::InvalidNameChar;
+  }
+  if (classes & FIELD_CLASS::UPPER) {
+    return FieldViolation::UppercaseName;
+  }
+  if (classes & FIELD_CLASS::NON_TOKEN) {
+    for (std::size_t i = p[0] == ':' ? 1 : 0; i < n; ++i) {
+      if (kFieldClass[p[i]] & FIELD_CLASS::NON_TOKEN) {
+        return FieldViolation::InvalidNameChar;
+      }
+    }
+  }
+  return FieldViolation::None;
+}
+
+/// @brief Validate a value from its classes and its first and last octet.
+inline FieldViolation CheckFieldValue(const uint8_t* p, std::size_t n,
+                                      uint8_t classes) noexcept {
+  if (classes & FIELD_CLASS::VALUE_FORBIDDEN) {
+    return FieldViolation::ForbiddenValueChar;
+  }
+  if (n > 0 && (p[0] == ' ' || p[0] == '\t' || p[n - 1] == ' ' ||
+                p[n - 1] == '\t')) {
+    return FieldViolation::ValueWhitespace;
+  }
+  return FieldViolation::None;
+}
+
+}  // namespace hpack
+}  // namespace h2v
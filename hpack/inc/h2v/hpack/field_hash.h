@@ -0,0 +1,44 @@
+// include/h2v/hpack/field_hash.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "absl/strings/string_view.h"
+
+namespace h2v {
+namespace hpack {
+
+/// @brief Hash of a decoded field name or value.
+/// @details Defined octet by octet (FNV-1a, then a 64-bit finalizer) so the
+///   Huffman decoder can fold each symbol in as it is emitted
+///   (huffman::FastDecodeHash) and produce the same hash FieldHash() gives
+///   over the decoded bytes. Dynamic table entries keep it for their name
+///   lookups and evictions, handlers get it in DecodedHeader.
+constexpr uint64_t kFieldHashSeed = 0xcbf29ce484222325ull;
+
+constexpr uint64_t FieldHashStep(uint64_t h, uint8_t c) noexcept {
+  return (h ^ c) * 0x100000001b3ull;
+}
+
+constexpr uint64_t FieldHashFinish(uint64_t h) noexcept {
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdull;
+  h ^= h >> 33;
+  return h;
+}
+
+constexpr uint64_t FieldHash(const uint8_t* p, std::size_t n) noexcept {
+  uint64_t h = kFieldHashSeed;
+  for (std::size_t i = 0; i < n; ++i) {
+    h = FieldHashStep(h, p[i]);
+  }
+  return FieldHashFinish(h);
+}
+
+inline uint64_t FieldHash(absl::string_view s) noexcept {
+  return FieldHash(reinterpret_cast<const uint8_t*>(s.data()), s.size());
+}
+
+}  // namespace hpack
+}  // namespace h2v
@@ -0,0 +1,38 @@
+// include/h2v/hpack/fold_encode.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace h2v {
+namespace hpack {
+
+/// @brief What FoldEncodeName() learned about a field name.
+struct FoldedName {
+  uint64_t hash = 0;             ///< FieldHash() of the folded name
+  std::size_t huffman_size = 0;  ///< its Huffman code, EOS padding included
+};
+
+/// @brief Room FoldEncodeName() needs for the Huffman code of an `n`-octet
+///   name: no tchar has a code longer than 16 bits.
+constexpr std::size_t FoldEncodeBound(std::size_t n) noexcept {
+  return 2 * n;
+}
+
+/// @brief Fold an HTTP/1.1 field name to lowercase into `folded`, check
+///   that it is a token and Huffman-encode it into `huffman`, reading `in`
+///   once.
+/// @details FoldFieldName() folds and classifies eight octets at a time.
+///   The opt-in H2V_HPACK_USE_HIGHWAY build (H2V_HAVE_HIGHWAY) instead folds
+///   a vector of octets and checks it against tchar with two nibble table
+///   lookups. Each block is then hashed and packed into the Huffman bit
+///   stream while it is still in L1, so the caller can look the name up
+///   from `result.hash` and send its code without another pass.
+/// @param huffman  room for FoldEncodeBound(n) octets.
+/// @return false if `in` holds an octet outside tchar (RFC 9110 §5.6.2);
+///   `folded`, `huffman` and `result` are then unspecified.
+bool FoldEncodeName(const uint8_t* in, std::size_t n, uint8_t* folded,
+                    uint8_t* huffman, FoldedName& result) noexcept;
+
+}  // namespace hpack
+}  // namespace h2v
@@ -15,7 +15,7 @@ namespace h2v { namespace hpack { namespace huffman { namespace table {
 //  bits [21..20] = emit_count (2 bits)
 //  bits [19..12] = s0 (8 bits)
 //  bits [11..4 ] = s1 (8 bits)
-//  bits [3..0  ] = 0 (unused)
+//  bits [3..0  ] = FIELD_CLASS bits of s0 | s1 (field_class.h)
 using NibblePackedEntry = uint32_t;
 static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x3c00000,
@@ -86,11 +86,11 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x973000,
   0x574000,
   0x974000,
-  0x120000,
+  0x120002,
   0x125000,
   0x12d000,
   0x12e000,
-  0x12f000,
+  0x12f004,
   0x133000,
   0x134000,
   0x135000,
@@ -98,8 +98,8 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x137000,
   0x138000,
   0x139000,
-  0x13d000,
-  0x141000,
+  0x13d004,
+  0x141001,
   0x15f000,
   0x162000,
   0x164000,
@@ -170,16 +170,16 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x1174000,
   0x1574000,
   0x1974000,
-  0x520000,
-  0x920000,
+  0x520002,
+  0x920002,
   0x525000,
   0x925000,
   0x52d000,
   0x92d000,
   0x52e000,
   0x92e000,
-  0x52f000,
-  0x92f000,
+  0x52f004,
+  0x92f004,
   0x533000,
   0x933000,
   0x534000,
@@ -194,10 +194,10 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x938000,
   0x539000,
   0x939000,
-  0x53d000,
-  0x93d000,
-  0x541000,
-  0x941000,
+  0x53d004,
+  0x93d004,
+  0x541001,
+  0x941001,
   0x55f000,
   0x95f000,
   0x562000,
@@ -222,30 +222,30 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x972000,
   0x575000,
   0x975000,
-  0x13a000,
-  0x142000,
-  0x143000,
-  0x144000,
-  0x145000,
-  0x146000,
-  0x147000,
-  0x148000,
-  0x149000,
-  0x14a000,
-  0x14b000,
-  0x14c000,
-  0x14d000,
-  0x14e000,
-  0x14f000,
-  0x150000,
-  0x151000,
-  0x152000,
-  0x153000,
-  0x154000,
-  0x155000,
-  0x156000,
-  0x157000,
-  0x159000,
+  0x13a004,
+  0x142001,
+  0x143001,
+  0x144001,
+  0x145001,
+  0x146001,
+  0x147001,
+  0x148001,
+  0x149001,
+  0x14a001,
+  0x14b001,
+  0x14c001,
+  0x14d001,
+  0x14e001,
+  0x14f001,
+  0x150001,
+  0x151001,
+  0x152001,
+  0x153001,
+  0x154001,
+  0x155001,
+  0x156001,
+  0x157001,
+  0x159001,
   0x16a000,
   0x16b000,
   0x171000,
@@ -338,10 +338,10 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x3174000,
   0x3574000,
   0x3974000,
-  0xd20000,
-  0x1120000,
-  0x1520000,
-  0x1920000,
+  0xd20002,
+  0x1120002,
+  0x1520002,
+  0x1920002,
   0xd25000,
   0x1125000,
   0x1525000,
@@ -354,10 +354,10 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x112e000,
   0x152e000,
   0x192e000,
-  0xd2f000,
-  0x112f000,
-  0x152f000,
-  0x192f000,
+  0xd2f004,
+  0x112f004,
+  0x152f004,
+  0x192f004,
   0xd33000,
   0x1133000,
   0x1533000,
@@ -386,14 +386,14 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x1139000,
   0x1539000,
   0x1939000,
-  0xd3d000,
-  0x113d000,
-  0x153d000,
-  0x193d000,
-  0xd41000,
-  0x1141000,
-  0x1541000,
-  0x1941000,
+  0xd3d004,
+  0x113d004,
+  0x153d004,
+  0x193d004,
+  0xd41001,
+  0x1141001,
+  0x1541001,
+  0x1941001,
   0xd5f000,
   0x115f000,
   0x155f000,
@@ -442,54 +442,54 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x1175000,
   0x1575000,
   0x1975000,
-  0x53a000,
-  0x93a000,
-  0x542000,
-  0x942000,
-  0x543000,
-  0x943000,
-  0x544000,
-  0x944000,
-  0x545000,
-  0x945000,
-  0x546000,
-  0x946000,
-  0x547000,
-  0x947000,
-  0x548000,
-  0x948000,
-  0x549000,
-  0x949000,
-  0x54a000,
-  0x94a000,
-  0x54b000,
-  0x94b000,
-  0x54c000,
-  0x94c000,
-  0x54d000,
-  0x94d000,
-  0x54e000,
-  0x94e000,
-  0x54f000,
-  0x94f000,
-  0x550000,
-  0x950000,
-  0x551000,
-  0x951000,
-  0x552000,
-  0x952000,
-  0x553000,
-  0x953000,
-  0x554000,
-  0x954000,
-  0x555000,
-  0x955000,
-  0x556000,
-  0x956000,
-  0x557000,
-  0x957000,
-  0x559000,
-  0x959000,
+  0x53a004,
+  0x93a004,
+  0x542001,
+  0x942001,
+  0x543001,
+  0x943001,
+  0x544001,
+  0x944001,
+  0x545001,
+  0x945001,
+  0x546001,
+  0x946001,
+  0x547001,
+  0x947001,
+  0x548001,
+  0x948001,
+  0x549001,
+  0x949001,
+  0x54a001,
+  0x94a001,
+  0x54b001,
+  0x94b001,
+  0x54c001,
+  0x94c001,
+  0x54d001,
+  0x94d001,
+  0x54e001,
+  0x94e001,
+  0x54f001,
+  0x94f001,
+  0x550001,
+  0x950001,
+  0x551001,
+  0x951001,
+  0x552001,
+  0x952001,
+  0x553001,
+  0x953001,
+  0x554001,
+  0x954001,
+  0x555001,
+  0x955001,
+  0x556001,
+  0x956001,
+  0x557001,
+  0x957001,
+  0x559001,
+  0x959001,
   0x56a000,
   0x96a000,
   0x56b000,
@@ -508,10 +508,10 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x97a000,
   0x126000,
   0x12a000,
-  0x12c000,
-  0x13b000,
-  0x158000,
-  0x15a000,
+  0x12c004,
+  0x13b004,
+  0x158001,
+  0x15a001,
   0x25400000,
   0x25800000,
   0x80000000,
@@ -674,14 +674,14 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x80000000,
   0x80000000,
   0x80000000,
-  0x1d20000,
-  0x2120000,
-  0x2520000,
-  0x2920000,
-  0x2d20000,
-  0x3120000,
-  0x3520000,
-  0x3920000,
+  0x1d20002,
+  0x2120002,
+  0x2520002,
+  0x2920002,
+  0x2d20002,
+  0x3120002,
+  0x3520002,
+  0x3920002,
   0x1d25000,
   0x2125000,
   0x2525000,
@@ -706,14 +706,14 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x312e000,
   0x352e000,
   0x392e000,
-  0x1d2f000,
-  0x212f000,
-  0x252f000,
-  0x292f000,
-  0x2d2f000,
-  0x312f000,
-  0x352f000,
-  0x392f000,
+  0x1d2f004,
+  0x212f004,
+  0x252f004,
+  0x292f004,
+  0x2d2f004,
+  0x312f004,
+  0x352f004,
+  0x392f004,
   0x1d33000,
   0x2133000,
   0x2533000,
@@ -770,22 +770,22 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x3139000,
   0x3539000,
   0x3939000,
-  0x1d3d000,
-  0x213d000,
-  0x253d000,
-  0x293d000,
-  0x2d3d000,
-  0x313d000,
-  0x353d000,
-  0x393d000,
-  0x1d41000,
-  0x2141000,
-  0x2541000,
-  0x2941000,
-  0x2d41000,
-  0x3141000,
-  0x3541000,
-  0x3941000,
+  0x1d3d004,
+  0x213d004,
+  0x253d004,
+  0x293d004,
+  0x2d3d004,
+  0x313d004,
+  0x353d004,
+  0x393d004,
+  0x1d41001,
+  0x2141001,
+  0x2541001,
+  0x2941001,
+  0x2d41001,
+  0x3141001,
+  0x3541001,
+  0x3941001,
   0x1d5f000,
   0x215f000,
   0x255f000,
@@ -882,102 +882,102 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x3175000,
   0x3575000,
   0x3975000,
-  0xd3a000,
-  0x113a000,
-  0x153a000,
-  0x193a000,
-  0xd42000,
-  0x1142000,
-  0x1542000,
-  0x1942000,
-  0xd43000,
-  0x1143000,
-  0x1543000,
-  0x1943000,
-  0xd44000,
-  0x1144000,
-  0x1544000,
-  0x1944000,
-  0xd45000,
-  0x1145000,
-  0x1545000,
-  0x1945000,
-  0xd46000,
-  0x1146000,
-  0x1546000,
-  0x1946000,
-  0xd47000,
-  0x1147000,
-  0x1547000,
-  0x1947000,
-  0xd48000,
-  0x1148000,
-  0x1548000,
-  0x1948000,
-  0xd49000,
-  0x1149000,
-  0x1549000,
-  0x1949000,
-  0xd4a000,
-  0x114a000,
-  0x154a000,
-  0x194a000,
-  0xd4b000,
-  0x114b000,
-  0x154b000,
-  0x194b000,
-  0xd4c000,
-  0x114c000,
-  0x154c000,
-  0x194c000,
-  0xd4d000,
-  0x114d000,
-  0x154d000,
-  0x194d000,
-  0xd4e000,
-  0x114e000,
-  0x154e000,
-  0x194e000,
-  0xd4f000,
-  0x114f000,
-  0x154f000,
-  0x194f000,
-  0xd50000,
-  0x1150000,
-  0x1550000,
-  0x1950000,
-  0xd51000,
-  0x1151000,
-  0x1551000,
-  0x1951000,
-  0xd52000,
-  0x1152000,
-  0x1552000,
-  0x1952000,
-  0xd53000,
-  0x1153000,
-  0x1553000,
-  0x1953000,
-  0xd54000,
-  0x1154000,
-  0x1554000,
-  0x1954000,
-  0xd55000,
-  0x1155000,
-  0x1555000,
-  0x1955000,
-  0xd56000,
-  0x1156000,
-  0x1556000,
-  0x1956000,
-  0xd57000,
-  0x1157000,
-  0x1557000,
-  0x1957000,
-  0xd59000,
-  0x1159000,
-  0x1559000,
-  0x1959000,
+  0xd3a004,
+  0x113a004,
+  0x153a004,
+  0x193a004,
+  0xd42001,
+  0x1142001,
+  0x1542001,
+  0x1942001,
+  0xd43001,
+  0x1143001,
+  0x1543001,
+  0x1943001,
+  0xd44001,
+  0x1144001,
+  0x1544001,
+  0x1944001,
+  0xd45001,
+  0x1145001,
+  0x1545001,
+  0x1945001,
+  0xd46001,
+  0x1146001,
+  0x1546001,
+  0x1946001,
+  0xd47001,
+  0x1147001,
+  0x1547001,
+  0x1947001,
+  0xd48001,
+  0x1148001,
+  0x1548001,
+  0x1948001,
+  0xd49001,
+  0x1149001,
+  0x1549001,
+  0x1949001,
+  0xd4a001,
+  0x114a001,
+  0x154a001,
+  0x194a001,
+  0xd4b001,
+  0x114b001,
+  0x154b001,
+  0x194b001,
+  0xd4c001,
+  0x114c001,
+  0x154c001,
+  0x194c001,
+  0xd4d001,
+  0x114d001,
+  0x154d001,
+  0x194d001,
+  0xd4e001,
+  0x114e001,
+  0x154e001,
+  0x194e001,
+  0xd4f001,
+  0x114f001,
+  0x154f001,
+  0x194f001,
+  0xd50001,
+  0x1150001,
+  0x1550001,
+  0x1950001,
+  0xd51001,
+  0x1151001,
+  0x1551001,
+  0x1951001,
+  0xd52001,
+  0x1152001,
+  0x1552001,
+  0x1952001,
+  0xd53001,
+  0x1153001,
+  0x1553001,
+  0x1953001,
+  0xd54001,
+  0x1154001,
+  0x1554001,
+  0x1954001,
+  0xd55001,
+  0x1155001,
+  0x1555001,
+  0x1955001,
+  0xd56001,
+  0x1156001,
+  0x1556001,
+  0x1956001,
+  0xd57001,
+  0x1157001,
+  0x1557001,
+  0x1957001,
+  0xd59001,
+  0x1159001,
+  0x1559001,
+  0x1959001,
   0xd6a000,
   0x116a000,
   0x156a000,
@@ -1014,14 +1014,14 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x926000,
   0x52a000,
   0x92a000,
-  0x52c000,
-  0x92c000,
-  0x53b000,
-  0x93b000,
-  0x558000,
-  0x958000,
-  0x55a000,
-  0x95a000,
+  0x52c004,
+  0x92c004,
+  0x53b004,
+  0x93b004,
+  0x558001,
+  0x958001,
+  0x55a001,
+  0x95a001,
   0x25c00000,
   0x26000000,
   0x26400000,
@@ -1442,198 +1442,198 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x80000000,
   0x80000000,
   0x80000000,
-  0x1d3a000,
-  0x213a000,
-  0x253a000,
-  0x293a000,
-  0x2d3a000,
-  0x313a000,
-  0x353a000,
-  0x393a000,
-  0x1d42000,
-  0x2142000,
-  0x2542000,
-  0x2942000,
-  0x2d42000,
-  0x3142000,
-  0x3542000,
-  0x3942000,
-  0x1d43000,
-  0x2143000,
-  0x2543000,
-  0x2943000,
-  0x2d43000,
-  0x3143000,
-  0x3543000,
-  0x3943000,
-  0x1d44000,
-  0x2144000,
-  0x2544000,
-  0x2944000,
-  0x2d44000,
-  0x3144000,
-  0x3544000,
-  0x3944000,
-  0x1d45000,
-  0x2145000,
-  0x2545000,
-  0x2945000,
-  0x2d45000,
-  0x3145000,
-  0x3545000,
-  0x3945000,
-  0x1d46000,
-  0x2146000,
-  0x2546000,
-  0x2946000,
-  0x2d46000,
-  0x3146000,
-  0x3546000,
-  0x3946000,
-  0x1d47000,
-  0x2147000,
-  0x2547000,
-  0x2947000,
-  0x2d47000,
-  0x3147000,
-  0x3547000,
-  0x3947000,
-  0x1d48000,
-  0x2148000,
-  0x2548000,
-  0x2948000,
-  0x2d48000,
-  0x3148000,
-  0x3548000,
-  0x3948000,
-  0x1d49000,
-  0x2149000,
-  0x2549000,
-  0x2949000,
-  0x2d49000,
-  0x3149000,
-  0x3549000,
-  0x3949000,
-  0x1d4a000,
-  0x214a000,
-  0x254a000,
-  0x294a000,
-  0x2d4a000,
-  0x314a000,
-  0x354a000,
-  0x394a000,
-  0x1d4b000,
-  0x214b000,
-  0x254b000,
-  0x294b000,
-  0x2d4b000,
-  0x314b000,
-  0x354b000,
-  0x394b000,
-  0x1d4c000,
-  0x214c000,
-  0x254c000,
-  0x294c000,
-  0x2d4c000,
-  0x314c000,
-  0x354c000,
-  0x394c000,
-  0x1d4d000,
-  0x214d000,
-  0x254d000,
-  0x294d000,
-  0x2d4d000,
-  0x314d000,
-  0x354d000,
-  0x394d000,
-  0x1d4e000,
-  0x214e000,
-  0x254e000,
-  0x294e000,
-  0x2d4e000,
-  0x314e000,
-  0x354e000,
-  0x394e000,
-  0x1d4f000,
-  0x214f000,
-  0x254f000,
-  0x294f000,
-  0x2d4f000,
-  0x314f000,
-  0x354f000,
-  0x394f000,
-  0x1d50000,
-  0x2150000,
-  0x2550000,
-  0x2950000,
-  0x2d50000,
-  0x3150000,
-  0x3550000,
-  0x3950000,
-  0x1d51000,
-  0x2151000,
-  0x2551000,
-  0x2951000,
-  0x2d51000,
-  0x3151000,
-  0x3551000,
-  0x3951000,
-  0x1d52000,
-  0x2152000,
-  0x2552000,
-  0x2952000,
-  0x2d52000,
-  0x3152000,
-  0x3552000,
-  0x3952000,
-  0x1d53000,
-  0x2153000,
-  0x2553000,
-  0x2953000,
-  0x2d53000,
-  0x3153000,
-  0x3553000,
-  0x3953000,
-  0x1d54000,
-  0x2154000,
-  0x2554000,
-  0x2954000,
-  0x2d54000,
-  0x3154000,
-  0x3554000,
-  0x3954000,
-  0x1d55000,
-  0x2155000,
-  0x2555000,
-  0x2955000,
-  0x2d55000,
-  0x3155000,
-  0x3555000,
-  0x3955000,
-  0x1d56000,
-  0x2156000,
-  0x2556000,
-  0x2956000,
-  0x2d56000,
-  0x3156000,
-  0x3556000,
-  0x3956000,
-  0x1d57000,
-  0x2157000,
-  0x2557000,
-  0x2957000,
-  0x2d57000,
-  0x3157000,
-  0x3557000,
-  0x3957000,
-  0x1d59000,
-  0x2159000,
-  0x2559000,
-  0x2959000,
-  0x2d59000,
-  0x3159000,
-  0x3559000,
-  0x3959000,
+  0x1d3a004,
+  0x213a004,
+  0x253a004,
+  0x293a004,
+  0x2d3a004,
+  0x313a004,
+  0x353a004,
+  0x393a004,
+  0x1d42001,
+  0x2142001,
+  0x2542001,
+  0x2942001,
+  0x2d42001,
+  0x3142001,
+  0x3542001,
+  0x3942001,
+  0x1d43001,
+  0x2143001,
+  0x2543001,
+  0x2943001,
+  0x2d43001,
+  0x3143001,
+  0x3543001,
+  0x3943001,
+  0x1d44001,
+  0x2144001,
+  0x2544001,
+  0x2944001,
+  0x2d44001,
+  0x3144001,
+  0x3544001,
+  0x3944001,
+  0x1d45001,
+  0x2145001,
+  0x2545001,
+  0x2945001,
+  0x2d45001,
+  0x3145001,
+  0x3545001,
+  0x3945001,
+  0x1d46001,
+  0x2146001,
+  0x2546001,
+  0x2946001,
+  0x2d46001,
+  0x3146001,
+  0x3546001,
+  0x3946001,
+  0x1d47001,
+  0x2147001,
+  0x2547001,
+  0x2947001,
+  0x2d47001,
+  0x3147001,
+  0x3547001,
+  0x3947001,
+  0x1d48001,
+  0x2148001,
+  0x2548001,
+  0x2948001,
+  0x2d48001,
+  0x3148001,
+  0x3548001,
+  0x3948001,
+  0x1d49001,
+  0x2149001,
+  0x2549001,
+  0x2949001,
+  0x2d49001,
+  0x3149001,
+  0x3549001,
+  0x3949001,
+  0x1d4a001,
+  0x214a001,
+  0x254a001,
+  0x294a001,
+  0x2d4a001,
+  0x314a001,
+  0x354a001,
+  0x394a001,
+  0x1d4b001,
+  0x214b001,
+  0x254b001,
+  0x294b001,
+  0x2d4b001,
+  0x314b001,
+  0x354b001,
+  0x394b001,
+  0x1d4c001,
+  0x214c001,
+  0x254c001,
+  0x294c001,
+  0x2d4c001,
+  0x314c001,
+  0x354c001,
+  0x394c001,
+  0x1d4d001,
+  0x214d001,
+  0x254d001,
+  0x294d001,
+  0x2d4d001,
+  0x314d001,
+  0x354d001,
+  0x394d001,
+  0x1d4e001,
+  0x214e001,
+  0x254e001,
+  0x294e001,
+  0x2d4e001,
+  0x314e001,
+  0x354e001,
+  0x394e001,
+  0x1d4f001,
+  0x214f001,
+  0x254f001,
+  0x294f001,
+  0x2d4f001,
+  0x314f001,
+  0x354f001,
+  0x394f001,
+  0x1d50001,
+  0x2150001,
+  0x2550001,
+  0x2950001,
+  0x2d50001,
+  0x3150001,
+  0x3550001,
+  0x3950001,
+  0x1d51001,
+  0x2151001,
+  0x2551001,
+  0x2951001,
+  0x2d51001,
+  0x3151001,
+  0x3551001,
+  0x3951001,
+  0x1d52001,
+  0x2152001,
+  0x2552001,
+  0x2952001,
+  0x2d52001,
+  0x3152001,
+  0x3552001,
+  0x3952001,
+  0x1d53001,
+  0x2153001,
+  0x2553001,
+  0x2953001,
+  0x2d53001,
+  0x3153001,
+  0x3553001,
+  0x3953001,
+  0x1d54001,
+  0x2154001,
+  0x2554001,
+  0x2954001,
+  0x2d54001,
+  0x3154001,
+  0x3554001,
+  0x3954001,
+  0x1d55001,
+  0x2155001,
+  0x2555001,
+  0x2955001,
+  0x2d55001,
+  0x3155001,
+  0x3555001,
+  0x3955001,
+  0x1d56001,
+  0x2156001,
+  0x2556001,
+  0x2956001,
+  0x2d56001,
+  0x3156001,
+  0x3556001,
+  0x3956001,
+  0x1d57001,
+  0x2157001,
+  0x2557001,
+  0x2957001,
+  0x2d57001,
+  0x3157001,
+  0x3557001,
+  0x3957001,
+  0x1d59001,
+  0x2159001,
+  0x2559001,
+  0x2959001,
+  0x2d59001,
+  0x3159001,
+  0x3559001,
+  0x3959001,
   0x1d6a000,
   0x216a000,
   0x256a000,
@@ -1706,27 +1706,27 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x112a000,
   0x152a000,
   0x192a000,
-  0xd2c000,
-  0x112c000,
-  0x152c000,
-  0x192c000,
-  0xd3b000,
-  0x113b000,
-  0x153b000,
-  0x193b000,
-  0xd58000,
-  0x1158000,
-  0x1558000,
-  0x1958000,
-  0xd5a000,
-  0x115a000,
-  0x155a000,
-  0x195a000,
+  0xd2c004,
+  0x112c004,
+  0x152c004,
+  0x192c004,
+  0xd3b004,
+  0x113b004,
+  0x153b004,
+  0x193b004,
+  0xd58001,
+  0x1158001,
+  0x1558001,
+  0x1958001,
+  0xd5a001,
+  0x115a001,
+  0x155a001,
+  0x195a001,
   0x121000,
-  0x122000,
-  0x128000,
-  0x129000,
-  0x13f000,
+  0x122004,
+  0x128004,
+  0x129004,
+  0x13f004,
   0x28000000,
   0x28400000,
   0x28800000,
@@ -2258,48 +2258,48 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x312a000,
   0x352a000,
   0x392a000,
-  0x1d2c000,
-  0x212c000,
-  0x252c000,
-  0x292c000,
-  0x2d2c000,
-  0x312c000,
-  0x352c000,
-  0x392c000,
-  0x1d3b000,
-  0x213b000,
-  0x253b000,
-  0x293b000,
-  0x2d3b000,
-  0x313b000,
-  0x353b000,
-  0x393b000,
-  0x1d58000,
-  0x2158000,
-  0x2558000,
-  0x2958000,
-  0x2d58000,
-  0x3158000,
-  0x3558000,
-  0x3958000,
-  0x1d5a000,
-  0x215a000,
-  0x255a000,
-  0x295a000,
-  0x2d5a000,
-  0x315a000,
-  0x355a000,
-  0x395a000,
+  0x1d2c004,
+  0x212c004,
+  0x252c004,
+  0x292c004,
+  0x2d2c004,
+  0x312c004,
+  0x352c004,
+  0x392c004,
+  0x1d3b004,
+  0x213b004,
+  0x253b004,
+  0x293b004,
+  0x2d3b004,
+  0x313b004,
+  0x353b004,
+  0x393b004,
+  0x1d58001,
+  0x2158001,
+  0x2558001,
+  0x2958001,
+  0x2d58001,
+  0x3158001,
+  0x3558001,
+  0x3958001,
+  0x1d5a001,
+  0x215a001,
+  0x255a001,
+  0x295a001,
+  0x2d5a001,
+  0x315a001,
+  0x355a001,
+  0x395a001,
   0x521000,
   0x921000,
-  0x522000,
-  0x922000,
-  0x528000,
-  0x928000,
-  0x529000,
-  0x929000,
-  0x53f000,
-  0x93f000,
+  0x522004,
+  0x922004,
+  0x528004,
+  0x928004,
+  0x529004,
+  0x929004,
+  0x53f004,
+  0x93f004,
   0x127000,
   0x12b000,
   0x17c000,
@@ -2406,22 +2406,22 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x1121000,
   0x1521000,
   0x1921000,
-  0xd22000,
-  0x1122000,
-  0x1522000,
-  0x1922000,
-  0xd28000,
-  0x1128000,
-  0x1528000,
-  0x1928000,
-  0xd29000,
-  0x1129000,
-  0x1529000,
-  0x1929000,
-  0xd3f000,
-  0x113f000,
-  0x153f000,
-  0x193f000,
+  0xd22004,
+  0x1122004,
+  0x1522004,
+  0x1922004,
+  0xd28004,
+  0x1128004,
+  0x1528004,
+  0x1928004,
+  0xd29004,
+  0x1129004,
+  0x1529004,
+  0x1929004,
+  0xd3f004,
+  0x113f004,
+  0x153f004,
+  0x193f004,
   0x527000,
   0x927000,
   0x52b000,
@@ -2429,7 +2429,7 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x57c000,
   0x97c000,
   0x123000,
-  0x13e000,
+  0x13e004,
   0x2ac00000,
   0x2b000000,
   0x2b400000,
@@ -2442,38 +2442,38 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x3121000,
   0x3521000,
   0x3921000,
-  0x1d22000,
-  0x2122000,
-  0x2522000,
-  0x2922000,
-  0x2d22000,
-  0x3122000,
-  0x3522000,
-  0x3922000,
-  0x1d28000,
-  0x2128000,
-  0x2528000,
-  0x2928000,
-  0x2d28000,
-  0x3128000,
-  0x3528000,
-  0x3928000,
-  0x1d29000,
-  0x2129000,
-  0x2529000,
-  0x2929000,
-  0x2d29000,
-  0x3129000,
-  0x3529000,
-  0x3929000,
-  0x1d3f000,
-  0x213f000,
-  0x253f000,
-  0x293f000,
-  0x2d3f000,
-  0x313f000,
-  0x353f000,
-  0x393f000,
+  0x1d22004,
+  0x2122004,
+  0x2522004,
+  0x2922004,
+  0x2d22004,
+  0x3122004,
+  0x3522004,
+  0x3922004,
+  0x1d28004,
+  0x2128004,
+  0x2528004,
+  0x2928004,
+  0x2d28004,
+  0x3128004,
+  0x3528004,
+  0x3928004,
+  0x1d29004,
+  0x2129004,
+  0x2529004,
+  0x2929004,
+  0x2d29004,
+  0x3129004,
+  0x3529004,
+  0x3929004,
+  0x1d3f004,
+  0x213f004,
+  0x253f004,
+  0x293f004,
+  0x2d3f004,
+  0x313f004,
+  0x353f004,
+  0x393f004,
   0xd27000,
   0x1127000,
   0x1527000,
@@ -2488,13 +2488,13 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x197c000,
   0x523000,
   0x923000,
-  0x53e000,
-  0x93e000,
-  0x100000,
+  0x53e004,
+  0x93e004,
+  0x10000a,
   0x124000,
-  0x140000,
-  0x15b000,
-  0x15d000,
+  0x140004,
+  0x15b004,
+  0x15d004,
   0x17e000,
   0x2d400000,
   0x2d800000,
@@ -2606,24 +2606,24 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x1123000,
   0x1523000,
   0x1923000,
-  0xd3e000,
-  0x113e000,
-  0x153e000,
-  0x193e000,
-  0x500000,
-  0x900000,
+  0xd3e004,
+  0x113e004,
+  0x153e004,
+  0x193e004,
+  0x50000a,
+  0x90000a,
   0x524000,
   0x924000,
-  0x540000,
-  0x940000,
-  0x55b000,
-  0x95b000,
-  0x55d000,
-  0x95d000,
+  0x540004,
+  0x940004,
+  0x55b004,
+  0x95b004,
+  0x55d004,
+  0x95d004,
   0x57e000,
   0x97e000,
   0x15e000,
-  0x17d000,
+  0x17d004,
   0x2e400000,
   0x2e800000,
   0x80000000,
@@ -2682,45 +2682,45 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x3123000,
   0x3523000,
   0x3923000,
-  0x1d3e000,
-  0x213e000,
-  0x253e000,
-  0x293e000,
-  0x2d3e000,
-  0x313e000,
-  0x353e000,
-  0x393e000,
-  0xd00000,
-  0x1100000,
-  0x1500000,
-  0x1900000,
+  0x1d3e004,
+  0x213e004,
+  0x253e004,
+  0x293e004,
+  0x2d3e004,
+  0x313e004,
+  0x353e004,
+  0x393e004,
+  0xd0000a,
+  0x110000a,
+  0x150000a,
+  0x190000a,
   0xd24000,
   0x1124000,
   0x1524000,
   0x1924000,
-  0xd40000,
-  0x1140000,
-  0x1540000,
-  0x1940000,
-  0xd5b000,
-  0x115b000,
-  0x155b000,
-  0x195b000,
-  0xd5d000,
-  0x115d000,
-  0x155d000,
-  0x195d000,
+  0xd40004,
+  0x1140004,
+  0x1540004,
+  0x1940004,
+  0xd5b004,
+  0x115b004,
+  0x155b004,
+  0x195b004,
+  0xd5d004,
+  0x115d004,
+  0x155d004,
+  0x195d004,
   0xd7e000,
   0x117e000,
   0x157e000,
   0x197e000,
   0x55e000,
   0x95e000,
-  0x57d000,
-  0x97d000,
-  0x13c000,
+  0x57d004,
+  0x97d004,
+  0x13c004,
   0x160000,
-  0x17b000,
+  0x17b004,
   0x2f800000,
   0x80000000,
   0x80000000,
@@ -2754,14 +2754,14 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x80000000,
   0x80000000,
   0x80000000,
-  0x1d00000,
-  0x2100000,
-  0x2500000,
-  0x2900000,
-  0x2d00000,
-  0x3100000,
-  0x3500000,
-  0x3900000,
+  0x1d0000a,
+  0x210000a,
+  0x250000a,
+  0x290000a,
+  0x2d0000a,
+  0x310000a,
+  0x350000a,
+  0x390000a,
   0x1d24000,
   0x2124000,
   0x2524000,
@@ -2770,30 +2770,30 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x3124000,
   0x3524000,
   0x3924000,
-  0x1d40000,
-  0x2140000,
-  0x2540000,
-  0x2940000,
-  0x2d40000,
-  0x3140000,
-  0x3540000,
-  0x3940000,
-  0x1d5b000,
-  0x215b000,
-  0x255b000,
-  0x295b000,
-  0x2d5b000,
-  0x315b000,
-  0x355b000,
-  0x395b000,
-  0x1d5d000,
-  0x215d000,
-  0x255d000,
-  0x295d000,
-  0x2d5d000,
-  0x315d000,
-  0x355d000,
-  0x395d000,
+  0x1d40004,
+  0x2140004,
+  0x2540004,
+  0x2940004,
+  0x2d40004,
+  0x3140004,
+  0x3540004,
+  0x3940004,
+  0x1d5b004,
+  0x215b004,
+  0x255b004,
+  0x295b004,
+  0x2d5b004,
+  0x315b004,
+  0x355b004,
+  0x395b004,
+  0x1d5d004,
+  0x215d004,
+  0x255d004,
+  0x295d004,
+  0x2d5d004,
+  0x315d004,
+  0x355d004,
+  0x395d004,
   0x1d7e000,
   0x217e000,
   0x257e000,
@@ -2806,16 +2806,16 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x115e000,
   0x155e000,
   0x195e000,
-  0xd7d000,
-  0x117d000,
-  0x157d000,
-  0x197d000,
-  0x53c000,
-  0x93c000,
+  0xd7d004,
+  0x117d004,
+  0x157d004,
+  0x197d004,
+  0x53c004,
+  0x93c004,
   0x560000,
   0x960000,
-  0x57b000,
-  0x97b000,
+  0x57b004,
+  0x97b004,
   0x2fc00000,
   0x30000000,
   0x80000000,
@@ -2922,26 +2922,26 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x315e000,
   0x355e000,
   0x395e000,
-  0x1d7d000,
-  0x217d000,
-  0x257d000,
-  0x297d000,
-  0x2d7d000,
-  0x317d000,
-  0x357d000,
-  0x397d000,
-  0xd3c000,
-  0x113c000,
-  0x153c000,
-  0x193c000,
+  0x1d7d004,
+  0x217d004,
+  0x257d004,
+  0x297d004,
+  0x2d7d004,
+  0x317d004,
+  0x357d004,
+  0x397d004,
+  0xd3c004,
+  0x113c004,
+  0x153c004,
+  0x193c004,
   0xd60000,
   0x1160000,
   0x1560000,
   0x1960000,
-  0xd7b000,
-  0x117b000,
-  0x157b000,
-  0x197b000,
+  0xd7b004,
+  0x117b004,
+  0x157b004,
+  0x197b004,
   0x30400000,
   0x30800000,
   0x30c00000,
@@ -2978,14 +2978,14 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x80000000,
   0x80000000,
   0x80000000,
-  0x1d3c000,
-  0x213c000,
-  0x253c000,
-  0x293c000,
-  0x2d3c000,
-  0x313c000,
-  0x353c000,
-  0x393c000,
+  0x1d3c004,
+  0x213c004,
+  0x253c004,
+  0x293c004,
+  0x2d3c004,
+  0x313c004,
+  0x353c004,
+  0x393c004,
   0x1d60000,
   0x2160000,
   0x2560000,
@@ -2994,14 +2994,14 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x3160000,
   0x3560000,
   0x3960000,
-  0x1d7b000,
-  0x217b000,
-  0x257b000,
-  0x297b000,
-  0x2d7b000,
-  0x317b000,
-  0x357b000,
-  0x397b000,
+  0x1d7b004,
+  0x217b004,
+  0x257b004,
+  0x297b004,
+  0x2d7b004,
+  0x317b004,
+  0x357b004,
+  0x397b004,
   0x31400000,
   0x31800000,
   0x31c00000,
@@ -3058,9 +3058,9 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x80000000,
   0x80000000,
   0x80000000,
-  0x15c000,
-  0x1c3000,
-  0x1d0000,
+  0x15c004,
+  0x1c3002,
+  0x1d0002,
   0x34000000,
   0x34400000,
   0x34800000,
@@ -3074,20 +3074,20 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x36800000,
   0x36c00000,
   0x37000000,
-  0x55c000,
-  0x95c000,
-  0x5c3000,
-  0x9c3000,
-  0x5d0000,
-  0x9d0000,
-  0x180000,
-  0x182000,
-  0x183000,
-  0x1a2000,
-  0x1b8000,
-  0x1c2000,
-  0x1e0000,
-  0x1e2000,
+  0x55c004,
+  0x95c004,
+  0x5c3002,
+  0x9c3002,
+  0x5d0002,
+  0x9d0002,
+  0x180002,
+  0x182002,
+  0x183002,
+  0x1a2002,
+  0x1b8002,
+  0x1c2002,
+  0x1e0002,
+  0x1e2002,
   0x39400000,
   0x39800000,
   0x39c00000,
@@ -3106,47 +3106,47 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x3d000000,
   0x3d400000,
   0x3d800000,
-  0xd5c000,
-  0x115c000,
-  0x155c000,
-  0x195c000,
-  0xdc3000,
-  0x11c3000,
-  0x15c3000,
-  0x19c3000,
-  0xdd0000,
-  0x11d0000,
-  0x15d0000,
-  0x19d0000,
-  0x580000,
-  0x980000,
-  0x582000,
-  0x982000,
-  0x583000,
-  0x983000,
-  0x5a2000,
-  0x9a2000,
-  0x5b8000,
-  0x9b8000,
-  0x5c2000,
-  0x9c2000,
-  0x5e0000,
-  0x9e0000,
-  0x5e2000,
-  0x9e2000,
-  0x199000,
-  0x1a1000,
-  0x1a7000,
-  0x1ac000,
-  0x1b0000,
-  0x1b1000,
-  0x1b3000,
-  0x1d1000,
-  0x1d8000,
-  0x1d9000,
-  0x1e3000,
-  0x1e5000,
-  0x1e6000,
+  0xd5c004,
+  0x115c004,
+  0x155c004,
+  0x195c004,
+  0xdc3002,
+  0x11c3002,
+  0x15c3002,
+  0x19c3002,
+  0xdd0002,
+  0x11d0002,
+  0x15d0002,
+  0x19d0002,
+  0x580002,
+  0x980002,
+  0x582002,
+  0x982002,
+  0x583002,
+  0x983002,
+  0x5a2002,
+  0x9a2002,
+  0x5b8002,
+  0x9b8002,
+  0x5c2002,
+  0x9c2002,
+  0x5e0002,
+  0x9e0002,
+  0x5e2002,
+  0x9e2002,
+  0x199002,
+  0x1a1002,
+  0x1a7002,
+  0x1ac002,
+  0x1b0002,
+  0x1b1002,
+  0x1b3002,
+  0x1d1002,
+  0x1d8002,
+  0x1d9002,
+  0x1e3002,
+  0x1e5002,
+  0x1e6002,
   0x41000000,
   0x41400000,
   0x41800000,
@@ -3170,114 +3170,114 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x46000000,
   0x46400000,
   0x46800000,
-  0x1d5c000,
-  0x215c000,
-  0x255c000,
-  0x295c000,
-  0x2d5c000,
-  0x315c000,
-  0x355c000,
-  0x395c000,
-  0x1dc3000,
-  0x21c3000,
-  0x25c3000,
-  0x29c3000,
-  0x2dc3000,
-  0x31c3000,
-  0x35c3000,
-  0x39c3000,
-  0x1dd0000,
-  0x21d0000,
-  0x25d0000,
-  0x29d0000,
-  0x2dd0000,
-  0x31d0000,
-  0x35d0000,
-  0x39d0000,
-  0xd80000,
-  0x1180000,
-  0x1580000,
-  0x1980000,
-  0xd82000,
-  0x1182000,
-  0x1582000,
-  0x1982000,
-  0xd83000,
-  0x1183000,
-  0x1583000,
-  0x1983000,
-  0xda2000,
-  0x11a2000,
-  0x15a2000,
-  0x19a2000,
-  0xdb8000,
-  0x11b8000,
-  0x15b8000,
-  0x19b8000,
-  0xdc2000,
-  0x11c2000,
-  0x15c2000,
-  0x19c2000,
-  0xde0000,
-  0x11e0000,
-  0x15e0000,
-  0x19e0000,
-  0xde2000,
-  0x11e2000,
-  0x15e2000,
-  0x19e2000,
-  0x599000,
-  0x999000,
-  0x5a1000,
-  0x9a1000,
-  0x5a7000,
-  0x9a7000,
-  0x5ac000,
-  0x9ac000,
-  0x5b0000,
-  0x9b0000,
-  0x5b1000,
-  0x9b1000,
-  0x5b3000,
-  0x9b3000,
-  0x5d1000,
-  0x9d1000,
-  0x5d8000,
-  0x9d8000,
-  0x5d9000,
-  0x9d9000,
-  0x5e3000,
-  0x9e3000,
-  0x5e5000,
-  0x9e5000,
-  0x5e6000,
-  0x9e6000,
-  0x181000,
-  0x184000,
-  0x185000,
-  0x186000,
-  0x188000,
-  0x192000,
-  0x19a000,
-  0x19c000,
-  0x1a0000,
-  0x1a3000,
-  0x1a4000,
-  0x1a9000,
-  0x1aa000,
-  0x1ad000,
-  0x1b2000,
-  0x1b5000,
-  0x1b9000,
-  0x1ba000,
-  0x1bb000,
-  0x1bd000,
-  0x1be000,
-  0x1c4000,
-  0x1c6000,
-  0x1e4000,
-  0x1e8000,
-  0x1e9000,
+  0x1d5c004,
+  0x215c004,
+  0x255c004,
+  0x295c004,
+  0x2d5c004,
+  0x315c004,
+  0x355c004,
+  0x395c004,
+  0x1dc3002,
+  0x21c3002,
+  0x25c3002,
+  0x29c3002,
+  0x2dc3002,
+  0x31c3002,
+  0x35c3002,
+  0x39c3002,
+  0x1dd0002,
+  0x21d0002,
+  0x25d0002,
+  0x29d0002,
+  0x2dd0002,
+  0x31d0002,
+  0x35d0002,
+  0x39d0002,
+  0xd80002,
+  0x1180002,
+  0x1580002,
+  0x1980002,
+  0xd82002,
+  0x1182002,
+  0x1582002,
+  0x1982002,
+  0xd83002,
+  0x1183002,
+  0x1583002,
+  0x1983002,
+  0xda2002,
+  0x11a2002,
+  0x15a2002,
+  0x19a2002,
+  0xdb8002,
+  0x11b8002,
+  0x15b8002,
+  0x19b8002,
+  0xdc2002,
+  0x11c2002,
+  0x15c2002,
+  0x19c2002,
+  0xde0002,
+  0x11e0002,
+  0x15e0002,
+  0x19e0002,
+  0xde2002,
+  0x11e2002,
+  0x15e2002,
+  0x19e2002,
+  0x599002,
+  0x999002,
+  0x5a1002,
+  0x9a1002,
+  0x5a7002,
+  0x9a7002,
+  0x5ac002,
+  0x9ac002,
+  0x5b0002,
+  0x9b0002,
+  0x5b1002,
+  0x9b1002,
+  0x5b3002,
+  0x9b3002,
+  0x5d1002,
+  0x9d1002,
+  0x5d8002,
+  0x9d8002,
+  0x5d9002,
+  0x9d9002,
+  0x5e3002,
+  0x9e3002,
+  0x5e5002,
+  0x9e5002,
+  0x5e6002,
+  0x9e6002,
+  0x181002,
+  0x184002,
+  0x185002,
+  0x186002,
+  0x188002,
+  0x192002,
+  0x19a002,
+  0x19c002,
+  0x1a0002,
+  0x1a3002,
+  0x1a4002,
+  0x1a9002,
+  0x1aa002,
+  0x1ad002,
+  0x1b2002,
+  0x1b5002,
+  0x1b9002,
+  0x1ba002,
+  0x1bb002,
+  0x1bd002,
+  0x1be002,
+  0x1c4002,
+  0x1c6002,
+  0x1e4002,
+  0x1e8002,
+  0x1e9002,
   0x4d400000,
   0x4d800000,
   0x4dc00000,
@@ -3346,203 +3346,203 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x80000000,
   0x80000000,
   0x80000000,
-  0x1d80000,
-  0x2180000,
-  0x2580000,
-  0x2980000,
-  0x2d80000,
-  0x3180000,
-  0x3580000,
-  0x3980000,
-  0x1d82000,
-  0x2182000,
-  0x2582000,
-  0x2982000,
-  0x2d82000,
-  0x3182000,
-  0x3582000,
-  0x3982000,
-  0x1d83000,
-  0x2183000,
-  0x2583000,
-  0x2983000,
-  0x2d83000,
-  0x3183000,
-  0x3583000,
-  0x3983000,
-  0x1da2000,
-  0x21a2000,
-  0x25a2000,
-  0x29a2000,
-  0x2da2000,
-  0x31a2000,
-  0x35a2000,
-  0x39a2000,
-  0x1db8000,
-  0x21b8000,
-  0x25b8000,
-  0x29b8000,
-  0x2db8000,
-  0x31b8000,
-  0x35b8000,
-  0x39b8000,
-  0x1dc2000,
-  0x21c2000,
-  0x25c2000,
-  0x29c2000,
-  0x2dc2000,
-  0x31c2000,
-  0x35c2000,
-  0x39c2000,
-  0x1de0000,
-  0x21e0000,
-  0x25e0000,
-  0x29e0000,
-  0x2de0000,
-  0x31e0000,
-  0x35e0000,
-  0x39e0000,
-  0x1de2000,
-  0x21e2000,
-  0x25e2000,
-  0x29e2000,
-  0x2de2000,
-  0x31e2000,
-  0x35e2000,
-  0x39e2000,
-  0xd99000,
-  0x1199000,
-  0x1599000,
-  0x1999000,
-  0xda1000,
-  0x11a1000,
-  0x15a1000,
-  0x19a1000,
-  0xda7000,
-  0x11a7000,
-  0x15a7000,
-  0x19a7000,
-  0xdac000,
-  0x11ac000,
-  0x15ac000,
-  0x19ac000,
-  0xdb0000,
-  0x11b0000,
-  0x15b0000,
-  0x19b0000,
-  0xdb1000,
-  0x11b1000,
-  0x15b1000,
-  0x19b1000,
-  0xdb3000,
-  0x11b3000,
-  0x15b3000,
-  0x19b3000,
-  0xdd1000,
-  0x11d1000,
-  0x15d1000,
-  0x19d1000,
-  0xdd8000,
-  0x11d8000,
-  0x15d8000,
-  0x19d8000,
-  0xdd9000,
-  0x11d9000,
-  0x15d9000,
-  0x19d9000,
-  0xde3000,
-  0x11e3000,
-  0x15e3000,
-  0x19e3000,
-  0xde5000,
-  0x11e5000,
-  0x15e5000,
-  0x19e5000,
-  0xde6000,
-  0x11e6000,
-  0x15e6000,
-  0x19e6000,
-  0x581000,
-  0x981000,
-  0x584000,
-  0x984000,
-  0x585000,
-  0x985000,
-  0x586000,
-  0x986000,
-  0x588000,
-  0x988000,
-  0x592000,
-  0x992000,
-  0x59a000,
-  0x99a000,
-  0x59c000,
-  0x99c000,
-  0x5a0000,
-  0x9a0000,
-  0x5a3000,
-  0x9a3000,
-  0x5a4000,
-  0x9a4000,
-  0x5a9000,
-  0x9a9000,
-  0x5aa000,
-  0x9aa000,
-  0x5ad000,
-  0x9ad000,
-  0x5b2000,
-  0x9b2000,
-  0x5b5000,
-  0x9b5000,
-  0x5b9000,
-  0x9b9000,
-  0x5ba000,
-  0x9ba000,
-  0x5bb000,
-  0x9bb000,
-  0x5bd000,
-  0x9bd000,
-  0x5be000,
-  0x9be000,
-  0x5c4000,
-  0x9c4000,
-  0x5c6000,
-  0x9c6000,
-  0x5e4000,
-  0x9e4000,
-  0x5e8000,
-  0x9e8000,
-  0x5e9000,
-  0x9e9000,
-  0x101000,
-  0x187000,
-  0x189000,
-  0x18a000,
-  0x18b000,
-  0x18c000,
-  0x18d000,
-  0x18f000,
-  0x193000,
-  0x195000,
-  0x196000,
-  0x197000,
-  0x198000,
-  0x19b000,
-  0x19d000,
-  0x19e000,
-  0x1a5000,
-  0x1a6000,
-  0x1a8000,
-  0x1ae000,
-  0x1af000,
-  0x1b4000,
-  0x1b6000,
-  0x1b7000,
-  0x1bc000,
-  0x1bf000,
-  0x1c5000,
-  0x1e7000,
-  0x1ef000,
+  0x1d80002,
+  0x2180002,
+  0x2580002,
+  0x2980002,
+  0x2d80002,
+  0x3180002,
+  0x3580002,
+  0x3980002,
+  0x1d82002,
+  0x2182002,
+  0x2582002,
+  0x2982002,
+  0x2d82002,
+  0x3182002,
+  0x3582002,
+  0x3982002,
+  0x1d83002,
+  0x2183002,
+  0x2583002,
+  0x2983002,
+  0x2d83002,
+  0x3183002,
+  0x3583002,
+  0x3983002,
+  0x1da2002,
+  0x21a2002,
+  0x25a2002,
+  0x29a2002,
+  0x2da2002,
+  0x31a2002,
+  0x35a2002,
+  0x39a2002,
+  0x1db8002,
+  0x21b8002,
+  0x25b8002,
+  0x29b8002,
+  0x2db8002,
+  0x31b8002,
+  0x35b8002,
+  0x39b8002,
+  0x1dc2002,
+  0x21c2002,
+  0x25c2002,
+  0x29c2002,
+  0x2dc2002,
+  0x31c2002,
+  0x35c2002,
+  0x39c2002,
+  0x1de0002,
+  0x21e0002,
+  0x25e0002,
+  0x29e0002,
+  0x2de0002,
+  0x31e0002,
+  0x35e0002,
+  0x39e0002,
+  0x1de2002,
+  0x21e2002,
+  0x25e2002,
+  0x29e2002,
+  0x2de2002,
+  0x31e2002,
+  0x35e2002,
+  0x39e2002,
+  0xd99002,
+  0x1199002,
+  0x1599002,
+  0x1999002,
+  0xda1002,
+  0x11a1002,
+  0x15a1002,
+  0x19a1002,
+  0xda7002,
+  0x11a7002,
+  0x15a7002,
+  0x19a7002,
+  0xdac002,
+  0x11ac002,
+  0x15ac002,
+  0x19ac002,
+  0xdb0002,
+  0x11b0002,
+  0x15b0002,
+  0x19b0002,
+  0xdb1002,
+  0x11b1002,
+  0x15b1002,
+  0x19b1002,
+  0xdb3002,
+  0x11b3002,
+  0x15b3002,
+  0x19b3002,
+  0xdd1002,
+  0x11d1002,
+  0x15d1002,
+  0x19d1002,
+  0xdd8002,
+  0x11d8002,
+  0x15d8002,
+  0x19d8002,
+  0xdd9002,
+  0x11d9002,
+  0x15d9002,
+  0x19d9002,
+  0xde3002,
+  0x11e3002,
+  0x15e3002,
+  0x19e3002,
+  0xde5002,
+  0x11e5002,
+  0x15e5002,
+  0x19e5002,
+  0xde6002,
+  0x11e6002,
+  0x15e6002,
+  0x19e6002,
+  0x581002,
+  0x981002,
+  0x584002,
+  0x984002,
+  0x585002,
+  0x985002,
+  0x586002,
+  0x986002,
+  0x588002,
+  0x988002,
+  0x592002,
+  0x992002,
+  0x59a002,
+  0x99a002,
+  0x59c002,
+  0x99c002,
+  0x5a0002,
+  0x9a0002,
+  0x5a3002,
+  0x9a3002,
+  0x5a4002,
+  0x9a4002,
+  0x5a9002,
+  0x9a9002,
+  0x5aa002,
+  0x9aa002,
+  0x5ad002,
+  0x9ad002,
+  0x5b2002,
+  0x9b2002,
+  0x5b5002,
+  0x9b5002,
+  0x5b9002,
+  0x9b9002,
+  0x5ba002,
+  0x9ba002,
+  0x5bb002,
+  0x9bb002,
+  0x5bd002,
+  0x9bd002,
+  0x5be002,
+  0x9be002,
+  0x5c4002,
+  0x9c4002,
+  0x5c6002,
+  0x9c6002,
+  0x5e4002,
+  0x9e4002,
+  0x5e8002,
+  0x9e8002,
+  0x5e9002,
+  0x9e9002,
+  0x101002,
+  0x187002,
+  0x189002,
+  0x18a002,
+  0x18b002,
+  0x18c002,
+  0x18d002,
+  0x18f002,
+  0x193002,
+  0x195002,
+  0x196002,
+  0x197002,
+  0x198002,
+  0x19b002,
+  0x19d002,
+  0x19e002,
+  0x1a5002,
+  0x1a6002,
+  0x1a8002,
+  0x1ae002,
+  0x1af002,
+  0x1b4002,
+  0x1b6002,
+  0x1b7002,
+  0x1bc002,
+  0x1bf002,
+  0x1c5002,
+  0x1e7002,
+  0x1ef002,
   0x59800000,
   0x59c00000,
   0x5a000000,
@@ -3682,284 +3682,284 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x80000000,
   0x80000000,
   0x80000000,
-  0x1d99000,
-  0x2199000,
-  0x2599000,
-  0x2999000,
-  0x2d99000,
-  0x3199000,
-  0x3599000,
-  0x3999000,
-  0x1da1000,
-  0x21a1000,
-  0x25a1000,
-  0x29a1000,
-  0x2da1000,
-  0x31a1000,
-  0x35a1000,
-  0x39a1000,
-  0x1da7000,
-  0x21a7000,
-  0x25a7000,
-  0x29a7000,
-  0x2da7000,
-  0x31a7000,
-  0x35a7000,
-  0x39a7000,
-  0x1dac000,
-  0x21ac000,
-  0x25ac000,
-  0x29ac000,
-  0x2dac000,
-  0x31ac000,
-  0x35ac000,
-  0x39ac000,
-  0x1db0000,
-  0x21b0000,
-  0x25b0000,
-  0x29b0000,
-  0x2db0000,
-  0x31b0000,
-  0x35b0000,
-  0x39b0000,
-  0x1db1000,
-  0x21b1000,
-  0x25b1000,
-  0x29b1000,
-  0x2db1000,
-  0x31b1000,
-  0x35b1000,
-  0x39b1000,
-  0x1db3000,
-  0x21b3000,
-  0x25b3000,
-  0x29b3000,
-  0x2db3000,
-  0x31b3000,
-  0x35b3000,
-  0x39b3000,
-  0x1dd1000,
-  0x21d1000,
-  0x25d1000,
-  0x29d1000,
-  0x2dd1000,
-  0x31d1000,
-  0x35d1000,
-  0x39d1000,
-  0x1dd8000,
-  0x21d8000,
-  0x25d8000,
-  0x29d8000,
-  0x2dd8000,
-  0x31d8000,
-  0x35d8000,
-  0x39d8000,
-  0x1dd9000,
-  0x21d9000,
-  0x25d9000,
-  0x29d9000,
-  0x2dd9000,
-  0x31d9000,
-  0x35d9000,
-  0x39d9000,
-  0x1de3000,
-  0x21e3000,
-  0x25e3000,
-  0x29e3000,
-  0x2de3000,
-  0x31e3000,
-  0x35e3000,
-  0x39e3000,
-  0x1de5000,
-  0x21e5000,
-  0x25e5000,
-  0x29e5000,
-  0x2de5000,
-  0x31e5000,
-  0x35e5000,
-  0x39e5000,
-  0x1de6000,
-  0x21e6000,
-  0x25e6000,
-  0x29e6000,
-  0x2de6000,
-  0x31e6000,
-  0x35e6000,
-  0x39e6000,
-  0xd81000,
-  0x1181000,
-  0x1581000,
-  0x1981000,
-  0xd84000,
-  0x1184000,
-  0x1584000,
-  0x1984000,
-  0xd85000,
-  0x1185000,
-  0x1585000,
-  0x1985000,
-  0xd86000,
-  0x1186000,
-  0x1586000,
-  0x1986000,
-  0xd88000,
-  0x1188000,
-  0x1588000,
-  0x1988000,
-  0xd92000,
-  0x1192000,
-  0x1592000,
-  0x1992000,
-  0xd9a000,
-  0x119a000,
-  0x159a000,
-  0x199a000,
-  0xd9c000,
-  0x119c000,
-  0x159c000,
-  0x199c000,
-  0xda0000,
-  0x11a0000,
-  0x15a0000,
-  0x19a0000,
-  0xda3000,
-  0x11a3000,
-  0x15a3000,
-  0x19a3000,
-  0xda4000,
-  0x11a4000,
-  0x15a4000,
-  0x19a4000,
-  0xda9000,
-  0x11a9000,
-  0x15a9000,
-  0x19a9000,
-  0xdaa000,
-  0x11aa000,
-  0x15aa000,
-  0x19aa000,
-  0xdad000,
-  0x11ad000,
-  0x15ad000,
-  0x19ad000,
-  0xdb2000,
-  0x11b2000,
-  0x15b2000,
-  0x19b2000,
-  0xdb5000,
-  0x11b5000,
-  0x15b5000,
-  0x19b5000,
-  0xdb9000,
-  0x11b9000,
-  0x15b9000,
-  0x19b9000,
-  0xdba000,
-  0x11ba000,
-  0x15ba000,
-  0x19ba000,
-  0xdbb000,
-  0x11bb000,
-  0x15bb000,
-  0x19bb000,
-  0xdbd000,
-  0x11bd000,
-  0x15bd000,
-  0x19bd000,
-  0xdbe000,
-  0x11be000,
-  0x15be000,
-  0x19be000,
-  0xdc4000,
-  0x11c4000,
-  0x15c4000,
-  0x19c4000,
-  0xdc6000,
-  0x11c6000,
-  0x15c6000,
-  0x19c6000,
-  0xde4000,
-  0x11e4000,
-  0x15e4000,
-  0x19e4000,
-  0xde8000,
-  0x11e8000,
-  0x15e8000,
-  0x19e8000,
-  0xde9000,
-  0x11e9000,
-  0x15e9000,
-  0x19e9000,
-  0x501000,
-  0x901000,
-  0x587000,
-  0x987000,
-  0x589000,
-  0x989000,
-  0x58a000,
-  0x98a000,
-  0x58b000,
-  0x98b000,
-  0x58c000,
-  0x98c000,
-  0x58d000,
-  0x98d000,
-  0x58f000,
-  0x98f000,
-  0x593000,
-  0x993000,
-  0x595000,
-  0x995000,
-  0x596000,
-  0x996000,
-  0x597000,
-  0x997000,
-  0x598000,
-  0x998000,
-  0x59b000,
-  0x99b000,
-  0x59d000,
-  0x99d000,
-  0x59e000,
-  0x99e000,
-  0x5a5000,
-  0x9a5000,
-  0x5a6000,
-  0x9a6000,
-  0x5a8000,
-  0x9a8000,
-  0x5ae000,
-  0x9ae000,
-  0x5af000,
-  0x9af000,
-  0x5b4000,
-  0x9b4000,
-  0x5b6000,
-  0x9b6000,
-  0x5b7000,
-  0x9b7000,
-  0x5bc000,
-  0x9bc000,
-  0x5bf000,
-  0x9bf000,
-  0x5c5000,
-  0x9c5000,
-  0x5e7000,
-  0x9e7000,
-  0x5ef000,
-  0x9ef000,
-  0x109000,
-  0x18e000,
-  0x190000,
-  0x191000,
-  0x194000,
-  0x19f000,
-  0x1ab000,
-  0x1ce000,
-  0x1d7000,
-  0x1e1000,
-  0x1ec000,
-  0x1ed000,
+  0x1d99002,
+  0x2199002,
+  0x2599002,
+  0x2999002,
+  0x2d99002,
+  0x3199002,
+  0x3599002,
+  0x3999002,
+  0x1da1002,
+  0x21a1002,
+  0x25a1002,
+  0x29a1002,
+  0x2da1002,
+  0x31a1002,
+  0x35a1002,
+  0x39a1002,
+  0x1da7002,
+  0x21a7002,
+  0x25a7002,
+  0x29a7002,
+  0x2da7002,
+  0x31a7002,
+  0x35a7002,
+  0x39a7002,
+  0x1dac002,
+  0x21ac002,
+  0x25ac002,
+  0x29ac002,
+  0x2dac002,
+  0x31ac002,
+  0x35ac002,
+  0x39ac002,
+  0x1db0002,
+  0x21b0002,
+  0x25b0002,
+  0x29b0002,
+  0x2db0002,
+  0x31b0002,
+  0x35b0002,
+  0x39b0002,
+  0x1db1002,
+  0x21b1002,
+  0x25b1002,
+  0x29b1002,
+  0x2db1002,
+  0x31b1002,
+  0x35b1002,
+  0x39b1002,
+  0x1db3002,
+  0x21b3002,
+  0x25b3002,
+  0x29b3002,
+  0x2db3002,
+  0x31b3002,
+  0x35b3002,
+  0x39b3002,
+  0x1dd1002,
+  0x21d1002,
+  0x25d1002,
+  0x29d1002,
+  0x2dd1002,
+  0x31d1002,
+  0x35d1002,
+  0x39d1002,
+  0x1dd8002,
+  0x21d8002,
+  0x25d8002,
+  0x29d8002,
+  0x2dd8002,
+  0x31d8002,
+  0x35d8002,
+  0x39d8002,
+  0x1dd9002,
+  0x21d9002,
+  0x25d9002,
+  0x29d9002,
+  0x2dd9002,
+  0x31d9002,
+  0x35d9002,
+  0x39d9002,
+  0x1de3002,
+  0x21e3002,
+  0x25e3002,
+  0x29e3002,
+  0x2de3002,
+  0x31e3002,
+  0x35e3002,
+  0x39e3002,
+  0x1de5002,
+  0x21e5002,
+  0x25e5002,
+  0x29e5002,
+  0x2de5002,
+  0x31e5002,
+  0x35e5002,
+  0x39e5002,
+  0x1de6002,
+  0x21e6002,
+  0x25e6002,
+  0x29e6002,
+  0x2de6002,
+  0x31e6002,
+  0x35e6002,
+  0x39e6002,
+  0xd81002,
+  0x1181002,
+  0x1581002,
+  0x1981002,
+  0xd84002,
+  0x1184002,
+  0x1584002,
+  0x1984002,
+  0xd85002,
+  0x1185002,
+  0x1585002,
+  0x1985002,
+  0xd86002,
+  0x1186002,
+  0x1586002,
+  0x1986002,
+  0xd88002,
+  0x1188002,
+  0x1588002,
+  0x1988002,
+  0xd92002,
+  0x1192002,
+  0x1592002,
+  0x1992002,
+  0xd9a002,
+  0x119a002,
+  0x159a002,
+  0x199a002,
+  0xd9c002,
+  0x119c002,
+  0x159c002,
+  0x199c002,
+  0xda0002,
+  0x11a0002,
+  0x15a0002,
+  0x19a0002,
+  0xda3002,
+  0x11a3002,
+  0x15a3002,
+  0x19a3002,
+  0xda4002,
+  0x11a4002,
+  0x15a4002,
+  0x19a4002,
+  0xda9002,
+  0x11a9002,
+  0x15a9002,
+  0x19a9002,
+  0xdaa002,
+  0x11aa002,
+  0x15aa002,
+  0x19aa002,
+  0xdad002,
+  0x11ad002,
+  0x15ad002,
+  0x19ad002,
+  0xdb2002,
+  0x11b2002,
+  0x15b2002,
+  0x19b2002,
+  0xdb5002,
+  0x11b5002,
+  0x15b5002,
+  0x19b5002,
+  0xdb9002,
+  0x11b9002,
+  0x15b9002,
+  0x19b9002,
+  0xdba002,
+  0x11ba002,
+  0x15ba002,
+  0x19ba002,
+  0xdbb002,
+  0x11bb002,
+  0x15bb002,
+  0x19bb002,
+  0xdbd002,
+  0x11bd002,
+  0x15bd002,
+  0x19bd002,
+  0xdbe002,
+  0x11be002,
+  0x15be002,
+  0x19be002,
+  0xdc4002,
+  0x11c4002,
+  0x15c4002,
+  0x19c4002,
+  0xdc6002,
+  0x11c6002,
+  0x15c6002,
+  0x19c6002,
+  0xde4002,
+  0x11e4002,
+  0x15e4002,
+  0x19e4002,
+  0xde8002,
+  0x11e8002,
+  0x15e8002,
+  0x19e8002,
+  0xde9002,
+  0x11e9002,
+  0x15e9002,
+  0x19e9002,
+  0x501002,
+  0x901002,
+  0x587002,
+  0x987002,
+  0x589002,
+  0x989002,
+  0x58a002,
+  0x98a002,
+  0x58b002,
+  0x98b002,
+  0x58c002,
+  0x98c002,
+  0x58d002,
+  0x98d002,
+  0x58f002,
+  0x98f002,
+  0x593002,
+  0x993002,
+  0x595002,
+  0x995002,
+  0x596002,
+  0x996002,
+  0x597002,
+  0x997002,
+  0x598002,
+  0x998002,
+  0x59b002,
+  0x99b002,
+  0x59d002,
+  0x99d002,
+  0x59e002,
+  0x99e002,
+  0x5a5002,
+  0x9a5002,
+  0x5a6002,
+  0x9a6002,
+  0x5a8002,
+  0x9a8002,
+  0x5ae002,
+  0x9ae002,
+  0x5af002,
+  0x9af002,
+  0x5b4002,
+  0x9b4002,
+  0x5b6002,
+  0x9b6002,
+  0x5b7002,
+  0x9b7002,
+  0x5bc002,
+  0x9bc002,
+  0x5bf002,
+  0x9bf002,
+  0x5c5002,
+  0x9c5002,
+  0x5e7002,
+  0x9e7002,
+  0x5ef002,
+  0x9ef002,
+  0x109002,
+  0x18e002,
+  0x190002,
+  0x191002,
+  0x194002,
+  0x19f002,
+  0x1ab002,
+  0x1ce002,
+  0x1d7002,
+  0x1e1002,
+  0x1ec002,
+  0x1ed002,
   0x5f400000,
   0x5f800000,
   0x5fc00000,
@@ -4178,358 +4178,358 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x80000000,
   0x80000000,
   0x80000000,
-  0x1d81000,
-  0x2181000,
-  0x2581000,
-  0x2981000,
-  0x2d81000,
-  0x3181000,
-  0x3581000,
-  0x3981000,
-  0x1d84000,
-  0x2184000,
-  0x2584000,
-  0x2984000,
-  0x2d84000,
-  0x3184000,
-  0x3584000,
-  0x3984000,
-  0x1d85000,
-  0x2185000,
-  0x2585000,
-  0x2985000,
-  0x2d85000,
-  0x3185000,
-  0x3585000,
-  0x3985000,
-  0x1d86000,
-  0x2186000,
-  0x2586000,
-  0x2986000,
-  0x2d86000,
-  0x3186000,
-  0x3586000,
-  0x3986000,
-  0x1d88000,
-  0x2188000,
-  0x2588000,
-  0x2988000,
-  0x2d88000,
-  0x3188000,
-  0x3588000,
-  0x3988000,
-  0x1d92000,
-  0x2192000,
-  0x2592000,
-  0x2992000,
-  0x2d92000,
-  0x3192000,
-  0x3592000,
-  0x3992000,
-  0x1d9a000,
-  0x219a000,
-  0x259a000,
-  0x299a000,
-  0x2d9a000,
-  0x319a000,
-  0x359a000,
-  0x399a000,
-  0x1d9c000,
-  0x219c000,
-  0x259c000,
-  0x299c000,
-  0x2d9c000,
-  0x319c000,
-  0x359c000,
-  0x399c000,
-  0x1da0000,
-  0x21a0000,
-  0x25a0000,
-  0x29a0000,
-  0x2da0000,
-  0x31a0000,
-  0x35a0000,
-  0x39a0000,
-  0x1da3000,
-  0x21a3000,
-  0x25a3000,
-  0x29a3000,
-  0x2da3000,
-  0x31a3000,
-  0x35a3000,
-  0x39a3000,
-  0x1da4000,
-  0x21a4000,
-  0x25a4000,
-  0x29a4000,
-  0x2da4000,
-  0x31a4000,
-  0x35a4000,
-  0x39a4000,
-  0x1da9000,
-  0x21a9000,
-  0x25a9000,
-  0x29a9000,
-  0x2da9000,
-  0x31a9000,
-  0x35a9000,
-  0x39a9000,
-  0x1daa000,
-  0x21aa000,
-  0x25aa000,
-  0x29aa000,
-  0x2daa000,
-  0x31aa000,
-  0x35aa000,
-  0x39aa000,
-  0x1dad000,
-  0x21ad000,
-  0x25ad000,
-  0x29ad000,
-  0x2dad000,
-  0x31ad000,
-  0x35ad000,
-  0x39ad000,
-  0x1db2000,
-  0x21b2000,
-  0x25b2000,
-  0x29b2000,
-  0x2db2000,
-  0x31b2000,
-  0x35b2000,
-  0x39b2000,
-  0x1db5000,
-  0x21b5000,
-  0x25b5000,
-  0x29b5000,
-  0x2db5000,
-  0x31b5000,
-  0x35b5000,
-  0x39b5000,
-  0x1db9000,
-  0x21b9000,
-  0x25b9000,
-  0x29b9000,
-  0x2db9000,
-  0x31b9000,
-  0x35b9000,
-  0x39b9000,
-  0x1dba000,
-  0x21ba000,
-  0x25ba000,
-  0x29ba000,
-  0x2dba000,
-  0x31ba000,
-  0x35ba000,
-  0x39ba000,
-  0x1dbb000,
-  0x21bb000,
-  0x25bb000,
-  0x29bb000,
-  0x2dbb000,
-  0x31bb000,
-  0x35bb000,
-  0x39bb000,
-  0x1dbd000,
-  0x21bd000,
-  0x25bd000,
-  0x29bd000,
-  0x2dbd000,
-  0x31bd000,
-  0x35bd000,
-  0x39bd000,
-  0x1dbe000,
-  0x21be000,
-  0x25be000,
-  0x29be000,
-  0x2dbe000,
-  0x31be000,
-  0x35be000,
-  0x39be000,
-  0x1dc4000,
-  0x21c4000,
-  0x25c4000,
-  0x29c4000,
-  0x2dc4000,
-  0x31c4000,
-  0x35c4000,
-  0x39c4000,
-  0x1dc6000,
-  0x21c6000,
-  0x25c6000,
-  0x29c6000,
-  0x2dc6000,
-  0x31c6000,
-  0x35c6000,
-  0x39c6000,
-  0x1de4000,
-  0x21e4000,
-  0x25e4000,
-  0x29e4000,
-  0x2de4000,
-  0x31e4000,
-  0x35e4000,
-  0x39e4000,
-  0x1de8000,
-  0x21e8000,
-  0x25e8000,
-  0x29e8000,
-  0x2de8000,
-  0x31e8000,
-  0x35e8000,
-  0x39e8000,
-  0x1de9000,
-  0x21e9000,
-  0x25e9000,
-  0x29e9000,
-  0x2de9000,
-  0x31e9000,
-  0x35e9000,
-  0x39e9000,
-  0xd01000,
-  0x1101000,
-  0x1501000,
-  0x1901000,
-  0xd87000,
-  0x1187000,
-  0x1587000,
-  0x1987000,
-  0xd89000,
-  0x1189000,
-  0x1589000,
-  0x1989000,
-  0xd8a000,
-  0x118a000,
-  0x158a000,
-  0x198a000,
-  0xd8b000,
-  0x118b000,
-  0x158b000,
-  0x198b000,
-  0xd8c000,
-  0x118c000,
-  0x158c000,
-  0x198c000,
-  0xd8d000,
-  0x118d000,
-  0x158d000,
-  0x198d000,
-  0xd8f000,
-  0x118f000,
-  0x158f000,
-  0x198f000,
-  0xd93000,
-  0x1193000,
-  0x1593000,
-  0x1993000,
-  0xd95000,
-  0x1195000,
-  0x1595000,
-  0x1995000,
-  0xd96000,
-  0x1196000,
-  0x1596000,
-  0x1996000,
-  0xd97000,
-  0x1197000,
-  0x1597000,
-  0x1997000,
-  0xd98000,
-  0x1198000,
-  0x1598000,
-  0x1998000,
-  0xd9b000,
-  0x119b000,
-  0x159b000,
-  0x199b000,
-  0xd9d000,
-  0x119d000,
-  0x159d000,
-  0x199d000,
-  0xd9e000,
-  0x119e000,
-  0x159e000,
-  0x199e000,
-  0xda5000,
-  0x11a5000,
-  0x15a5000,
-  0x19a5000,
-  0xda6000,
-  0x11a6000,
-  0x15a6000,
-  0x19a6000,
-  0xda8000,
-  0x11a8000,
-  0x15a8000,
-  0x19a8000,
-  0xdae000,
-  0x11ae000,
-  0x15ae000,
-  0x19ae000,
-  0xdaf000,
-  0x11af000,
-  0x15af000,
-  0x19af000,
-  0xdb4000,
-  0x11b4000,
-  0x15b4000,
-  0x19b4000,
-  0xdb6000,
-  0x11b6000,
-  0x15b6000,
-  0x19b6000,
-  0xdb7000,
-  0x11b7000,
-  0x15b7000,
-  0x19b7000,
-  0xdbc000,
-  0x11bc000,
-  0x15bc000,
-  0x19bc000,
-  0xdbf000,
-  0x11bf000,
-  0x15bf000,
-  0x19bf000,
-  0xdc5000,
-  0x11c5000,
-  0x15c5000,
-  0x19c5000,
-  0xde7000,
-  0x11e7000,
-  0x15e7000,
-  0x19e7000,
-  0xdef000,
-  0x11ef000,
-  0x15ef000,
-  0x19ef000,
-  0x509000,
-  0x909000,
-  0x58e000,
-  0x98e000,
-  0x590000,
-  0x990000,
-  0x591000,
-  0x991000,
-  0x594000,
-  0x994000,
-  0x59f000,
-  0x99f000,
-  0x5ab000,
-  0x9ab000,
-  0x5ce000,
-  0x9ce000,
-  0x5d7000,
-  0x9d7000,
-  0x5e1000,
-  0x9e1000,
-  0x5ec000,
-  0x9ec000,
-  0x5ed000,
-  0x9ed000,
-  0x1c7000,
-  0x1cf000,
-  0x1ea000,
-  0x1eb000,
+  0x1d81002,
+  0x2181002,
+  0x2581002,
+  0x2981002,
+  0x2d81002,
+  0x3181002,
+  0x3581002,
+  0x3981002,
+  0x1d84002,
+  0x2184002,
+  0x2584002,
+  0x2984002,
+  0x2d84002,
+  0x3184002,
+  0x3584002,
+  0x3984002,
+  0x1d85002,
+  0x2185002,
+  0x2585002,
+  0x2985002,
+  0x2d85002,
+  0x3185002,
+  0x3585002,
+  0x3985002,
+  0x1d86002,
+  0x2186002,
+  0x2586002,
+  0x2986002,
+  0x2d86002,
+  0x3186002,
+  0x3586002,
+  0x3986002,
+  0x1d88002,
+  0x2188002,
+  0x2588002,
+  0x2988002,
+  0x2d88002,
+  0x3188002,
+  0x3588002,
+  0x3988002,
+  0x1d92002,
+  0x2192002,
+  0x2592002,
+  0x2992002,
+  0x2d92002,
+  0x3192002,
+  0x3592002,
+  0x3992002,
+  0x1d9a002,
+  0x219a002,
+  0x259a002,
+  0x299a002,
+  0x2d9a002,
+  0x319a002,
+  0x359a002,
+  0x399a002,
+  0x1d9c002,
+  0x219c002,
+  0x259c002,
+  0x299c002,
+  0x2d9c002,
+  0x319c002,
+  0x359c002,
+  0x399c002,
+  0x1da0002,
+  0x21a0002,
+  0x25a0002,
+  0x29a0002,
+  0x2da0002,
+  0x31a0002,
+  0x35a0002,
+  0x39a0002,
+  0x1da3002,
+  0x21a3002,
+  0x25a3002,
+  0x29a3002,
+  0x2da3002,
+  0x31a3002,
+  0x35a3002,
+  0x39a3002,
+  0x1da4002,
+  0x21a4002,
+  0x25a4002,
+  0x29a4002,
+  0x2da4002,
+  0x31a4002,
+  0x35a4002,
+  0x39a4002,
+  0x1da9002,
+  0x21a9002,
+  0x25a9002,
+  0x29a9002,
+  0x2da9002,
+  0x31a9002,
+  0x35a9002,
+  0x39a9002,
+  0x1daa002,
+  0x21aa002,
+  0x25aa002,
+  0x29aa002,
+  0x2daa002,
+  0x31aa002,
+  0x35aa002,
+  0x39aa002,
+  0x1dad002,
+  0x21ad002,
+  0x25ad002,
+  0x29ad002,
+  0x2dad002,
+  0x31ad002,
+  0x35ad002,
+  0x39ad002,
+  0x1db2002,
+  0x21b2002,
+  0x25b2002,
+  0x29b2002,
+  0x2db2002,
+  0x31b2002,
+  0x35b2002,
+  0x39b2002,
+  0x1db5002,
+  0x21b5002,
+  0x25b5002,
+  0x29b5002,
+  0x2db5002,
+  0x31b5002,
+  0x35b5002,
+  0x39b5002,
+  0x1db9002,
+  0x21b9002,
+  0x25b9002,
+  0x29b9002,
+  0x2db9002,
+  0x31b9002,
+  0x35b9002,
+  0x39b9002,
+  0x1dba002,
+  0x21ba002,
+  0x25ba002,
+  0x29ba002,
+  0x2dba002,
+  0x31ba002,
+  0x35ba002,
+  0x39ba002,
+  0x1dbb002,
+  0x21bb002,
+  0x25bb002,
+  0x29bb002,
+  0x2dbb002,
+  0x31bb002,
+  0x35bb002,
+  0x39bb002,
+  0x1dbd002,
+  0x21bd002,
+  0x25bd002,
+  0x29bd002,
+  0x2dbd002,
+  0x31bd002,
+  0x35bd002,
+  0x39bd002,
+  0x1dbe002,
+  0x21be002,
+  0x25be002,
+  0x29be002,
+  0x2dbe002,
+  0x31be002,
+  0x35be002,
+  0x39be002,
+  0x1dc4002,
+  0x21c4002,
+  0x25c4002,
+  0x29c4002,
+  0x2dc4002,
+  0x31c4002,
+  0x35c4002,
+  0x39c4002,
+  0x1dc6002,
+  0x21c6002,
+  0x25c6002,
+  0x29c6002,
+  0x2dc6002,
+  0x31c6002,
+  0x35c6002,
+  0x39c6002,
+  0x1de4002,
+  0x21e4002,
+  0x25e4002,
+  0x29e4002,
+  0x2de4002,
+  0x31e4002,
+  0x35e4002,
+  0x39e4002,
+  0x1de8002,
+  0x21e8002,
+  0x25e8002,
+  0x29e8002,
+  0x2de8002,
+  0x31e8002,
+  0x35e8002,
+  0x39e8002,
+  0x1de9002,
+  0x21e9002,
+  0x25e9002,
+  0x29e9002,
+  0x2de9002,
+  0x31e9002,
+  0x35e9002,
+  0x39e9002,
+  0xd01002,
+  0x1101002,
+  0x1501002,
+  0x1901002,
+  0xd87002,
+  0x1187002,
+  0x1587002,
+  0x1987002,
+  0xd89002,
+  0x1189002,
+  0x1589002,
+  0x1989002,
+  0xd8a002,
+  0x118a002,
+  0x158a002,
+  0x198a002,
+  0xd8b002,
+  0x118b002,
+  0x158b002,
+  0x198b002,
+  0xd8c002,
+  0x118c002,
+  0x158c002,
+  0x198c002,
+  0xd8d002,
+  0x118d002,
+  0x158d002,
+  0x198d002,
+  0xd8f002,
+  0x118f002,
+  0x158f002,
+  0x198f002,
+  0xd93002,
+  0x1193002,
+  0x1593002,
+  0x1993002,
+  0xd95002,
+  0x1195002,
+  0x1595002,
+  0x1995002,
+  0xd96002,
+  0x1196002,
+  0x1596002,
+  0x1996002,
+  0xd97002,
+  0x1197002,
+  0x1597002,
+  0x1997002,
+  0xd98002,
+  0x1198002,
+  0x1598002,
+  0x1998002,
+  0xd9b002,
+  0x119b002,
+  0x159b002,
+  0x199b002,
+  0xd9d002,
+  0x119d002,
+  0x159d002,
+  0x199d002,
+  0xd9e002,
+  0x119e002,
+  0x159e002,
+  0x199e002,
+  0xda5002,
+  0x11a5002,
+  0x15a5002,
+  0x19a5002,
+  0xda6002,
+  0x11a6002,
+  0x15a6002,
+  0x19a6002,
+  0xda8002,
+  0x11a8002,
+  0x15a8002,
+  0x19a8002,
+  0xdae002,
+  0x11ae002,
+  0x15ae002,
+  0x19ae002,
+  0xdaf002,
+  0x11af002,
+  0x15af002,
+  0x19af002,
+  0xdb4002,
+  0x11b4002,
+  0x15b4002,
+  0x19b4002,
+  0xdb6002,
+  0x11b6002,
+  0x15b6002,
+  0x19b6002,
+  0xdb7002,
+  0x11b7002,
+  0x15b7002,
+  0x19b7002,
+  0xdbc002,
+  0x11bc002,
+  0x15bc002,
+  0x19bc002,
+  0xdbf002,
+  0x11bf002,
+  0x15bf002,
+  0x19bf002,
+  0xdc5002,
+  0x11c5002,
+  0x15c5002,
+  0x19c5002,
+  0xde7002,
+  0x11e7002,
+  0x15e7002,
+  0x19e7002,
+  0xdef002,
+  0x11ef002,
+  0x15ef002,
+  0x19ef002,
+  0x509002,
+  0x909002,
+  0x58e002,
+  0x98e002,
+  0x590002,
+  0x990002,
+  0x591002,
+  0x991002,
+  0x594002,
+  0x994002,
+  0x59f002,
+  0x99f002,
+  0x5ab002,
+  0x9ab002,
+  0x5ce002,
+  0x9ce002,
+  0x5d7002,
+  0x9d7002,
+  0x5e1002,
+  0x9e1002,
+  0x5ec002,
+  0x9ec002,
+  0x5ed002,
+  0x9ed002,
+  0x1c7002,
+  0x1cf002,
+  0x1ea002,
+  0x1eb002,
   0x62c00000,
   0x63000000,
   0x63400000,
@@ -4962,309 +4962,309 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x80000000,
   0x80000000,
   0x80000000,
-  0x1d01000,
-  0x2101000,
-  0x2501000,
-  0x2901000,
-  0x2d01000,
-  0x3101000,
-  0x3501000,
-  0x3901000,
-  0x1d87000,
-  0x2187000,
-  0x2587000,
-  0x2987000,
-  0x2d87000,
-  0x3187000,
-  0x3587000,
-  0x3987000,
-  0x1d89000,
-  0x2189000,
-  0x2589000,
-  0x2989000,
-  0x2d89000,
-  0x3189000,
-  0x3589000,
-  0x3989000,
-  0x1d8a000,
-  0x218a000,
-  0x258a000,
-  0x298a000,
-  0x2d8a000,
-  0x318a000,
-  0x358a000,
-  0x398a000,
-  0x1d8b000,
-  0x218b000,
-  0x258b000,
-  0x298b000,
-  0x2d8b000,
-  0x318b000,
-  0x358b000,
-  0x398b000,
-  0x1d8c000,
-  0x218c000,
-  0x258c000,
-  0x298c000,
-  0x2d8c000,
-  0x318c000,
-  0x358c000,
-  0x398c000,
-  0x1d8d000,
-  0x218d000,
-  0x258d000,
-  0x298d000,
-  0x2d8d000,
-  0x318d000,
-  0x358d000,
-  0x398d000,
-  0x1d8f000,
-  0x218f000,
-  0x258f000,
-  0x298f000,
-  0x2d8f000,
-  0x318f000,
-  0x358f000,
-  0x398f000,
-  0x1d93000,
-  0x2193000,
-  0x2593000,
-  0x2993000,
-  0x2d93000,
-  0x3193000,
-  0x3593000,
-  0x3993000,
-  0x1d95000,
-  0x2195000,
-  0x2595000,
-  0x2995000,
-  0x2d95000,
-  0x3195000,
-  0x3595000,
-  0x3995000,
-  0x1d96000,
-  0x2196000,
-  0x2596000,
-  0x2996000,
-  0x2d96000,
-  0x3196000,
-  0x3596000,
-  0x3996000,
-  0x1d97000,
-  0x2197000,
-  0x2597000,
-  0x2997000,
-  0x2d97000,
-  0x3197000,
-  0x3597000,
-  0x3997000,
-  0x1d98000,
-  0x2198000,
-  0x2598000,
-  0x2998000,
-  0x2d98000,
-  0x3198000,
-  0x3598000,
-  0x3998000,
-  0x1d9b000,
-  0x219b000,
-  0x259b000,
-  0x299b000,
-  0x2d9b000,
-  0x319b000,
-  0x359b000,
-  0x399b000,
-  0x1d9d000,
-  0x219d000,
-  0x259d000,
-  0x299d000,
-  0x2d9d000,
-  0x319d000,
-  0x359d000,
-  0x399d000,
-  0x1d9e000,
-  0x219e000,
-  0x259e000,
-  0x299e000,
-  0x2d9e000,
-  0x319e000,
-  0x359e000,
-  0x399e000,
-  0x1da5000,
-  0x21a5000,
-  0x25a5000,
-  0x29a5000,
-  0x2da5000,
-  0x31a5000,
-  0x35a5000,
-  0x39a5000,
-  0x1da6000,
-  0x21a6000,
-  0x25a6000,
-  0x29a6000,
-  0x2da6000,
-  0x31a6000,
-  0x35a6000,
-  0x39a6000,
-  0x1da8000,
-  0x21a8000,
-  0x25a8000,
-  0x29a8000,
-  0x2da8000,
-  0x31a8000,
-  0x35a8000,
-  0x39a8000,
-  0x1dae000,
-  0x21ae000,
-  0x25ae000,
-  0x29ae000,
-  0x2dae000,
-  0x31ae000,
-  0x35ae000,
-  0x39ae000,
-  0x1daf000,
-  0x21af000,
-  0x25af000,
-  0x29af000,
-  0x2daf000,
-  0x31af000,
-  0x35af000,
-  0x39af000,
-  0x1db4000,
-  0x21b4000,
-  0x25b4000,
-  0x29b4000,
-  0x2db4000,
-  0x31b4000,
-  0x35b4000,
-  0x39b4000,
-  0x1db6000,
-  0x21b6000,
-  0x25b6000,
-  0x29b6000,
-  0x2db6000,
-  0x31b6000,
-  0x35b6000,
-  0x39b6000,
-  0x1db7000,
-  0x21b7000,
-  0x25b7000,
-  0x29b7000,
-  0x2db7000,
-  0x31b7000,
-  0x35b7000,
-  0x39b7000,
-  0x1dbc000,
-  0x21bc000,
-  0x25bc000,
-  0x29bc000,
-  0x2dbc000,
-  0x31bc000,
-  0x35bc000,
-  0x39bc000,
-  0x1dbf000,
-  0x21bf000,
-  0x25bf000,
-  0x29bf000,
-  0x2dbf000,
-  0x31bf000,
-  0x35bf000,
-  0x39bf000,
-  0x1dc5000,
-  0x21c5000,
-  0x25c5000,
-  0x29c5000,
-  0x2dc5000,
-  0x31c5000,
-  0x35c5000,
-  0x39c5000,
-  0x1de7000,
-  0x21e7000,
-  0x25e7000,
-  0x29e7000,
-  0x2de7000,
-  0x31e7000,
-  0x35e7000,
-  0x39e7000,
-  0x1def000,
-  0x21ef000,
-  0x25ef000,
-  0x29ef000,
-  0x2def000,
-  0x31ef000,
-  0x35ef000,
-  0x39ef000,
-  0xd09000,
-  0x1109000,
-  0x1509000,
-  0x1909000,
-  0xd8e000,
-  0x118e000,
-  0x158e000,
-  0x198e000,
-  0xd90000,
-  0x1190000,
-  0x1590000,
-  0x1990000,
-  0xd91000,
-  0x1191000,
-  0x1591000,
-  0x1991000,
-  0xd94000,
-  0x1194000,
-  0x1594000,
-  0x1994000,
-  0xd9f000,
-  0x119f000,
-  0x159f000,
-  0x199f000,
-  0xdab000,
-  0x11ab000,
-  0x15ab000,
-  0x19ab000,
-  0xdce000,
-  0x11ce000,
-  0x15ce000,
-  0x19ce000,
-  0xdd7000,
-  0x11d7000,
-  0x15d7000,
-  0x19d7000,
-  0xde1000,
-  0x11e1000,
-  0x15e1000,
-  0x19e1000,
-  0xdec000,
-  0x11ec000,
-  0x15ec000,
-  0x19ec000,
-  0xded000,
-  0x11ed000,
-  0x15ed000,
-  0x19ed000,
-  0x5c7000,
-  0x9c7000,
-  0x5cf000,
-  0x9cf000,
-  0x5ea000,
-  0x9ea000,
-  0x5eb000,
-  0x9eb000,
-  0x1c0000,
-  0x1c1000,
-  0x1c8000,
-  0x1c9000,
-  0x1ca000,
-  0x1cd000,
-  0x1d2000,
-  0x1d5000,
-  0x1da000,
-  0x1db000,
-  0x1ee000,
-  0x1f0000,
-  0x1f2000,
-  0x1f3000,
-  0x1ff000,
+  0x1d01002,
+  0x2101002,
+  0x2501002,
+  0x2901002,
+  0x2d01002,
+  0x3101002,
+  0x3501002,
+  0x3901002,
+  0x1d87002,
+  0x2187002,
+  0x2587002,
+  0x2987002,
+  0x2d87002,
+  0x3187002,
+  0x3587002,
+  0x3987002,
+  0x1d89002,
+  0x2189002,
+  0x2589002,
+  0x2989002,
+  0x2d89002,
+  0x3189002,
+  0x3589002,
+  0x3989002,
+  0x1d8a002,
+  0x218a002,
+  0x258a002,
+  0x298a002,
+  0x2d8a002,
+  0x318a002,
+  0x358a002,
+  0x398a002,
+  0x1d8b002,
+  0x218b002,
+  0x258b002,
+  0x298b002,
+  0x2d8b002,
+  0x318b002,
+  0x358b002,
+  0x398b002,
+  0x1d8c002,
+  0x218c002,
+  0x258c002,
+  0x298c002,
+  0x2d8c002,
+  0x318c002,
+  0x358c002,
+  0x398c002,
+  0x1d8d002,
+  0x218d002,
+  0x258d002,
+  0x298d002,
+  0x2d8d002,
+  0x318d002,
+  0x358d002,
+  0x398d002,
+  0x1d8f002,
+  0x218f002,
+  0x258f002,
+  0x298f002,
+  0x2d8f002,
+  0x318f002,
+  0x358f002,
+  0x398f002,
+  0x1d93002,
+  0x2193002,
+  0x2593002,
+  0x2993002,
+  0x2d93002,
+  0x3193002,
+  0x3593002,
+  0x3993002,
+  0x1d95002,
+  0x2195002,
+  0x2595002,
+  0x2995002,
+  0x2d95002,
+  0x3195002,
+  0x3595002,
+  0x3995002,
+  0x1d96002,
+  0x2196002,
+  0x2596002,
+  0x2996002,
+  0x2d96002,
+  0x3196002,
+  0x3596002,
+  0x3996002,
+  0x1d97002,
+  0x2197002,
+  0x2597002,
+  0x2997002,
+  0x2d97002,
+  0x3197002,
+  0x3597002,
+  0x3997002,
+  0x1d98002,
+  0x2198002,
+  0x2598002,
+  0x2998002,
+  0x2d98002,
+  0x3198002,
+  0x3598002,
+  0x3998002,
+  0x1d9b002,
+  0x219b002,
+  0x259b002,
+  0x299b002,
+  0x2d9b002,
+  0x319b002,
+  0x359b002,
+  0x399b002,
+  0x1d9d002,
+  0x219d002,
+  0x259d002,
+  0x299d002,
+  0x2d9d002,
+  0x319d002,
+  0x359d002,
+  0x399d002,
+  0x1d9e002,
+  0x219e002,
+  0x259e002,
+  0x299e002,
+  0x2d9e002,
+  0x319e002,
+  0x359e002,
+  0x399e002,
+  0x1da5002,
+  0x21a5002,
+  0x25a5002,
+  0x29a5002,
+  0x2da5002,
+  0x31a5002,
+  0x35a5002,
+  0x39a5002,
+  0x1da6002,
+  0x21a6002,
+  0x25a6002,
+  0x29a6002,
+  0x2da6002,
+  0x31a6002,
+  0x35a6002,
+  0x39a6002,
+  0x1da8002,
+  0x21a8002,
+  0x25a8002,
+  0x29a8002,
+  0x2da8002,
+  0x31a8002,
+  0x35a8002,
+  0x39a8002,
+  0x1dae002,
+  0x21ae002,
+  0x25ae002,
+  0x29ae002,
+  0x2dae002,
+  0x31ae002,
+  0x35ae002,
+  0x39ae002,
+  0x1daf002,
+  0x21af002,
+  0x25af002,
+  0x29af002,
+  0x2daf002,
+  0x31af002,
+  0x35af002,
+  0x39af002,
+  0x1db4002,
+  0x21b4002,
+  0x25b4002,
+  0x29b4002,
+  0x2db4002,
+  0x31b4002,
+  0x35b4002,
+  0x39b4002,
+  0x1db6002,
+  0x21b6002,
+  0x25b6002,
+  0x29b6002,
+  0x2db6002,
+  0x31b6002,
+  0x35b6002,
+  0x39b6002,
+  0x1db7002,
+  0x21b7002,
+  0x25b7002,
+  0x29b7002,
+  0x2db7002,
+  0x31b7002,
+  0x35b7002,
+  0x39b7002,
+  0x1dbc002,
+  0x21bc002,
+  0x25bc002,
+  0x29bc002,
+  0x2dbc002,
+  0x31bc002,
+  0x35bc002,
+  0x39bc002,
+  0x1dbf002,
+  0x21bf002,
+  0x25bf002,
+  0x29bf002,
+  0x2dbf002,
+  0x31bf002,
+  0x35bf002,
+  0x39bf002,
+  0x1dc5002,
+  0x21c5002,
+  0x25c5002,
+  0x29c5002,
+  0x2dc5002,
+  0x31c5002,
+  0x35c5002,
+  0x39c5002,
+  0x1de7002,
+  0x21e7002,
+  0x25e7002,
+  0x29e7002,
+  0x2de7002,
+  0x31e7002,
+  0x35e7002,
+  0x39e7002,
+  0x1def002,
+  0x21ef002,
+  0x25ef002,
+  0x29ef002,
+  0x2def002,
+  0x31ef002,
+  0x35ef002,
+  0x39ef002,
+  0xd09002,
+  0x1109002,
+  0x1509002,
+  0x1909002,
+  0xd8e002,
+  0x118e002,
+  0x158e002,
+  0x198e002,
+  0xd90002,
+  0x1190002,
+  0x1590002,
+  0x1990002,
+  0xd91002,
+  0x1191002,
+  0x1591002,
+  0x1991002,
+  0xd94002,
+  0x1194002,
+  0x1594002,
+  0x1994002,
+  0xd9f002,
+  0x119f002,
+  0x159f002,
+  0x199f002,
+  0xdab002,
+  0x11ab002,
+  0x15ab002,
+  0x19ab002,
+  0xdce002,
+  0x11ce002,
+  0x15ce002,
+  0x19ce002,
+  0xdd7002,
+  0x11d7002,
+  0x15d7002,
+  0x19d7002,
+  0xde1002,
+  0x11e1002,
+  0x15e1002,
+  0x19e1002,
+  0xdec002,
+  0x11ec002,
+  0x15ec002,
+  0x19ec002,
+  0xded002,
+  0x11ed002,
+  0x15ed002,
+  0x19ed002,
+  0x5c7002,
+  0x9c7002,
+  0x5cf002,
+  0x9cf002,
+  0x5ea002,
+  0x9ea002,
+  0x5eb002,
+  0x9eb002,
+  0x1c0002,
+  0x1c1002,
+  0x1c8002,
+  0x1c9002,
+  0x1ca002,
+  0x1cd002,
+  0x1d2002,
+  0x1d5002,
+  0x1da002,
+  0x1db002,
+  0x1ee002,
+  0x1f0002,
+  0x1f2002,
+  0x1f3002,
+  0x1ff002,
   0x6a800000,
   0x6ac00000,
   0x6b000000,
@@ -5746,167 +5746,167 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x80000000,
   0x80000000,
   0x80000000,
-  0x1d09000,
-  0x2109000,
-  0x2509000,
-  0x2909000,
-  0x2d09000,
-  0x3109000,
-  0x3509000,
-  0x3909000,
-  0x1d8e000,
-  0x218e000,
-  0x258e000,
-  0x298e000,
-  0x2d8e000,
-  0x318e000,
-  0x358e000,
-  0x398e000,
-  0x1d90000,
-  0x2190000,
-  0x2590000,
-  0x2990000,
-  0x2d90000,
-  0x3190000,
-  0x3590000,
-  0x3990000,
-  0x1d91000,
-  0x2191000,
-  0x2591000,
-  0x2991000,
-  0x2d91000,
-  0x3191000,
-  0x3591000,
-  0x3991000,
-  0x1d94000,
-  0x2194000,
-  0x2594000,
-  0x2994000,
-  0x2d94000,
-  0x3194000,
-  0x3594000,
-  0x3994000,
-  0x1d9f000,
-  0x219f000,
-  0x259f000,
-  0x299f000,
-  0x2d9f000,
-  0x319f000,
-  0x359f000,
-  0x399f000,
-  0x1dab000,
-  0x21ab000,
-  0x25ab000,
-  0x29ab000,
-  0x2dab000,
-  0x31ab000,
-  0x35ab000,
-  0x39ab000,
-  0x1dce000,
-  0x21ce000,
-  0x25ce000,
-  0x29ce000,
-  0x2dce000,
-  0x31ce000,
-  0x35ce000,
-  0x39ce000,
-  0x1dd7000,
-  0x21d7000,
-  0x25d7000,
-  0x29d7000,
-  0x2dd7000,
-  0x31d7000,
-  0x35d7000,
-  0x39d7000,
-  0x1de1000,
-  0x21e1000,
-  0x25e1000,
-  0x29e1000,
-  0x2de1000,
-  0x31e1000,
-  0x35e1000,
-  0x39e1000,
-  0x1dec000,
-  0x21ec000,
-  0x25ec000,
-  0x29ec000,
-  0x2dec000,
-  0x31ec000,
-  0x35ec000,
-  0x39ec000,
-  0x1ded000,
-  0x21ed000,
-  0x25ed000,
-  0x29ed000,
-  0x2ded000,
-  0x31ed000,
-  0x35ed000,
-  0x39ed000,
-  0xdc7000,
-  0x11c7000,
-  0x15c7000,
-  0x19c7000,
-  0xdcf000,
-  0x11cf000,
-  0x15cf000,
-  0x19cf000,
-  0xdea000,
-  0x11ea000,
-  0x15ea000,
-  0x19ea000,
-  0xdeb000,
-  0x11eb000,
-  0x15eb000,
-  0x19eb000,
-  0x5c0000,
-  0x9c0000,
-  0x5c1000,
-  0x9c1000,
-  0x5c8000,
-  0x9c8000,
-  0x5c9000,
-  0x9c9000,
-  0x5ca000,
-  0x9ca000,
-  0x5cd000,
-  0x9cd000,
-  0x5d2000,
-  0x9d2000,
-  0x5d5000,
-  0x9d5000,
-  0x5da000,
-  0x9da000,
-  0x5db000,
-  0x9db000,
-  0x5ee000,
-  0x9ee000,
-  0x5f0000,
-  0x9f0000,
-  0x5f2000,
-  0x9f2000,
-  0x5f3000,
-  0x9f3000,
-  0x5ff000,
-  0x9ff000,
-  0x1cb000,
-  0x1cc000,
-  0x1d3000,
-  0x1d4000,
-  0x1d6000,
-  0x1dd000,
-  0x1de000,
-  0x1df000,
-  0x1f1000,
-  0x1f4000,
-  0x1f5000,
-  0x1f6000,
-  0x1f7000,
-  0x1f8000,
-  0x1fa000,
-  0x1fb000,
-  0x1fc000,
-  0x1fd000,
-  0x1fe000,
+  0x1d09002,
+  0x2109002,
+  0x2509002,
+  0x2909002,
+  0x2d09002,
+  0x3109002,
+  0x3509002,
+  0x3909002,
+  0x1d8e002,
+  0x218e002,
+  0x258e002,
+  0x298e002,
+  0x2d8e002,
+  0x318e002,
+  0x358e002,
+  0x398e002,
+  0x1d90002,
+  0x2190002,
+  0x2590002,
+  0x2990002,
+  0x2d90002,
+  0x3190002,
+  0x3590002,
+  0x3990002,
+  0x1d91002,
+  0x2191002,
+  0x2591002,
+  0x2991002,
+  0x2d91002,
+  0x3191002,
+  0x3591002,
+  0x3991002,
+  0x1d94002,
+  0x2194002,
+  0x2594002,
+  0x2994002,
+  0x2d94002,
+  0x3194002,
+  0x3594002,
+  0x3994002,
+  0x1d9f002,
+  0x219f002,
+  0x259f002,
+  0x299f002,
+  0x2d9f002,
+  0x319f002,
+  0x359f002,
+  0x399f002,
+  0x1dab002,
+  0x21ab002,
+  0x25ab002,
+  0x29ab002,
+  0x2dab002,
+  0x31ab002,
+  0x35ab002,
+  0x39ab002,
+  0x1dce002,
+  0x21ce002,
+  0x25ce002,
+  0x29ce002,
+  0x2dce002,
+  0x31ce002,
+  0x35ce002,
+  0x39ce002,
+  0x1dd7002,
+  0x21d7002,
+  0x25d7002,
+  0x29d7002,
+  0x2dd7002,
+  0x31d7002,
+  0x35d7002,
+  0x39d7002,
+  0x1de1002,
+  0x21e1002,
+  0x25e1002,
+  0x29e1002,
+  0x2de1002,
+  0x31e1002,
+  0x35e1002,
+  0x39e1002,
+  0x1dec002,
+  0x21ec002,
+  0x25ec002,
+  0x29ec002,
+  0x2dec002,
+  0x31ec002,
+  0x35ec002,
+  0x39ec002,
+  0x1ded002,
+  0x21ed002,
+  0x25ed002,
+  0x29ed002,
+  0x2ded002,
+  0x31ed002,
+  0x35ed002,
+  0x39ed002,
+  0xdc7002,
+  0x11c7002,
+  0x15c7002,
+  0x19c7002,
+  0xdcf002,
+  0x11cf002,
+  0x15cf002,
+  0x19cf002,
+  0xdea002,
+  0x11ea002,
+  0x15ea002,
+  0x19ea002,
+  0xdeb002,
+  0x11eb002,
+  0x15eb002,
+  0x19eb002,
+  0x5c0002,
+  0x9c0002,
+  0x5c1002,
+  0x9c1002,
+  0x5c8002,
+  0x9c8002,
+  0x5c9002,
+  0x9c9002,
+  0x5ca002,
+  0x9ca002,
+  0x5cd002,
+  0x9cd002,
+  0x5d2002,
+  0x9d2002,
+  0x5d5002,
+  0x9d5002,
+  0x5da002,
+  0x9da002,
+  0x5db002,
+  0x9db002,
+  0x5ee002,
+  0x9ee002,
+  0x5f0002,
+  0x9f0002,
+  0x5f2002,
+  0x9f2002,
+  0x5f3002,
+  0x9f3002,
+  0x5ff002,
+  0x9ff002,
+  0x1cb002,
+  0x1cc002,
+  0x1d3002,
+  0x1d4002,
+  0x1d6002,
+  0x1dd002,
+  0x1de002,
+  0x1df002,
+  0x1f1002,
+  0x1f4002,
+  0x1f5002,
+  0x1f6002,
+  0x1f7002,
+  0x1f8002,
+  0x1fa002,
+  0x1fb002,
+  0x1fc002,
+  0x1fd002,
+  0x1fe002,
   0x73800000,
   0x73c00000,
   0x74000000,
@@ -6114,165 +6114,165 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x80000000,
   0x80000000,
   0x80000000,
-  0x1dc7000,
-  0x21c7000,
-  0x25c7000,
-  0x29c7000,
-  0x2dc7000,
-  0x31c7000,
-  0x35c7000,
-  0x39c7000,
-  0x1dcf000,
-  0x21cf000,
-  0x25cf000,
-  0x29cf000,
-  0x2dcf000,
-  0x31cf000,
-  0x35cf000,
-  0x39cf000,
-  0x1dea000,
-  0x21ea000,
-  0x25ea000,
-  0x29ea000,
-  0x2dea000,
-  0x31ea000,
-  0x35ea000,
-  0x39ea000,
-  0x1deb000,
-  0x21eb000,
-  0x25eb000,
-  0x29eb000,
-  0x2deb000,
-  0x31eb000,
-  0x35eb000,
-  0x39eb000,
-  0xdc0000,
-  0x11c0000,
-  0x15c0000,
-  0x19c0000,
-  0xdc1000,
-  0x11c1000,
-  0x15c1000,
-  0x19c1000,
-  0xdc8000,
-  0x11c8000,
-  0x15c8000,
-  0x19c8000,
-  0xdc9000,
-  0x11c9000,
-  0x15c9000,
-  0x19c9000,
-  0xdca000,
-  0x11ca000,
-  0x15ca000,
-  0x19ca000,
-  0xdcd000,
-  0x11cd000,
-  0x15cd000,
-  0x19cd000,
-  0xdd2000,
-  0x11d2000,
-  0x15d2000,
-  0x19d2000,
-  0xdd5000,
-  0x11d5000,
-  0x15d5000,
-  0x19d5000,
-  0xdda000,
-  0x11da000,
-  0x15da000,
-  0x19da000,
-  0xddb000,
-  0x11db000,
-  0x15db000,
-  0x19db000,
-  0xdee000,
-  0x11ee000,
-  0x15ee000,
-  0x19ee000,
-  0xdf0000,
-  0x11f0000,
-  0x15f0000,
-  0x19f0000,
-  0xdf2000,
-  0x11f2000,
-  0x15f2000,
-  0x19f2000,
-  0xdf3000,
-  0x11f3000,
-  0x15f3000,
-  0x19f3000,
-  0xdff000,
-  0x11ff000,
-  0x15ff000,
-  0x19ff000,
-  0x5cb000,
-  0x9cb000,
-  0x5cc000,
-  0x9cc000,
-  0x5d3000,
-  0x9d3000,
-  0x5d4000,
-  0x9d4000,
-  0x5d6000,
-  0x9d6000,
-  0x5dd000,
-  0x9dd000,
-  0x5de000,
-  0x9de000,
-  0x5df000,
-  0x9df000,
-  0x5f1000,
-  0x9f1000,
-  0x5f4000,
-  0x9f4000,
-  0x5f5000,
-  0x9f5000,
-  0x5f6000,
-  0x9f6000,
-  0x5f7000,
-  0x9f7000,
-  0x5f8000,
-  0x9f8000,
-  0x5fa000,
-  0x9fa000,
-  0x5fb000,
-  0x9fb000,
-  0x5fc000,
-  0x9fc000,
-  0x5fd000,
-  0x9fd000,
-  0x5fe000,
-  0x9fe000,
-  0x102000,
-  0x103000,
-  0x104000,
-  0x105000,
-  0x106000,
-  0x107000,
-  0x108000,
-  0x10b000,
-  0x10c000,
-  0x10e000,
-  0x10f000,
-  0x110000,
-  0x111000,
-  0x112000,
-  0x113000,
-  0x114000,
-  0x115000,
-  0x117000,
-  0x118000,
-  0x119000,
-  0x11a000,
-  0x11b000,
-  0x11c000,
-  0x11d000,
-  0x11e000,
-  0x11f000,
-  0x17f000,
-  0x1dc000,
-  0x1f9000,
+  0x1dc7002,
+  0x21c7002,
+  0x25c7002,
+  0x29c7002,
+  0x2dc7002,
+  0x31c7002,
+  0x35c7002,
+  0x39c7002,
+  0x1dcf002,
+  0x21cf002,
+  0x25cf002,
+  0x29cf002,
+  0x2dcf002,
+  0x31cf002,
+  0x35cf002,
+  0x39cf002,
+  0x1dea002,
+  0x21ea002,
+  0x25ea002,
+  0x29ea002,
+  0x2dea002,
+  0x31ea002,
+  0x35ea002,
+  0x39ea002,
+  0x1deb002,
+  0x21eb002,
+  0x25eb002,
+  0x29eb002,
+  0x2deb002,
+  0x31eb002,
+  0x35eb002,
+  0x39eb002,
+  0xdc0002,
+  0x11c0002,
+  0x15c0002,
+  0x19c0002,
+  0xdc1002,
+  0x11c1002,
+  0x15c1002,
+  0x19c1002,
+  0xdc8002,
+  0x11c8002,
+  0x15c8002,
+  0x19c8002,
+  0xdc9002,
+  0x11c9002,
+  0x15c9002,
+  0x19c9002,
+  0xdca002,
+  0x11ca002,
+  0x15ca002,
+  0x19ca002,
+  0xdcd002,
+  0x11cd002,
+  0x15cd002,
+  0x19cd002,
+  0xdd2002,
+  0x11d2002,
+  0x15d2002,
+  0x19d2002,
+  0xdd5002,
+  0x11d5002,
+  0x15d5002,
+  0x19d5002,
+  0xdda002,
+  0x11da002,
+  0x15da002,
+  0x19da002,
+  0xddb002,
+  0x11db002,
+  0x15db002,
+  0x19db002,
+  0xdee002,
+  0x11ee002,
+  0x15ee002,
+  0x19ee002,
+  0xdf0002,
+  0x11f0002,
+  0x15f0002,
+  0x19f0002,
+  0xdf2002,
+  0x11f2002,
+  0x15f2002,
+  0x19f2002,
+  0xdf3002,
+  0x11f3002,
+  0x15f3002,
+  0x19f3002,
+  0xdff002,
+  0x11ff002,
+  0x15ff002,
+  0x19ff002,
+  0x5cb002,
+  0x9cb002,
+  0x5cc002,
+  0x9cc002,
+  0x5d3002,
+  0x9d3002,
+  0x5d4002,
+  0x9d4002,
+  0x5d6002,
+  0x9d6002,
+  0x5dd002,
+  0x9dd002,
+  0x5de002,
+  0x9de002,
+  0x5df002,
+  0x9df002,
+  0x5f1002,
+  0x9f1002,
+  0x5f4002,
+  0x9f4002,
+  0x5f5002,
+  0x9f5002,
+  0x5f6002,
+  0x9f6002,
+  0x5f7002,
+  0x9f7002,
+  0x5f8002,
+  0x9f8002,
+  0x5fa002,
+  0x9fa002,
+  0x5fb002,
+  0x9fb002,
+  0x5fc002,
+  0x9fc002,
+  0x5fd002,
+  0x9fd002,
+  0x5fe002,
+  0x9fe002,
+  0x102002,
+  0x103002,
+  0x104002,
+  0x105002,
+  0x106002,
+  0x107002,
+  0x108002,
+  0x10b002,
+  0x10c002,
+  0x10e002,
+  0x10f002,
+  0x110002,
+  0x111002,
+  0x112002,
+  0x113002,
+  0x114002,
+  0x115002,
+  0x117002,
+  0x118002,
+  0x119002,
+  0x11a002,
+  0x11b002,
+  0x11c002,
+  0x11d002,
+  0x11e002,
+  0x11f002,
+  0x17f002,
+  0x1dc002,
+  0x1f9002,
   0x7e800000,
   0x80000000,
   0x80000000,
@@ -6338,260 +6338,260 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x80000000,
   0x80000000,
   0x80000000,
-  0x1dc0000,
-  0x21c0000,
-  0x25c0000,
-  0x29c0000,
-  0x2dc0000,
-  0x31c0000,
-  0x35c0000,
-  0x39c0000,
-  0x1dc1000,
-  0x21c1000,
-  0x25c1000,
-  0x29c1000,
-  0x2dc1000,
-  0x31c1000,
-  0x35c1000,
-  0x39c1000,
-  0x1dc8000,
-  0x21c8000,
-  0x25c8000,
-  0x29c8000,
-  0x2dc8000,
-  0x31c8000,
-  0x35c8000,
-  0x39c8000,
-  0x1dc9000,
-  0x21c9000,
-  0x25c9000,
-  0x29c9000,
-  0x2dc9000,
-  0x31c9000,
-  0x35c9000,
-  0x39c9000,
-  0x1dca000,
-  0x21ca000,
-  0x25ca000,
-  0x29ca000,
-  0x2dca000,
-  0x31ca000,
-  0x35ca000,
-  0x39ca000,
-  0x1dcd000,
-  0x21cd000,
-  0x25cd000,
-  0x29cd000,
-  0x2dcd000,
-  0x31cd000,
-  0x35cd000,
-  0x39cd000,
-  0x1dd2000,
-  0x21d2000,
-  0x25d2000,
-  0x29d2000,
-  0x2dd2000,
-  0x31d2000,
-  0x35d2000,
-  0x39d2000,
-  0x1dd5000,
-  0x21d5000,
-  0x25d5000,
-  0x29d5000,
-  0x2dd5000,
-  0x31d5000,
-  0x35d5000,
-  0x39d5000,
-  0x1dda000,
-  0x21da000,
-  0x25da000,
-  0x29da000,
-  0x2dda000,
-  0x31da000,
-  0x35da000,
-  0x39da000,
-  0x1ddb000,
-  0x21db000,
-  0x25db000,
-  0x29db000,
-  0x2ddb000,
-  0x31db000,
-  0x35db000,
-  0x39db000,
-  0x1dee000,
-  0x21ee000,
-  0x25ee000,
-  0x29ee000,
-  0x2dee000,
-  0x31ee000,
-  0x35ee000,
-  0x39ee000,
-  0x1df0000,
-  0x21f0000,
-  0x25f0000,
-  0x29f0000,
-  0x2df0000,
-  0x31f0000,
-  0x35f0000,
-  0x39f0000,
-  0x1df2000,
-  0x21f2000,
-  0x25f2000,
-  0x29f2000,
-  0x2df2000,
-  0x31f2000,
-  0x35f2000,
-  0x39f2000,
-  0x1df3000,
-  0x21f3000,
-  0x25f3000,
-  0x29f3000,
-  0x2df3000,
-  0x31f3000,
-  0x35f3000,
-  0x39f3000,
-  0x1dff000,
-  0x21ff000,
-  0x25ff000,
-  0x29ff000,
-  0x2dff000,
-  0x31ff000,
-  0x35ff000,
-  0x39ff000,
-  0xdcb000,
-  0x11cb000,
-  0x15cb000,
-  0x19cb000,
-  0xdcc000,
-  0x11cc000,
-  0x15cc000,
-  0x19cc000,
-  0xdd3000,
-  0x11d3000,
-  0x15d3000,
-  0x19d3000,
-  0xdd4000,
-  0x11d4000,
-  0x15d4000,
-  0x19d4000,
-  0xdd6000,
-  0x11d6000,
-  0x15d6000,
-  0x19d6000,
-  0xddd000,
-  0x11dd000,
-  0x15dd000,
-  0x19dd000,
-  0xdde000,
-  0x11de000,
-  0x15de000,
-  0x19de000,
-  0xddf000,
-  0x11df000,
-  0x15df000,
-  0x19df000,
-  0xdf1000,
-  0x11f1000,
-  0x15f1000,
-  0x19f1000,
-  0xdf4000,
-  0x11f4000,
-  0x15f4000,
-  0x19f4000,
-  0xdf5000,
-  0x11f5000,
-  0x15f5000,
-  0x19f5000,
-  0xdf6000,
-  0x11f6000,
-  0x15f6000,
-  0x19f6000,
-  0xdf7000,
-  0x11f7000,
-  0x15f7000,
-  0x19f7000,
-  0xdf8000,
-  0x11f8000,
-  0x15f8000,
-  0x19f8000,
-  0xdfa000,
-  0x11fa000,
-  0x15fa000,
-  0x19fa000,
-  0xdfb000,
-  0x11fb000,
-  0x15fb000,
-  0x19fb000,
-  0xdfc000,
-  0x11fc000,
-  0x15fc000,
-  0x19fc000,
-  0xdfd000,
-  0x11fd000,
-  0x15fd000,
-  0x19fd000,
-  0xdfe000,
-  0x11fe000,
-  0x15fe000,
-  0x19fe000,
-  0x502000,
-  0x902000,
-  0x503000,
-  0x903000,
-  0x504000,
-  0x904000,
-  0x505000,
-  0x905000,
-  0x506000,
-  0x906000,
-  0x507000,
-  0x907000,
-  0x508000,
-  0x908000,
-  0x50b000,
-  0x90b000,
-  0x50c000,
-  0x90c000,
-  0x50e000,
-  0x90e000,
-  0x50f000,
-  0x90f000,
-  0x510000,
-  0x910000,
-  0x511000,
-  0x911000,
-  0x512000,
-  0x912000,
-  0x513000,
-  0x913000,
-  0x514000,
-  0x914000,
-  0x515000,
-  0x915000,
-  0x517000,
-  0x917000,
-  0x518000,
-  0x918000,
-  0x519000,
-  0x919000,
-  0x51a000,
-  0x91a000,
-  0x51b000,
-  0x91b000,
-  0x51c000,
-  0x91c000,
-  0x51d000,
-  0x91d000,
-  0x51e000,
-  0x91e000,
-  0x51f000,
-  0x91f000,
-  0x57f000,
-  0x97f000,
-  0x5dc000,
-  0x9dc000,
-  0x5f9000,
-  0x9f9000,
+  0x1dc0002,
+  0x21c0002,
+  0x25c0002,
+  0x29c0002,
+  0x2dc0002,
+  0x31c0002,
+  0x35c0002,
+  0x39c0002,
+  0x1dc1002,
+  0x21c1002,
+  0x25c1002,
+  0x29c1002,
+  0x2dc1002,
+  0x31c1002,
+  0x35c1002,
+  0x39c1002,
+  0x1dc8002,
+  0x21c8002,
+  0x25c8002,
+  0x29c8002,
+  0x2dc8002,
+  0x31c8002,
+  0x35c8002,
+  0x39c8002,
+  0x1dc9002,
+  0x21c9002,
+  0x25c9002,
+  0x29c9002,
+  0x2dc9002,
+  0x31c9002,
+  0x35c9002,
+  0x39c9002,
+  0x1dca002,
+  0x21ca002,
+  0x25ca002,
+  0x29ca002,
+  0x2dca002,
+  0x31ca002,
+  0x35ca002,
+  0x39ca002,
+  0x1dcd002,
+  0x21cd002,
+  0x25cd002,
+  0x29cd002,
+  0x2dcd002,
+  0x31cd002,
+  0x35cd002,
+  0x39cd002,
+  0x1dd2002,
+  0x21d2002,
+  0x25d2002,
+  0x29d2002,
+  0x2dd2002,
+  0x31d2002,
+  0x35d2002,
+  0x39d2002,
+  0x1dd5002,
+  0x21d5002,
+  0x25d5002,
+  0x29d5002,
+  0x2dd5002,
+  0x31d5002,
+  0x35d5002,
+  0x39d5002,
+  0x1dda002,
+  0x21da002,
+  0x25da002,
+  0x29da002,
+  0x2dda002,
+  0x31da002,
+  0x35da002,
+  0x39da002,
+  0x1ddb002,
+  0x21db002,
+  0x25db002,
+  0x29db002,
+  0x2ddb002,
+  0x31db002,
+  0x35db002,
+  0x39db002,
+  0x1dee002,
+  0x21ee002,
+  0x25ee002,
+  0x29ee002,
+  0x2dee002,
+  0x31ee002,
+  0x35ee002,
+  0x39ee002,
+  0x1df0002,
+  0x21f0002,
+  0x25f0002,
+  0x29f0002,
+  0x2df0002,
+  0x31f0002,
+  0x35f0002,
+  0x39f0002,
+  0x1df2002,
+  0x21f2002,
+  0x25f2002,
+  0x29f2002,
+  0x2df2002,
+  0x31f2002,
+  0x35f2002,
+  0x39f2002,
+  0x1df3002,
+  0x21f3002,
+  0x25f3002,
+  0x29f3002,
+  0x2df3002,
+  0x31f3002,
+  0x35f3002,
+  0x39f3002,
+  0x1dff002,
+  0x21ff002,
+  0x25ff002,
+  0x29ff002,
+  0x2dff002,
+  0x31ff002,
+  0x35ff002,
+  0x39ff002,
+  0xdcb002,
+  0x11cb002,
+  0x15cb002,
+  0x19cb002,
+  0xdcc002,
+  0x11cc002,
+  0x15cc002,
+  0x19cc002,
+  0xdd3002,
+  0x11d3002,
+  0x15d3002,
+  0x19d3002,
+  0xdd4002,
+  0x11d4002,
+  0x15d4002,
+  0x19d4002,
+  0xdd6002,
+  0x11d6002,
+  0x15d6002,
+  0x19d6002,
+  0xddd002,
+  0x11dd002,
+  0x15dd002,
+  0x19dd002,
+  0xdde002,
+  0x11de002,
+  0x15de002,
+  0x19de002,
+  0xddf002,
+  0x11df002,
+  0x15df002,
+  0x19df002,
+  0xdf1002,
+  0x11f1002,
+  0x15f1002,
+  0x19f1002,
+  0xdf4002,
+  0x11f4002,
+  0x15f4002,
+  0x19f4002,
+  0xdf5002,
+  0x11f5002,
+  0x15f5002,
+  0x19f5002,
+  0xdf6002,
+  0x11f6002,
+  0x15f6002,
+  0x19f6002,
+  0xdf7002,
+  0x11f7002,
+  0x15f7002,
+  0x19f7002,
+  0xdf8002,
+  0x11f8002,
+  0x15f8002,
+  0x19f8002,
+  0xdfa002,
+  0x11fa002,
+  0x15fa002,
+  0x19fa002,
+  0xdfb002,
+  0x11fb002,
+  0x15fb002,
+  0x19fb002,
+  0xdfc002,
+  0x11fc002,
+  0x15fc002,
+  0x19fc002,
+  0xdfd002,
+  0x11fd002,
+  0x15fd002,
+  0x19fd002,
+  0xdfe002,
+  0x11fe002,
+  0x15fe002,
+  0x19fe002,
+  0x502002,
+  0x902002,
+  0x503002,
+  0x903002,
+  0x504002,
+  0x904002,
+  0x505002,
+  0x905002,
+  0x506002,
+  0x906002,
+  0x507002,
+  0x907002,
+  0x508002,
+  0x908002,
+  0x50b002,
+  0x90b002,
+  0x50c002,
+  0x90c002,
+  0x50e002,
+  0x90e002,
+  0x50f002,
+  0x90f002,
+  0x510002,
+  0x910002,
+  0x511002,
+  0x911002,
+  0x512002,
+  0x912002,
+  0x513002,
+  0x913002,
+  0x514002,
+  0x914002,
+  0x515002,
+  0x915002,
+  0x517002,
+  0x917002,
+  0x518002,
+  0x918002,
+  0x519002,
+  0x919002,
+  0x51a002,
+  0x91a002,
+  0x51b002,
+  0x91b002,
+  0x51c002,
+  0x91c002,
+  0x51d002,
+  0x91d002,
+  0x51e002,
+  0x91e002,
+  0x51f002,
+  0x91f002,
+  0x57f002,
+  0x97f002,
+  0x5dc002,
+  0x9dc002,
+  0x5f9002,
+  0x9f9002,
   0x7ec00000,
   0x7f000000,
   0x80000000,
@@ -6834,277 +6834,277 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x80000000,
   0x80000000,
   0x80000000,
-  0x1dcb000,
-  0x21cb000,
-  0x25cb000,
-  0x29cb000,
-  0x2dcb000,
-  0x31cb000,
-  0x35cb000,
-  0x39cb000,
-  0x1dcc000,
-  0x21cc000,
-  0x25cc000,
-  0x29cc000,
-  0x2dcc000,
-  0x31cc000,
-  0x35cc000,
-  0x39cc000,
-  0x1dd3000,
-  0x21d3000,
-  0x25d3000,
-  0x29d3000,
-  0x2dd3000,
-  0x31d3000,
-  0x35d3000,
-  0x39d3000,
-  0x1dd4000,
-  0x21d4000,
-  0x25d4000,
-  0x29d4000,
-  0x2dd4000,
-  0x31d4000,
-  0x35d4000,
-  0x39d4000,
-  0x1dd6000,
-  0x21d6000,
-  0x25d6000,
-  0x29d6000,
-  0x2dd6000,
-  0x31d6000,
-  0x35d6000,
-  0x39d6000,
-  0x1ddd000,
-  0x21dd000,
-  0x25dd000,
-  0x29dd000,
-  0x2ddd000,
-  0x31dd000,
-  0x35dd000,
-  0x39dd000,
-  0x1dde000,
-  0x21de000,
-  0x25de000,
-  0x29de000,
-  0x2dde000,
-  0x31de000,
-  0x35de000,
-  0x39de000,
-  0x1ddf000,
-  0x21df000,
-  0x25df000,
-  0x29df000,
-  0x2ddf000,
-  0x31df000,
-  0x35df000,
-  0x39df000,
-  0x1df1000,
-  0x21f1000,
-  0x25f1000,
-  0x29f1000,
-  0x2df1000,
-  0x31f1000,
-  0x35f1000,
-  0x39f1000,
-  0x1df4000,
-  0x21f4000,
-  0x25f4000,
-  0x29f4000,
-  0x2df4000,
-  0x31f4000,
-  0x35f4000,
-  0x39f4000,
-  0x1df5000,
-  0x21f5000,
-  0x25f5000,
-  0x29f5000,
-  0x2df5000,
-  0x31f5000,
-  0x35f5000,
-  0x39f5000,
-  0x1df6000,
-  0x21f6000,
-  0x25f6000,
-  0x29f6000,
-  0x2df6000,
-  0x31f6000,
-  0x35f6000,
-  0x39f6000,
-  0x1df7000,
-  0x21f7000,
-  0x25f7000,
-  0x29f7000,
-  0x2df7000,
-  0x31f7000,
-  0x35f7000,
-  0x39f7000,
-  0x1df8000,
-  0x21f8000,
-  0x25f8000,
-  0x29f8000,
-  0x2df8000,
-  0x31f8000,
-  0x35f8000,
-  0x39f8000,
-  0x1dfa000,
-  0x21fa000,
-  0x25fa000,
-  0x29fa000,
-  0x2dfa000,
-  0x31fa000,
-  0x35fa000,
-  0x39fa000,
-  0x1dfb000,
-  0x21fb000,
-  0x25fb000,
-  0x29fb000,
-  0x2dfb000,
-  0x31fb000,
-  0x35fb000,
-  0x39fb000,
-  0x1dfc000,
-  0x21fc000,
-  0x25fc000,
-  0x29fc000,
-  0x2dfc000,
-  0x31fc000,
-  0x35fc000,
-  0x39fc000,
-  0x1dfd000,
-  0x21fd000,
-  0x25fd000,
-  0x29fd000,
-  0x2dfd000,
-  0x31fd000,
-  0x35fd000,
-  0x39fd000,
-  0x1dfe000,
-  0x21fe000,
-  0x25fe000,
-  0x29fe000,
-  0x2dfe000,
-  0x31fe000,
-  0x35fe000,
-  0x39fe000,
-  0xd02000,
-  0x1102000,
-  0x1502000,
-  0x1902000,
-  0xd03000,
-  0x1103000,
-  0x1503000,
-  0x1903000,
-  0xd04000,
-  0x1104000,
-  0x1504000,
-  0x1904000,
-  0xd05000,
-  0x1105000,
-  0x1505000,
-  0x1905000,
-  0xd06000,
-  0x1106000,
-  0x1506000,
-  0x1906000,
-  0xd07000,
-  0x1107000,
-  0x1507000,
-  0x1907000,
-  0xd08000,
-  0x1108000,
-  0x1508000,
-  0x1908000,
-  0xd0b000,
-  0x110b000,
-  0x150b000,
-  0x190b000,
-  0xd0c000,
-  0x110c000,
-  0x150c000,
-  0x190c000,
-  0xd0e000,
-  0x110e000,
-  0x150e000,
-  0x190e000,
-  0xd0f000,
-  0x110f000,
-  0x150f000,
-  0x190f000,
-  0xd10000,
-  0x1110000,
-  0x1510000,
-  0x1910000,
-  0xd11000,
-  0x1111000,
-  0x1511000,
-  0x1911000,
-  0xd12000,
-  0x1112000,
-  0x1512000,
-  0x1912000,
-  0xd13000,
-  0x1113000,
-  0x1513000,
-  0x1913000,
-  0xd14000,
-  0x1114000,
-  0x1514000,
-  0x1914000,
-  0xd15000,
-  0x1115000,
-  0x1515000,
-  0x1915000,
-  0xd17000,
-  0x1117000,
-  0x1517000,
-  0x1917000,
-  0xd18000,
-  0x1118000,
-  0x1518000,
-  0x1918000,
-  0xd19000,
-  0x1119000,
-  0x1519000,
-  0x1919000,
-  0xd1a000,
-  0x111a000,
-  0x151a000,
-  0x191a000,
-  0xd1b000,
-  0x111b000,
-  0x151b000,
-  0x191b000,
-  0xd1c000,
-  0x111c000,
-  0x151c000,
-  0x191c000,
-  0xd1d000,
-  0x111d000,
-  0x151d000,
-  0x191d000,
-  0xd1e000,
-  0x111e000,
-  0x151e000,
-  0x191e000,
-  0xd1f000,
-  0x111f000,
-  0x151f000,
-  0x191f000,
-  0xd7f000,
-  0x117f000,
-  0x157f000,
-  0x197f000,
-  0xddc000,
-  0x11dc000,
-  0x15dc000,
-  0x19dc000,
-  0xdf9000,
-  0x11f9000,
-  0x15f9000,
-  0x19f9000,
-  0x10a000,
-  0x10d000,
-  0x116000,
+  0x1dcb002,
+  0x21cb002,
+  0x25cb002,
+  0x29cb002,
+  0x2dcb002,
+  0x31cb002,
+  0x35cb002,
+  0x39cb002,
+  0x1dcc002,
+  0x21cc002,
+  0x25cc002,
+  0x29cc002,
+  0x2dcc002,
+  0x31cc002,
+  0x35cc002,
+  0x39cc002,
+  0x1dd3002,
+  0x21d3002,
+  0x25d3002,
+  0x29d3002,
+  0x2dd3002,
+  0x31d3002,
+  0x35d3002,
+  0x39d3002,
+  0x1dd4002,
+  0x21d4002,
+  0x25d4002,
+  0x29d4002,
+  0x2dd4002,
+  0x31d4002,
+  0x35d4002,
+  0x39d4002,
+  0x1dd6002,
+  0x21d6002,
+  0x25d6002,
+  0x29d6002,
+  0x2dd6002,
+  0x31d6002,
+  0x35d6002,
+  0x39d6002,
+  0x1ddd002,
+  0x21dd002,
+  0x25dd002,
+  0x29dd002,
+  0x2ddd002,
+  0x31dd002,
+  0x35dd002,
+  0x39dd002,
+  0x1dde002,
+  0x21de002,
+  0x25de002,
+  0x29de002,
+  0x2dde002,
+  0x31de002,
+  0x35de002,
+  0x39de002,
+  0x1ddf002,
+  0x21df002,
+  0x25df002,
+  0x29df002,
+  0x2ddf002,
+  0x31df002,
+  0x35df002,
+  0x39df002,
+  0x1df1002,
+  0x21f1002,
+  0x25f1002,
+  0x29f1002,
+  0x2df1002,
+  0x31f1002,
+  0x35f1002,
+  0x39f1002,
+  0x1df4002,
+  0x21f4002,
+  0x25f4002,
+  0x29f4002,
+  0x2df4002,
+  0x31f4002,
+  0x35f4002,
+  0x39f4002,
+  0x1df5002,
+  0x21f5002,
+  0x25f5002,
+  0x29f5002,
+  0x2df5002,
+  0x31f5002,
+  0x35f5002,
+  0x39f5002,
+  0x1df6002,
+  0x21f6002,
+  0x25f6002,
+  0x29f6002,
+  0x2df6002,
+  0x31f6002,
+  0x35f6002,
+  0x39f6002,
+  0x1df7002,
+  0x21f7002,
+  0x25f7002,
+  0x29f7002,
+  0x2df7002,
+  0x31f7002,
+  0x35f7002,
+  0x39f7002,
+  0x1df8002,
+  0x21f8002,
+  0x25f8002,
+  0x29f8002,
+  0x2df8002,
+  0x31f8002,
+  0x35f8002,
+  0x39f8002,
+  0x1dfa002,
+  0x21fa002,
+  0x25fa002,
+  0x29fa002,
+  0x2dfa002,
+  0x31fa002,
+  0x35fa002,
+  0x39fa002,
+  0x1dfb002,
+  0x21fb002,
+  0x25fb002,
+  0x29fb002,
+  0x2dfb002,
+  0x31fb002,
+  0x35fb002,
+  0x39fb002,
+  0x1dfc002,
+  0x21fc002,
+  0x25fc002,
+  0x29fc002,
+  0x2dfc002,
+  0x31fc002,
+  0x35fc002,
+  0x39fc002,
+  0x1dfd002,
+  0x21fd002,
+  0x25fd002,
+  0x29fd002,
+  0x2dfd002,
+  0x31fd002,
+  0x35fd002,
+  0x39fd002,
+  0x1dfe002,
+  0x21fe002,
+  0x25fe002,
+  0x29fe002,
+  0x2dfe002,
+  0x31fe002,
+  0x35fe002,
+  0x39fe002,
+  0xd02002,
+  0x1102002,
+  0x1502002,
+  0x1902002,
+  0xd03002,
+  0x1103002,
+  0x1503002,
+  0x1903002,
+  0xd04002,
+  0x1104002,
+  0x1504002,
+  0x1904002,
+  0xd05002,
+  0x1105002,
+  0x1505002,
+  0x1905002,
+  0xd06002,
+  0x1106002,
+  0x1506002,
+  0x1906002,
+  0xd07002,
+  0x1107002,
+  0x1507002,
+  0x1907002,
+  0xd08002,
+  0x1108002,
+  0x1508002,
+  0x1908002,
+  0xd0b002,
+  0x110b002,
+  0x150b002,
+  0x190b002,
+  0xd0c002,
+  0x110c002,
+  0x150c002,
+  0x190c002,
+  0xd0e002,
+  0x110e002,
+  0x150e002,
+  0x190e002,
+  0xd0f002,
+  0x110f002,
+  0x150f002,
+  0x190f002,
+  0xd10002,
+  0x1110002,
+  0x1510002,
+  0x1910002,
+  0xd11002,
+  0x1111002,
+  0x1511002,
+  0x1911002,
+  0xd12002,
+  0x1112002,
+  0x1512002,
+  0x1912002,
+  0xd13002,
+  0x1113002,
+  0x1513002,
+  0x1913002,
+  0xd14002,
+  0x1114002,
+  0x1514002,
+  0x1914002,
+  0xd15002,
+  0x1115002,
+  0x1515002,
+  0x1915002,
+  0xd17002,
+  0x1117002,
+  0x1517002,
+  0x1917002,
+  0xd18002,
+  0x1118002,
+  0x1518002,
+  0x1918002,
+  0xd19002,
+  0x1119002,
+  0x1519002,
+  0x1919002,
+  0xd1a002,
+  0x111a002,
+  0x151a002,
+  0x191a002,
+  0xd1b002,
+  0x111b002,
+  0x151b002,
+  0x191b002,
+  0xd1c002,
+  0x111c002,
+  0x151c002,
+  0x191c002,
+  0xd1d002,
+  0x111d002,
+  0x151d002,
+  0x191d002,
+  0xd1e002,
+  0x111e002,
+  0x151e002,
+  0x191e002,
+  0xd1f002,
+  0x111f002,
+  0x151f002,
+  0x191f002,
+  0xd7f002,
+  0x117f002,
+  0x157f002,
+  0x197f002,
+  0xddc002,
+  0x11dc002,
+  0x15dc002,
+  0x19dc002,
+  0xdf9002,
+  0x11f9002,
+  0x15f9002,
+  0x19f9002,
+  0x10a00a,
+  0x10d00a,
+  0x116002,
   0x80000000,
   0x80000000,
   0x80000000,
@@ -7410,244 +7410,244 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x80000000,
   0x80000000,
   0x80000000,
-  0x1d02000,
-  0x2102000,
-  0x2502000,
-  0x2902000,
-  0x2d02000,
-  0x3102000,
-  0x3502000,
-  0x3902000,
-  0x1d03000,
-  0x2103000,
-  0x2503000,
-  0x2903000,
-  0x2d03000,
-  0x3103000,
-  0x3503000,
-  0x3903000,
-  0x1d04000,
-  0x2104000,
-  0x2504000,
-  0x2904000,
-  0x2d04000,
-  0x3104000,
-  0x3504000,
-  0x3904000,
-  0x1d05000,
-  0x2105000,
-  0x2505000,
-  0x2905000,
-  0x2d05000,
-  0x3105000,
-  0x3505000,
-  0x3905000,
-  0x1d06000,
-  0x2106000,
-  0x2506000,
-  0x2906000,
-  0x2d06000,
-  0x3106000,
-  0x3506000,
-  0x3906000,
-  0x1d07000,
-  0x2107000,
-  0x2507000,
-  0x2907000,
-  0x2d07000,
-  0x3107000,
-  0x3507000,
-  0x3907000,
-  0x1d08000,
-  0x2108000,
-  0x2508000,
-  0x2908000,
-  0x2d08000,
-  0x3108000,
-  0x3508000,
-  0x3908000,
-  0x1d0b000,
-  0x210b000,
-  0x250b000,
-  0x290b000,
-  0x2d0b000,
-  0x310b000,
-  0x350b000,
-  0x390b000,
-  0x1d0c000,
-  0x210c000,
-  0x250c000,
-  0x290c000,
-  0x2d0c000,
-  0x310c000,
-  0x350c000,
-  0x390c000,
-  0x1d0e000,
-  0x210e000,
-  0x250e000,
-  0x290e000,
-  0x2d0e000,
-  0x310e000,
-  0x350e000,
-  0x390e000,
-  0x1d0f000,
-  0x210f000,
-  0x250f000,
-  0x290f000,
-  0x2d0f000,
-  0x310f000,
-  0x350f000,
-  0x390f000,
-  0x1d10000,
-  0x2110000,
-  0x2510000,
-  0x2910000,
-  0x2d10000,
-  0x3110000,
-  0x3510000,
-  0x3910000,
-  0x1d11000,
-  0x2111000,
-  0x2511000,
-  0x2911000,
-  0x2d11000,
-  0x3111000,
-  0x3511000,
-  0x3911000,
-  0x1d12000,
-  0x2112000,
-  0x2512000,
-  0x2912000,
-  0x2d12000,
-  0x3112000,
-  0x3512000,
-  0x3912000,
-  0x1d13000,
-  0x2113000,
-  0x2513000,
-  0x2913000,
-  0x2d13000,
-  0x3113000,
-  0x3513000,
-  0x3913000,
-  0x1d14000,
-  0x2114000,
-  0x2514000,
-  0x2914000,
-  0x2d14000,
-  0x3114000,
-  0x3514000,
-  0x3914000,
-  0x1d15000,
-  0x2115000,
-  0x2515000,
-  0x2915000,
-  0x2d15000,
-  0x3115000,
-  0x3515000,
-  0x3915000,
-  0x1d17000,
-  0x2117000,
-  0x2517000,
-  0x2917000,
-  0x2d17000,
-  0x3117000,
-  0x3517000,
-  0x3917000,
-  0x1d18000,
-  0x2118000,
-  0x2518000,
-  0x2918000,
-  0x2d18000,
-  0x3118000,
-  0x3518000,
-  0x3918000,
-  0x1d19000,
-  0x2119000,
-  0x2519000,
-  0x2919000,
-  0x2d19000,
-  0x3119000,
-  0x3519000,
-  0x3919000,
-  0x1d1a000,
-  0x211a000,
-  0x251a000,
-  0x291a000,
-  0x2d1a000,
-  0x311a000,
-  0x351a000,
-  0x391a000,
-  0x1d1b000,
-  0x211b000,
-  0x251b000,
-  0x291b000,
-  0x2d1b000,
-  0x311b000,
-  0x351b000,
-  0x391b000,
-  0x1d1c000,
-  0x211c000,
-  0x251c000,
-  0x291c000,
-  0x2d1c000,
-  0x311c000,
-  0x351c000,
-  0x391c000,
-  0x1d1d000,
-  0x211d000,
-  0x251d000,
-  0x291d000,
-  0x2d1d000,
-  0x311d000,
-  0x351d000,
-  0x391d000,
-  0x1d1e000,
-  0x211e000,
-  0x251e000,
-  0x291e000,
-  0x2d1e000,
-  0x311e000,
-  0x351e000,
-  0x391e000,
-  0x1d1f000,
-  0x211f000,
-  0x251f000,
-  0x291f000,
-  0x2d1f000,
-  0x311f000,
-  0x351f000,
-  0x391f000,
-  0x1d7f000,
-  0x217f000,
-  0x257f000,
-  0x297f000,
-  0x2d7f000,
-  0x317f000,
-  0x357f000,
-  0x397f000,
-  0x1ddc000,
-  0x21dc000,
-  0x25dc000,
-  0x29dc000,
-  0x2ddc000,
-  0x31dc000,
-  0x35dc000,
-  0x39dc000,
-  0x1df9000,
-  0x21f9000,
-  0x25f9000,
-  0x29f9000,
-  0x2df9000,
-  0x31f9000,
-  0x35f9000,
-  0x39f9000,
-  0x50a000,
-  0x90a000,
-  0x50d000,
-  0x90d000,
-  0x516000,
-  0x916000,
+  0x1d02002,
+  0x2102002,
+  0x2502002,
+  0x2902002,
+  0x2d02002,
+  0x3102002,
+  0x3502002,
+  0x3902002,
+  0x1d03002,
+  0x2103002,
+  0x2503002,
+  0x2903002,
+  0x2d03002,
+  0x3103002,
+  0x3503002,
+  0x3903002,
+  0x1d04002,
+  0x2104002,
+  0x2504002,
+  0x2904002,
+  0x2d04002,
+  0x3104002,
+  0x3504002,
+  0x3904002,
+  0x1d05002,
+  0x2105002,
+  0x2505002,
+  0x2905002,
+  0x2d05002,
+  0x3105002,
+  0x3505002,
+  0x3905002,
+  0x1d06002,
+  0x2106002,
+  0x2506002,
+  0x2906002,
+  0x2d06002,
+  0x3106002,
+  0x3506002,
+  0x3906002,
+  0x1d07002,
+  0x2107002,
+  0x2507002,
+  0x2907002,
+  0x2d07002,
+  0x3107002,
+  0x3507002,
+  0x3907002,
+  0x1d08002,
+  0x2108002,
+  0x2508002,
+  0x2908002,
+  0x2d08002,
+  0x3108002,
+  0x3508002,
+  0x3908002,
+  0x1d0b002,
+  0x210b002,
+  0x250b002,
+  0x290b002,
+  0x2d0b002,
+  0x310b002,
+  0x350b002,
+  0x390b002,
+  0x1d0c002,
+  0x210c002,
+  0x250c002,
+  0x290c002,
+  0x2d0c002,
+  0x310c002,
+  0x350c002,
+  0x390c002,
+  0x1d0e002,
+  0x210e002,
+  0x250e002,
+  0x290e002,
+  0x2d0e002,
+  0x310e002,
+  0x350e002,
+  0x390e002,
+  0x1d0f002,
+  0x210f002,
+  0x250f002,
+  0x290f002,
+  0x2d0f002,
+  0x310f002,
+  0x350f002,
+  0x390f002,
+  0x1d10002,
+  0x2110002,
+  0x2510002,
+  0x2910002,
+  0x2d10002,
+  0x3110002,
+  0x3510002,
+  0x3910002,
+  0x1d11002,
+  0x2111002,
+  0x2511002,
+  0x2911002,
+  0x2d11002,
+  0x3111002,
+  0x3511002,
+  0x3911002,
+  0x1d12002,
+  0x2112002,
+  0x2512002,
+  0x2912002,
+  0x2d12002,
+  0x3112002,
+  0x3512002,
+  0x3912002,
+  0x1d13002,
+  0x2113002,
+  0x2513002,
+  0x2913002,
+  0x2d13002,
+  0x3113002,
+  0x3513002,
+  0x3913002,
+  0x1d14002,
+  0x2114002,
+  0x2514002,
+  0x2914002,
+  0x2d14002,
+  0x3114002,
+  0x3514002,
+  0x3914002,
+  0x1d15002,
+  0x2115002,
+  0x2515002,
+  0x2915002,
+  0x2d15002,
+  0x3115002,
+  0x3515002,
+  0x3915002,
+  0x1d17002,
+  0x2117002,
+  0x2517002,
+  0x2917002,
+  0x2d17002,
+  0x3117002,
+  0x3517002,
+  0x3917002,
+  0x1d18002,
+  0x2118002,
+  0x2518002,
+  0x2918002,
+  0x2d18002,
+  0x3118002,
+  0x3518002,
+  0x3918002,
+  0x1d19002,
+  0x2119002,
+  0x2519002,
+  0x2919002,
+  0x2d19002,
+  0x3119002,
+  0x3519002,
+  0x3919002,
+  0x1d1a002,
+  0x211a002,
+  0x251a002,
+  0x291a002,
+  0x2d1a002,
+  0x311a002,
+  0x351a002,
+  0x391a002,
+  0x1d1b002,
+  0x211b002,
+  0x251b002,
+  0x291b002,
+  0x2d1b002,
+  0x311b002,
+  0x351b002,
+  0x391b002,
+  0x1d1c002,
+  0x211c002,
+  0x251c002,
+  0x291c002,
+  0x2d1c002,
+  0x311c002,
+  0x351c002,
+  0x391c002,
+  0x1d1d002,
+  0x211d002,
+  0x251d002,
+  0x291d002,
+  0x2d1d002,
+  0x311d002,
+  0x351d002,
+  0x391d002,
+  0x1d1e002,
+  0x211e002,
+  0x251e002,
+  0x291e002,
+  0x2d1e002,
+  0x311e002,
+  0x351e002,
+  0x391e002,
+  0x1d1f002,
+  0x211f002,
+  0x251f002,
+  0x291f002,
+  0x2d1f002,
+  0x311f002,
+  0x351f002,
+  0x391f002,
+  0x1d7f002,
+  0x217f002,
+  0x257f002,
+  0x297f002,
+  0x2d7f002,
+  0x317f002,
+  0x357f002,
+  0x397f002,
+  0x1ddc002,
+  0x21dc002,
+  0x25dc002,
+  0x29dc002,
+  0x2ddc002,
+  0x31dc002,
+  0x35dc002,
+  0x39dc002,
+  0x1df9002,
+  0x21f9002,
+  0x25f9002,
+  0x29f9002,
+  0x2df9002,
+  0x31f9002,
+  0x35f9002,
+  0x39f9002,
+  0x50a00a,
+  0x90a00a,
+  0x50d00a,
+  0x90d00a,
+  0x516002,
+  0x916002,
   0x80000000,
   0x80000000,
   0x80000000,
@@ -8114,46 +8114,46 @@ static constexpr NibblePackedEntry kNibbleDecodeTable[8192] = {
   0x80000000,
   0x80000000,
   0x80000000,
-  0xd0a000,
-  0x110a000,
-  0x150a000,
-  0x190a000,
-  0xd0d000,
-  0x110d000,
-  0x150d000,
-  0x190d000,
-  0xd16000,
-  0x1116000,
-  0x1516000,
-  0x1916000,
+  0xd0a00a,
+  0x110a00a,
+  0x150a00a,
+  0x190a00a,
+  0xd0d00a,
+  0x110d00a,
+  0x150d00a,
+  0x190d00a,
+  0xd16002,
+  0x1116002,
+  0x1516002,
+  0x1916002,
   0x80000000,
   0x80000000,
   0x80000000,
   0x80000000,
-  0x1d0a000,
-  0x210a000,
-  0x250a000,
-  0x290a000,
-  0x2d0a000,
-  0x310a000,
-  0x350a000,
-  0x390a000,
-  0x1d0d000,
-  0x210d000,
-  0x250d000,
-  0x290d000,
-  0x2d0d000,
-  0x310d000,
-  0x350d000,
-  0x390d000,
-  0x1d16000,
-  0x2116000,
-  0x2516000,
-  0x2916000,
-  0x2d16000,
-  0x3116000,
-  0x3516000,
-  0x3916000,
+  0x1d0a00a,
+  0x210a00a,
+  0x250a00a,
+  0x290a00a,
+  0x2d0a00a,
+  0x310a00a,
+  0x350a00a,
+  0x390a00a,
+  0x1d0d00a,
+  0x210d00a,
+  0x250d00a,
+  0x290d00a,
+  0x2d0d00a,
+  0x310d00a,
+  0x350d00a,
+  0x390d00a,
+  0x1d16002,
+  0x2116002,
+  0x2516002,
+  0x2916002,
+  0x2d16002,
+  0x3116002,
+  0x3516002,
+  0x3916002,
   0x80000000,
   0x80000000,
   0x80000000,
@@ -0,0 +1,226 @@
+// include/h2v/hpack/header_block.h
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <utility>
+
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+#include "h2v/hpack/decoder.h"
+#include "h2v/hpack/entry_type.h"
+#include "h2v/hpack/error_code.h"
+#include "h2v/hpack/header_id.h"
+#include "h2v/stream/raw_buffer.h"
+
+namespace h2v {
+namespace hpack {
+
+/// @brief One field of a HeaderBlockView.
+struct HeaderBlockField {
+  absl::string_view name;
+  absl::string_view value;
+  HeaderId id = HeaderId::Unknown;
+  EntryType type = EntryType::IndexedHeader;
+};
+
+/// @brief Read-only view of a flat header list: a packed array of field
+///   slots followed by the name and value bytes they point into.
+/// @details Scanning the fields touches one slot array and one byte run
+///   instead of a vector of string objects scattered over the heap, and
+///   Contains() answers from a bitmask of the HeaderIds present.
+///
+///   Serialized form (SerializeTo(), FromBytes()): the field count and
+///   the byte count as two uint32_t, the slots, then the bytes, in host
+///   byte order. HeaderId values are only stable within one build, so
+///   the form is for handing a block to another thread or process of the
+///   same binary (a shared-memory ring, a worker queue), never for
+///   storage.
+///
+///   A view does not own its memory; it stays valid while the HeaderBlock
+///   (or the serialized bytes) it was made from is unchanged.
+class HeaderBlockView {
+ public:
+  /// @brief Packed field descriptor; offsets are into the byte run.
+  struct Slot {
+    uint32_t name_offset;
+    uint32_t name_length;
+    uint32_t value_offset;
+    uint32_t value_length;
+    HeaderId id;
+    EntryType type;
+    uint8_t reserved[2];
+  };
+  static_assert(sizeof(Slot) == 20, "Slot must stay packed");
+
+  /// @brief Bytes before the slots in the serialized form.
+  static constexpr std::size_t kPrefixBytes = 2 * sizeof(uint32_t);
+  static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+  class Iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = HeaderBlockField;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = HeaderBlockField;
+
+    Iterator(const HeaderBlockView* view, std::size_t i) noexcept
+                    : view_(view), i_(i) {}
+    HeaderBlockField operator*() const noexcept {
+      return (*view_)[i_];
+    }
+    Iterator& operator++() noexcept {
+      ++i_;
+      return *this;
+    }
+    bool operator==(const Iterator& o) const noexcept {
+      return i_ == o.i_;
+    }
+    bool operator!=(const Iterator& o) const noexcept {
+      return i_ != o.i_;
+    }
+
+   private:
+    const HeaderBlockView* view_;
+    std::size_t i_;
+  };
+
+  HeaderBlockView() noexcept = default;
+
+  /// @brief View a serialized block, checking every slot against the
+  ///   byte run. `bytes` must outlive the view.
+  /// @return false if `bytes` is not a well-formed serialized block.
+  static bool FromBytes(absl::Span<const uint8_t> bytes,
+                        HeaderBlockView& out) noexcept;
+
+  std::size_t size() const noexcept {
+    return count_;
+  }
+  bool empty() const noexcept {
+    return count_ == 0;
+  }
+  HeaderBlockField operator[](std::size_t i) const noexcept {
+    const Slot s = SlotAt(i);
+    const char* b = reinterpret_cast<const char*>(bytes_);
+    return {absl::string_view(b + s.name_offset, s.name_length),
+            absl::string_view(b + s.value_offset, s.value_length), s.id,
+            s.type};
+  }
+  Iterator begin() const noexcept {
+    return Iterator(this, 0);
+  }
+  Iterator end() const noexcept {
+    return Iterator(this, count_);
+  }
+
+  /// @brief Whether a field with `id` is present; one bit test.
+  bool Contains(HeaderId id) const noexcept {
+    const std::size_t i = static_cast<std::size_t>(id);
+    return (ids_[i / 64] >> (i % 64)) & 1;
+  }
+  /// @brief Index of the first field with `id` at or after `from`, npos if
+  ///   none. Only the one-byte ids of the slots are compared.
+  std::size_t Find(HeaderId id, std::size_t from = 0) const noexcept;
+  /// @brief Value of the first field with `id`; empty if there is none.
+  absl::string_view Value(HeaderId id) const noexcept {
+    const std::size_t i = Find(id);
+    return i == npos ? absl::string_view() : (*this)[i].value;
+  }
+
+  /// @brief Size of the serialized form.
+  std::size_t ByteSize() const noexcept {
+    return kPrefixBytes + count_ * sizeof(Slot) + bytes_size_;
+  }
+  /// @brief Append the serialized form to `out`.
+  /// @return NONE or OUT_OF_MEMORY (nothing appended).
+  HpackErrorCode SerializeTo(stream::RawBuffer<>& out) const noexcept;
+
+ private:
+  friend class HeaderBlock;
+
+  const uint8_t* slots_ = nullptr;  ///< may be unaligned: read by memcpy
+  const uint8_t* bytes_ = nullptr;
+  uint32_t count_ = 0;
+  uint32_t bytes_size_ = 0;
+  std::array<uint64_t, 2> ids_{};  ///< HeaderIds present, Unknown included
+
+  static_assert(kHeaderIdCount <= 128, "ids_ holds 128 HeaderIds");
+
+  Slot SlotAt(std::size_t i) const noexcept {
+    Slot s;
+    std::memcpy(&s, slots_ + i * sizeof(Slot), sizeof(Slot));
+    return s;
+  }
+};
+
+/// @brief Owning flat header list, filled straight from a Decoder.
+/// @details One arena holds the slot array and, after it, the name and
+///   value bytes; both regions double when full, so a block takes a few
+///   allocations at most and none once a reused HeaderBlock has warmed up
+///   (Clear() keeps the arena). Reserve() sizes it in one go when the
+///   caller knows the header list size, e.g. from
+///   SETTINGS_MAX_HEADER_LIST_SIZE.
+///
+///   Pass it to Decoder::Decode() as the HeaderHandler; View() then gives
+///   the fields in wire order. CopyFrom() makes an independent compact
+///   copy with one allocation and two memcpy calls.
+///
+///   Not thread-safe: owned by the connection's I/O thread; hand its
+///   View() or serialized form to other threads.
+class HeaderBlock : public HeaderHandler {
+ public:
+  HeaderBlock() noexcept = default;
+  HeaderBlock(const HeaderBlock&) = delete;
+  HeaderBlock& operator=(const HeaderBlock&) = delete;
+  HeaderBlock(HeaderBlock&& o) noexcept;
+  HeaderBlock& operator=(HeaderBlock&& o) noexcept;
+
+  /// @brief Append a decoded field; an allocation failure sets Failed().
+  void OnHeader(const DecodedHeader& header) override;
+
+  /// @brief Append one field, copying its name and value.
+  /// @return NONE or OUT_OF_MEMORY (the block is unchanged).
+  HpackErrorCode Append(absl::string_view name, absl::string_view value,
+                        HeaderId id = HeaderId::Unknown,
+                        EntryType type = EntryType::IndexedHeader) noexcept;
+
+  /// @brief Make room for `fields` fields holding `bytes` name and value
+  ///   bytes in total, beyond those already held.
+  HpackErrorCode Reserve(std::size_t fields, std::size_t bytes) noexcept;
+
+  /// @brief Replace the content with a compact copy of `view`.
+  HpackErrorCode CopyFrom(const HeaderBlockView& view) noexcept;
+
+  /// @brief Drop the fields; keeps the arena's capacity.
+  void Clear() noexcept;
+
+  /// @brief A field passed to OnHeader() could not be stored.
+  bool Failed() const noexcept {
+    return failed_;
+  }
+
+  HeaderBlockView View() const noexcept;
+
+ private:
+  using Slot = HeaderBlockView::Slot;
+
+  stream::RawBuffer<> arena_;  ///< slot_cap_ slots, then byte_cap_ bytes
+  std::size_t slot_cap_ = 0;
+  std::size_t byte_cap_ = 0;
+  uint32_t count_ = 0;
+  uint32_t bytes_used_ = 0;
+  std::array<uint64_t, 2> ids_{};
+  bool failed_ = false;
+
+  uint8_t* Bytes() noexcept {
+    return arena_.mutable_raw() + slot_cap_ * sizeof(Slot);
+  }
+  HpackErrorCode Grow(std::size_t slot_cap, std::size_t byte_cap) noexcept;
+};
+
+}  // namespace hpack
+}  // namespace h2v
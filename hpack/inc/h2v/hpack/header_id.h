@@ -0,0 +1,414 @@
+// include/h2v/hpack/header_id.h
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "absl/strings/string_view.h"
+
+namespace h2v {
+namespace hpack {
+
+/// @brief Compact id of a well-known header name.
+/// @details The decoder attaches one to every field (DecodedHeader::id) so
+///   routing and filtering code can switch on an integer instead of
+///   comparing name strings. Covers every RFC 7541 static table name plus
+///   common extras (pseudo-header :protocol, hop-by-hop, CORS, fetch
+///   metadata, gRPC, proxy and tracing headers); any other name is Unknown.
+///   Values are only stable within one build: switch on the enumerators,
+///   never persist the numbers.
+enum class HeaderId : uint8_t {
+  Unknown = 0,
+
+  // static table names (RFC 7541 Appendix A), in table order
+  Authority,
+  Method,
+  Path,
+  Scheme,
+  Status,
+  AcceptCharset,
+  AcceptEncoding,
+  AcceptLanguage,
+  AcceptRanges,
+  Accept,
+  AccessControlAllowOrigin,
+  Age,
+  Allow,
+  Authorization,
+  CacheControl,
+  ContentDisposition,
+  ContentEncoding,
+  ContentLanguage,
+  ContentLength,
+  ContentLocation,
+  ContentRange,
+  ContentType,
+  Cookie,
+  Date,
+  Etag,
+  Expect,
+  Expires,
+  From,
+  Host,
+  IfMatch,
+  IfModifiedSince,
+  IfNoneMatch,
+  IfRange,
+  IfUnmodifiedSince,
+  LastModified,
+  Link,
+  Location,
+  MaxForwards,
+  ProxyAuthenticate,
+  ProxyAuthorization,
+  Range,
+  Referer,
+  Refresh,
+  RetryAfter,
+  Server,
+  SetCookie,
+  StrictTransportSecurity,
+  TransferEncoding,
+  UserAgent,
+  Vary,
+  Via,
+  WwwAuthenticate,
+
+  // extras
+  Protocol,
+  Te,
+  Connection,
+  KeepAlive,
+  ProxyConnection,
+  Upgrade,
+  Origin,
+  Priority,
+  Pragma,
+  UpgradeInsecureRequests,
+  AltSvc,
+  EarlyData,
+  SecFetchDest,
+  SecFetchMode,
+  SecFetchSite,
+  SecFetchUser,
+  SecChUa,
+  SecChUaMobile,
+  SecChUaPlatform,
+  AccessControlAllowCredentials,
+  AccessControlAllowHeaders,
+  AccessControlAllowMethods,
+  AccessControlExposeHeaders,
+  AccessControlMaxAge,
+  AccessControlRequestHeaders,
+  AccessControlRequestMethod,
+  ContentSecurityPolicy,
+  XContentTypeOptions,
+  XFrameOptions,
+  XXssProtection,
+  GrpcTimeout,
+  GrpcEncoding,
+  GrpcAcceptEncoding,
+  GrpcStatus,
+  GrpcMessage,
+  GrpcStatusDetailsBin,
+  GrpcMessageType,
+  GrpcPreviousRpcAttempts,
+  GrpcRetryPushbackMs,
+  Forwarded,
+  XForwardedFor,
+  XForwardedHost,
+  XForwardedProto,
+  XForwardedPort,
+  XForwardedPrefix,
+  XRealIp,
+  XRequestId,
+  Traceparent,
+  Tracestate
+};
+
+constexpr std::size_t kHeaderIdCount =
+    static_cast<std::size_t>(HeaderId::Tracestate) + 1;
+
+/// @brief Lower-case name of every HeaderId, indexed by its value.
+inline constexpr std::array<absl::string_view, kHeaderIdCount> kHeaderIdNames =
+    {{
+        "",
+        // static table names
+        ":authority",
+        ":method",
+        ":path",
+        ":scheme",
+        ":status",
+        "accept-charset",
+        "accept-encoding",
+        "accept-language",
+        "accept-ranges",
+        "accept",
+        "access-control-allow-origin",
+        "age",
+        "allow",
+        "authorization",
+        "cache-control",
+        "content-disposition",
+        "content-encoding",
+        "content-language",
+        "content-length",
+        "content-location",
+        "content-range",
+        "content-type",
+        "cookie",
+        "date",
+        "etag",
+        "expect",
+        "expires",
+        "from",
+        "host",
+        "if-match",
+        "if-modified-since",
+        "if-none-match",
+        "if-range",
+        "if-unmodified-since",
+        "last-modified",
+        "link",
+        "location",
+        "max-forwards",
+        "proxy-authenticate",
+        "proxy-authorization",
+        "range",
+        "referer",
+        "refresh",
+        "retry-after",
+        "server",
+        "set-cookie",
+        "strict-transport-security",
+        "transfer-encoding",
+        "user-agent",
+        "vary",
+        "via",
+        "www-authenticate",
+        // extras
+        ":protocol",
+        "te",
+        "connection",
+        "keep-alive",
+        "proxy-connection",
+        "upgrade",
+        "origin",
+        "priority",
+        "pragma",
+        "upgrade-insecure-requests",
+        "alt-svc",
+        "early-data",
+        "sec-fetch-dest",
+        "sec-fetch-mode",
+        "sec-fetch-site",
+        "sec-fetch-user",
+        "sec-ch-ua",
+        "sec-ch-ua-mobile",
+        "sec-ch-ua-platform",
+        "access-control-allow-credentials",
+        "access-control-allow-headers",
+        "access-control-allow-methods",
+        "access-control-expose-headers",
+        "access-control-max-age",
+        "access-control-request-headers",
+        "access-control-request-method",
+        "content-security-policy",
+        "x-content-type-options",
+        "x-frame-options",
+        "x-xss-protection",
+        "grpc-timeout",
+        "grpc-encoding",
+        "grpc-accept-encoding",
+        "grpc-status",
+        "grpc-message",
+        "grpc-status-details-bin",
+        "grpc-message-type",
+        "grpc-previous-rpc-attempts",
+        "grpc-retry-pushback-ms",
+        "forwarded",
+        "x-forwarded-for",
+        "x-forwarded-host",
+        "x-forwarded-proto",
+        "x-forwarded-port",
+        "x-forwarded-prefix",
+        "x-real-ip",
+        "x-request-id",
+        "traceparent",
+        "tracestate",
+    }};
+
+/// @brief HeaderId of each static table entry, indexed by HPACK index - 1.
+inline constexpr std::array<HeaderId, 61> kStaticHeaderIds = {{
+    HeaderId::Authority,                 //  1
+    HeaderId::Method,                    //  2
+    HeaderId::Method,                    //  3
+    HeaderId::Path,                      //  4
+    HeaderId::Path,                      //  5
+    HeaderId::Scheme,                    //  6
+    HeaderId::Scheme,                    //  7
+    HeaderId::Status,                    //  8
+    HeaderId::Status,                    //  9
+    HeaderId::Status,                    // 10
+    HeaderId::Status,                    // 11
+    HeaderId::Status,                    // 12
+    HeaderId::Status,                    // 13
+    HeaderId::Status,                    // 14
+    HeaderId::AcceptCharset,             // 15
+    HeaderId::AcceptEncoding,            // 16
+    HeaderId::AcceptLanguage,            // 17
+    HeaderId::AcceptRanges,              // 18
+    HeaderId::Accept,                    // 19
+    HeaderId::AccessControlAllowOrigin,  // 20
+    HeaderId::Age,                       // 21
+    HeaderId::Allow,                     // 22
+    HeaderId::Authorization,             // 23
+    HeaderId::CacheControl,              // 24
+    HeaderId::ContentDisposition,        // 25
+    HeaderId::ContentEncoding,           // 26
+    HeaderId::ContentLanguage,           // 27
+    HeaderId::ContentLength,             // 28
+    HeaderId::ContentLocation,           // 29
+    HeaderId::ContentRange,              // 30
+    HeaderId::ContentType,               // 31
+    HeaderId::Cookie,                    // 32
+    HeaderId::Date,                      // 33
+    HeaderId::Etag,                      // 34
+    HeaderId::Expect,                    // 35
+    HeaderId::Expires,                   // 36
+    HeaderId::From,                      // 37
+    HeaderId::Host,                      // 38
+    HeaderId::IfMatch,                   // 39
+    HeaderId::IfModifiedSince,           // 40
+    HeaderId::IfNoneMatch,               // 41
+    HeaderId::IfRange,                   // 42
+    HeaderId::IfUnmodifiedSince,         // 43
+    HeaderId::LastModified,              // 44
+    HeaderId::Link,                      // 45
+    HeaderId::Location,                  // 46
+    HeaderId::MaxForwards,               // 47
+    HeaderId::ProxyAuthenticate,         // 48
+    HeaderId::ProxyAuthorization,        // 49
+    HeaderId::Range,                     // 50
+    HeaderId::Referer,                   // 51
+    HeaderId::Refresh,                   // 52
+    HeaderId::RetryAfter,                // 53
+    HeaderId::Server,                    // 54
+    HeaderId::SetCookie,                 // 55
+    HeaderId::StrictTransportSecurity,   // 56
+    HeaderId::TransferEncoding,          // 57
+    HeaderId::UserAgent,                 // 58
+    HeaderId::Vary,                      // 59
+    HeaderId::Via,                       // 60
+    HeaderId::WwwAuthenticate,           // 61
+}};
+
+namespace header_id_internal {
+
+/// @brief Perfect hash over the catalogue: length plus four sampled bytes,
+///   folded by a multiplicative hash into kSlotBits bits. The multiplier was
+///   searched offline; adding a name may need a new one, the static_assert
+///   below rejects any collision.
+constexpr int kSlotBits = 9;
+constexpr uint64_t kMultiplier = 0xb548c782c3b32cadull;
+
+constexpr uint32_t Slot(const char* p, std::size_t n) noexcept {
+  const uint64_t key =
+      uint64_t(n) | uint64_t(uint8_t(p[0])) << 8 |
+      uint64_t(uint8_t(p[n / 2])) << 16 | uint64_t(uint8_t(p[n - 1])) << 24 |
+      uint64_t(uint8_t(p[n > 1 ? n - 2 : 0])) << 32;
+  return static_cast<uint32_t>((key * kMultiplier) >> (64 - kSlotBits));
+}
+
+constexpr uint8_t Lower(char c) noexcept {
+  return static_cast<uint8_t>(uint8_t(c) |
+                              (uint8_t(c - 'A') < 26 ? 0x20 : 0));
+}
+
+/// @brief Slot() of the lowercase form of `p`: only the sampled bytes are
+///   folded.
+constexpr uint32_t FoldedSlot(const char* p, std::size_t n) noexcept {
+  const uint64_t key = uint64_t(n) | uint64_t(Lower(p[0])) << 8 |
+                       uint64_t(Lower(p[n / 2])) << 16 |
+                       uint64_t(Lower(p[n - 1])) << 24 |
+                       uint64_t(Lower(p[n > 1 ? n - 2 : 0])) << 32;
+  return static_cast<uint32_t>((key * kMultiplier) >> (64 - kSlotBits));
+}
+
+using Slots = std::array<HeaderId, std::size_t(1) << kSlotBits>;
+
+constexpr Slots Build() {
+  Slots t{};
+  for (std::size_t i = 1; i < kHeaderIdCount; ++i) {
+    const absl::string_view name = kHeaderIdNames[i];
+    t[Slot(name.data(), name.size())] = static_cast<HeaderId>(i);
+  }
+  return t;
+}
+
+constexpr bool Perfect(const Slots& t) {
+  for (std::size_t i = 1; i < kHeaderIdCount; ++i) {
+    const absl::string_view name = kHeaderIdNames[i];
+    if (t[Slot(name.data(), name.size())] != static_cast<HeaderId>(i)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace header_id_internal
+
+inline constexpr header_id_internal::Slots kHeaderIdSlots =
+    header_id_internal::Build();
+static_assert(header_id_internal::Perfect(kHeaderIdSlots),
+              "HeaderId perfect hash collides: pick another kMultiplier");
+
+/// @brief Name of `id`; empty for Unknown.
+constexpr absl::string_view HeaderIdName(HeaderId id) noexcept {
+  return kHeaderIdNames[static_cast<std::size_t>(id)];
+}
+
+/// @brief HeaderId of a static table entry; `index` must be in [1, 61].
+constexpr HeaderId StaticHeaderId(uint32_t index) noexcept {
+  return kStaticHeaderIds[index - 1];
+}
+
+/// @brief Id of a (lower-case) header name: one hash, one probe, one
+///   memcmp. Unknown when the name is not in the catalogue.
+inline HeaderId LookupHeaderId(absl::string_view name) noexcept {
+  if (name.empty()) {
+    return HeaderId::Unknown;
+  }
+  const HeaderId id =
+      kHeaderIdSlots[header_id_internal::Slot(name.data(), name.size())];
+  const absl::string_view candidate = HeaderIdName(id);
+  return candidate.size() == name.size() &&
+                 std::memcmp(candidate.data(), name.data(), name.size()) == 0
+             ? id
+             : HeaderId::Unknown;
+}
+
+/// @brief LookupHeaderId() for a name in any letter case, as HTTP/1.1
+///   sends it: the catalogue name it matches is its lowercase form.
+inline HeaderId LookupHeaderIdIgnoreCase(absl::string_view name) noexcept {
+  if (name.empty()) {
+    return HeaderId::Unknown;
+  }
+  const HeaderId id =
+      kHeaderIdSlots[header_id_internal::FoldedSlot(name.data(), name.size())];
+  const absl::string_view candidate = HeaderIdName(id);
+  if (candidate.size() != name.size()) {
+    return HeaderId::Unknown;
+  }
+  for (std::size_t i = 0; i < name.size(); ++i) {
+    if (header_id_internal::Lower(name[i]) != uint8_t(candidate[i])) {
+      return HeaderId::Unknown;
+    }
+  }
+  return id;
+}
+
+}  // namespace hpack
+}  // namespace h2v
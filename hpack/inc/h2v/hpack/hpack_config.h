@@ -5,6 +5,9 @@
 namespace h2v {
 namespace hpack {
 
+class MemoryBudget;
+class ValuePool;
+
 /// @brief Configuration for HPACK codec behavior and resource limits.
 /// @details
 ///   - Controls the maximum dynamic table size (in bytes) to bound memory
@@ -18,10 +21,34 @@ struct HpackConfig {
   /// or error (per strict vs. lenient mode).
   std::size_t max_dynamic_table_size_bytes = 4096;
 
-  /// Maximum total size (in octets) of a header list (sum of name+value
-  /// lengths). Decode operations on larger payloads fail immediately.
+  /// Maximum total size (in octets) of a header list: decoded name + value
+  /// + 32 per field (RFC 9113 §6.5.2). Enforced incrementally by the
+  /// Decoder, which stops emitting fields as soon as it is crossed.
   std::size_t max_header_list_size_bytes = 16 * 1024;
 
+  /// Encoder: split `cookie` into one field per cookie-pair (RFC 9113
+  /// §8.2.3) so unchanged crumbs stay indexed in the dynamic table.
+  bool crumble_cookies = false;
+
+  /// Decoder: join the `cookie` fields of a block with "; " into a single
+  /// field, emitted once the block is complete (RFC 9113 §8.2.3).
+  bool join_cookies = false;
+
+  /// Decoder: treat a block holding a field name or value that RFC 9113
+  /// §8.2.1 forbids (uppercase, CTL or non-token name; NUL, CR, LF or edge
+  /// whitespace in the value) as malformed. Huffman strings are checked
+  /// while they are decoded; table hits carry the verdict of their insert.
+  bool validate_fields = true;
+
+  /// Process-wide accountant the dynamic tables charge (not owned, must
+  /// outlive every codec using it); nullptr: unaccounted.
+  MemoryBudget* memory_budget = nullptr;
+
+  /// Decoder: process-wide pool dynamic table values of at least its
+  /// `min_bytes` are interned in (not owned, must outlive every codec
+  /// using it); nullptr: every entry keeps its own copy.
+  ValuePool* value_pool = nullptr;
+
   /// If true, any encode/decode error aborts the operation (fail-fast).
   /// If false, recoverable anomalies are logged and parsing continues.
   bool strict_mode = true;
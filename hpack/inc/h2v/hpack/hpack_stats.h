@@ -28,6 +28,9 @@ struct HpackStats {
   /// Total number of header fields decoded.
   uint64_t total_decoded_headers = 0;
 
+  /// Literals the encoder's AdmissionPolicy kept out of the dynamic table.
+  uint64_t admission_rejects = 0;
+
   /// Total bytes processed (sum of all payloads encoded + decoded).
   uint64_t total_bytes_processed = 0;
 
@@ -0,0 +1,82 @@
+// include/h2v/hpack/http1_converter.h
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "h2v/hpack/encoder.h"
+#include "h2v/hpack/error_code.h"
+#include "h2v/hpack/header_id.h"
+#include "h2v/stream/raw_buffer.h"
+
+namespace h2v {
+namespace hpack {
+
+/// @brief Converts HTTP/1.1 message heads into HTTP/2 header blocks for a
+///   gateway bridging HTTP/1.1 peers onto HTTP/2.
+/// @details Convert() takes the raw head (start line and header lines, as
+///   received) and feeds the Encoder directly, with no header vector or
+///   string copies in between:
+///
+///   - header lines are sliced in place, in one pass that also validates
+///     them; the views are kept in a vector the converter reuses, so the
+///     Host and Connection lines are honoured wherever they appear;
+///   - the start line becomes the pseudo-header section (RFC 9113
+///     §8.3): `:method`, `:scheme`, `:authority` (from an absolute-form
+///     target, else from Host) and `:path`, or `:status` for a response;
+///     common values such as GET, / or 200 end up as static table
+///     indexes;
+///   - connection-specific fields are dropped (RFC 9113 §8.2.2):
+///     connection, keep-alive, proxy-connection, transfer-encoding,
+///     upgrade, any field Connection names, and te unless it is
+///     "trailers";
+///   - names reach Encoder::EncodeFoldedField() in the case they were
+///     received, well-known ones resolve to their catalogue form there;
+///   - cookie values are split into one field per cookie-pair (RFC 9113
+///     §8.2.3) so unchanged pairs stay indexed.
+///
+///   A malformed head is rejected before anything is encoded, so the
+///   caller can answer 400/502 without putting the encoder out of sync.
+///
+///   Not thread-safe: owned by the connection's I/O thread, like the
+///   Encoder it feeds.
+class Http1Converter {
+ public:
+  explicit Http1Converter(Encoder& encoder) noexcept : encoder_(encoder) {}
+
+  /// @brief Convert one request or response head into a header block
+  ///   appended to `out`.
+  /// @param head    start line and header lines, CRLF or LF terminated;
+  ///   the empty line ending the head and anything after it are ignored.
+  /// @param scheme  `:scheme` of an origin-form request ("https" behind a
+  ///   TLS listener); absolute-form targets carry their own.
+  /// @return NONE; CONVERT_MALFORMED_HTTP1 for a head RFC 9112 rejects
+  ///   (an HTTP/1.1 origin-form request without Host included) or whose
+  ///   authority carries userinfo, which :authority must not (RFC 9113
+  ///   §8.3.1); INVALID_ARGS for an empty `scheme` an origin-form request
+  ///   needs (nothing written, the encoder untouched); or an Encoder
+  ///   error.
+  HpackErrorCode Convert(absl::string_view head, absl::string_view scheme,
+                         stream::RawBuffer<>& out) noexcept;
+
+ private:
+  struct Field {
+    absl::string_view name;  ///< as received
+    absl::string_view value;
+    HeaderId id;
+  };
+
+  Encoder& encoder_;
+  std::vector<Field> fields_;  ///< header lines of the current head
+  std::vector<absl::string_view> nominated_;  ///< names listed in Connection
+  std::string path_;  ///< `:path` rebuilt from an absolute-form target
+
+  /// @brief Slice and validate the header lines of `rest`.
+  HpackErrorCode ParseFields(absl::string_view rest) noexcept;
+  bool Nominated(absl::string_view name) const noexcept;
+  HpackErrorCode EmitFields(stream::RawBuffer<>& out) noexcept;
+};
+
+}  // namespace hpack
+}  // namespace h2v
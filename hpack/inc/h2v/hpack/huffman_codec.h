@@ -7,6 +7,8 @@
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
 #include "h2v/hpack/error_code.h"
+#include "h2v/hpack/field_class.h"
+#include "h2v/hpack/field_hash.h"
 #include "h2v/stream/raw_buffer.h"
 
 #if defined(H2V_HPACK_HUFFMAN_ENCODER_USE_BIT_OP) && \
@@ -55,6 +57,23 @@ inline static void mark_buffer_write(stream::RawBuffer<>& buffer,
   buffer.append(write_size);
 }
 
+/// Exact Huffman-encoded size of `in_size` bytes, EOS padding included.
+/// Lets encoders choose between Huffman and raw octets, and size the output,
+/// before encoding anything.
+inline static size_t EncodedLength(const uint8_t* in_ptr,
+                                   size_t in_size) noexcept {
+  uint64_t bits = 0;
+  for (size_t i = 0; i < in_size; i++) {
+#if defined(H2V_HPACK_HUFFMAN_ENCODER_USE_BIT_OP) && \
+    (H2V_HPACK_HUFFMAN_ENCODER_USE_BIT_OP == 1)
+    bits += LEN[in_ptr[i]];
+#else
+    bits += table::kEncodeTable[in_ptr[i]].bit_length;
+#endif
+  }
+  return size_t((bits + 7) / 8);
+}
+
 #if defined(H2V_HPACK_HUFFMAN_ENCODER_USE_BIT_OP) || \
     (H2V_HPACK_HUFFMAN_ENCODER_USE_BIT_OP == 1)
 
@@ -428,14 +447,28 @@ inline static HpackErrorCode FastEncode(const uint8_t* in_ptr, size_t in_size,
 #if !defined(H2V_HPACK_HUFFMAN_DECODER_USE_FULLBYTE) || \
     (H2V_HPACK_HUFFMAN_DECODER_USE_FULLBYTE == 0)
 
-/// Huffman Decode using 4 Bit Nibble precomputed FSM
-inline static HpackErrorCode FastDecode(const uint8_t* in_ptr, size_t in_size,
-                                        uint8_t* out_ptr, size_t out_size,
-                                        size_t& decoded_size,
-                                        bool trace = false) noexcept {
+/// Huffman Decode using 4 Bit Nibble precomputed FSM, fusing the work a
+/// decoded field needs next into the same pass: with kClassify the
+/// FIELD_CLASS bits of each entry are ORed into `classes` (field_class.h),
+/// with kHash every emitted octet is folded into `hash` (field_hash.h).
+/// Both are left untouched when not requested.
+template <bool kClassify, bool kHash>
+inline static HpackErrorCode FastDecodeFused(const uint8_t* in_ptr,
+                                             size_t in_size, uint8_t* out_ptr,
+                                             size_t out_size,
+                                             size_t& decoded_size,
+                                             uint8_t& classes,
+                                             uint64_t& hash) noexcept {
+  if (kClassify) {
+    classes = 0;
+  }
+  uint64_t h = kFieldHashSeed;
   // We assume it is empty string
   if (in_size == 0) {
     decoded_size = 0;
+    if (kHash) {
+      hash = FieldHashFinish(h);
+    }
     return HPACK_ERR::NONE;
   }
 
@@ -471,18 +504,27 @@ inline static HpackErrorCode FastDecode(const uint8_t* in_ptr, size_t in_size,
       }
       uint16_t next_state = (packed >> 22) & 0x01FF;  // 9 bits
       uint8_t emit_count = (packed >> 20) & 0x03;     // 2 bits
+      if (kClassify) {
+        classes |= packed & 0x0F;
+      }
       if (emit_count == 2) {
         uint8_t c0 = (packed >> 12) & 0xFF;
         uint8_t c1 = (packed >> 4) & 0xFF;
         *(out_ptr + (out_pos)) = c0;
         *(out_ptr + (out_pos + 1)) = c1;
         out_pos += 2;
+        if (kHash) {
+          h = FieldHashStep(FieldHashStep(h, c0), c1);
+        }
         // out.push_back(char(c0));
         // out.push_back(char(c1));
       } else if (emit_count == 1) {
         uint8_t c0 = (packed >> 12) & 0xFF;
         *(out_ptr + (out_pos)) = c0;
         out_pos += 1;
+        if (kHash) {
+          h = FieldHashStep(h, c0);
+        }
         // out.push_back(char(c0));
       }
       state = next_state;
@@ -498,18 +540,27 @@ inline static HpackErrorCode FastDecode(const uint8_t* in_ptr, size_t in_size,
       }
       uint16_t next_state = (packed >> 22) & 0x01FF;
       uint8_t emit_count = (packed >> 20) & 0x03;
+      if (kClassify) {
+        classes |= packed & 0x0F;
+      }
       if (emit_count == 2) {
         uint8_t c0 = (packed >> 12) & 0xFF;
         uint8_t c1 = (packed >> 4) & 0xFF;
         *(out_ptr + (out_pos)) = c0;
         *(out_ptr + (out_pos + 1)) = c1;
         out_pos += 2;
+        if (kHash) {
+          h = FieldHashStep(FieldHashStep(h, c0), c1);
+        }
         // out.push_back(char(c0));
         // out.push_back(char(c1));
       } else if (emit_count == 1) {
         uint8_t c0 = (packed >> 12) & 0xFF;
         *(out_ptr + (out_pos)) = c0;
         out_pos += 1;
+        if (kHash) {
+          h = FieldHashStep(h, c0);
+        }
         // out.push_back(char(c0));
       }
       state = next_state;
@@ -551,9 +602,49 @@ inline static HpackErrorCode FastDecode(const uint8_t* in_ptr, size_t in_size,
   }
 
   decoded_size = out_pos;
+  if (kHash) {
+    hash = FieldHashFinish(h);
+  }
   return HPACK_ERR::NONE;
 }
 
+/// Huffman Decode using 4 Bit Nibble precomputed FSM
+inline static HpackErrorCode FastDecode(const uint8_t* in_ptr, size_t in_size,
+                                        uint8_t* out_ptr, size_t out_size,
+                                        size_t& decoded_size,
+                                        bool trace = false) noexcept {
+  uint8_t classes = 0;
+  uint64_t hash = 0;
+  return FastDecodeFused<false, false>(in_ptr, in_size, out_ptr, out_size,
+                                       decoded_size, classes, hash);
+}
+
+/// Huffman Decode that also reports the FIELD_CLASS bits of the decoded
+/// octets (field_class.h), read from the same table entries: validating a
+/// field costs no second pass over it.
+inline static HpackErrorCode FastDecodeClassify(const uint8_t* in_ptr,
+                                                size_t in_size,
+                                                uint8_t* out_ptr,
+                                                size_t out_size,
+                                                size_t& decoded_size,
+                                                uint8_t& classes) noexcept {
+  uint64_t hash = 0;
+  return FastDecodeFused<true, false>(in_ptr, in_size, out_ptr, out_size,
+                                      decoded_size, classes, hash);
+}
+
+/// Huffman Decode that also returns the FieldHash() of the decoded octets,
+/// folded in as each symbol is emitted.
+inline static HpackErrorCode FastDecodeHash(const uint8_t* in_ptr,
+                                            size_t in_size, uint8_t* out_ptr,
+                                            size_t out_size,
+                                            size_t& decoded_size,
+                                            uint64_t& hash) noexcept {
+  uint8_t classes = 0;
+  return FastDecodeFused<false, true>(in_ptr, in_size, out_ptr, out_size,
+                                      decoded_size, classes, hash);
+}
+
 #endif
 
 #if defined(H2V_HPACK_HUFFMAN_DECODER_USE_FULLBYTE) && \
@@ -562,6 +653,50 @@ static HpackErrorCode FastDecode(const uint8_t* in_ptr, size_t in_size,
                                  uint8_t* out_ptr, size_t out_size,
                                  size_t& decoded_size) noexcept;
 
+/// The full-byte table carries no class bits: classify and hash the
+/// decoded octets afterwards.
+template <bool kClassify, bool kHash>
+inline static HpackErrorCode FastDecodeFused(const uint8_t* in_ptr,
+                                             size_t in_size, uint8_t* out_ptr,
+                                             size_t out_size,
+                                             size_t& decoded_size,
+                                             uint8_t& classes,
+                                             uint64_t& hash) noexcept {
+  const HpackErrorCode rc =
+      FastDecode(in_ptr, in_size, out_ptr, out_size, decoded_size);
+  if (rc != HPACK_ERR::NONE) {
+    return rc;
+  }
+  if (kClassify) {
+    classes = ClassifyField(out_ptr, decoded_size);
+  }
+  if (kHash) {
+    hash = FieldHash(out_ptr, decoded_size);
+  }
+  return HPACK_ERR::NONE;
+}
+
+inline static HpackErrorCode FastDecodeClassify(const uint8_t* in_ptr,
+                                                size_t in_size,
+                                                uint8_t* out_ptr,
+                                                size_t out_size,
+                                                size_t& decoded_size,
+                                                uint8_t& classes) noexcept {
+  uint64_t hash = 0;
+  return FastDecodeFused<true, false>(in_ptr, in_size, out_ptr, out_size,
+                                      decoded_size, classes, hash);
+}
+
+inline static HpackErrorCode FastDecodeHash(const uint8_t* in_ptr,
+                                            size_t in_size, uint8_t* out_ptr,
+                                            size_t out_size,
+                                            size_t& decoded_size,
+                                            uint64_t& hash) noexcept {
+  uint8_t classes = 0;
+  return FastDecodeFused<false, true>(in_ptr, in_size, out_ptr, out_size,
+                                      decoded_size, classes, hash);
+}
+
 #endif
 
 }  // namespace huffman
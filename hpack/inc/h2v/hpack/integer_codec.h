@@ -15,16 +15,14 @@ static stream::RawBuffer<> make_encoding_buffer() {
 }
 
 // Decodes an HPACK‐encoded integer from 'in'.
-//   - 'prefix_bits' is the number of bits used for the integer in the first
-//   byte (N).
-//   - Returns a pair: { decoded_value, bytes_consumed }.
-//   - Caller must ensure that 'in_len' ≥ 1, and that the buffer contains a
-//   valid encoding.
-//   - If the sequence is malformed (e.g. never-ending continuation bytes),
-//   behavior is undefined.
+//   - 'N' is the number of bits used for the integer in the first byte.
+//   - On success 'out_val' holds the value and 'out_size' the bytes consumed.
+//   - Returns INTEGER_DECODE_TRUNCATED if 'in' ends before the final
+//   continuation byte (feed more input and retry), and
+//   INTEGER_DECODE_OVERFLOW if the value does not fit in 32 bits.
 //
 // Example: to decode from a buffer where the first byte is 0x1F and N=5:
-//   auto err_code = decode_integer(buffer, 1, 5, val, used);
+//   auto err_code = DecodeInteger(buffer, size, 5, val, used);
 //   // If buffer[0]=0x1F, then we know value ≥ 31, so we read more bytes.
 inline int32_t DecodeInteger(const uint8_t* in, size_t in_size, int N,
                               uint32_t& out_val, size_t& out_size) noexcept {
@@ -50,33 +48,31 @@ inline int32_t DecodeInteger(const uint8_t* in, size_t in_size, int N,
     return HPACK_ERR::NONE;
   }
 
-  // 4) Otherwise, we have to accumulate continuation bytes.
-  //    We start with 'value = prefix_mask', and 'shift = 0':
-  value = prefix_mask;
-  uint32_t multiplier = 0;
+  // 4) Otherwise, accumulate continuation bytes. Each contributes
+  //    (b & 0x7F) << shift; the last one has MSB=0. Five continuation bytes
+  //    cover 35 bits, anything longer (or larger than 32 bits) is rejected.
+  uint64_t acc = prefix_mask;
+  uint32_t shift = 0;
   size_t idx = 1;
-
-  // 5) Loop over continuation bytes (max 4 bytes for 32-bit ints, but we code
-  // as “while”):
-  //    Each continuation byte contributes (b & 0x7F) << multiplier, then
-  //    multiplier += 7. We stop when we see a byte with MSB=0.
   while (true) {
-    // We assume the caller has ensured in_len ≥ idx+1 for valid encodings.
-    uint8_t b = in[idx];
-    idx++;
-
-    // Add the low 7 bits of b, shifted by 'multiplier':
-    value += uint32_t(b & 0x7F) << multiplier;
-    // If MSB is zero, this is the final byte:
+    if (idx >= in_size) {
+      return HPACK_ERR::INTEGER_DECODE_TRUNCATED;
+    }
+    const uint8_t b = in[idx++];
+    acc += uint64_t(b & 0x7F) << shift;
+    if (acc > 0xFFFFFFFFull) {
+      return HPACK_ERR::INTEGER_DECODE_OVERFLOW;
+    }
     if ((b & 0x80) == 0) {
       break;
     }
-    multiplier += 7;
-    // (In proper HPACK you never encode > 32-bit values, so multiplier never
-    // exceeds 28.)
+    shift += 7;
+    if (shift > 28) {
+      return HPACK_ERR::INTEGER_DECODE_OVERFLOW;
+    }
   }
 
-  out_val = value;
+  out_val = uint32_t(acc);
   out_size = idx;
 
   return HPACK_ERR::NONE;
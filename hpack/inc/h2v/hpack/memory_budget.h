@@ -0,0 +1,100 @@
+// include/h2v/hpack/memory_budget.h
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+namespace h2v {
+namespace hpack {
+
+/// @brief Process-wide memory state of the HPACK tables.
+enum class MemoryPressure : uint8_t {
+  None = 0,
+  High,     ///< cap every table at the pressure sizes
+  Critical  ///< drop compression state entirely
+};
+
+/// @brief Thresholds of a MemoryBudget.
+struct MemoryBudgetConfig {
+  /// Bytes all tables charging this budget may hold together.
+  std::size_t limit_bytes = 64 * 1024 * 1024;
+  /// Pressure levels, in 1/1000 of the limit. A level is left once usage
+  /// falls below 90% of its threshold, so it does not flap.
+  uint32_t high_permille = 800;
+  uint32_t critical_permille = 950;
+  /// Encoder table cap under MemoryPressure::High.
+  std::size_t pressure_table_bytes = 512;
+};
+
+/// @brief Process-wide accountant for HPACK table memory.
+/// @details Encoders and decoders point at it through
+///   HpackConfig::memory_budget and charge their entries (RFC 7541 size)
+///   and ring storage as they grow, releasing them on eviction:
+///
+///   - decoders charge unconditionally (they must mirror the peer);
+///   - encoders TryCharge() and send the field without indexing when it
+///     would cross the limit;
+///   - when usage crosses a threshold the level changes, Generation()
+///     ticks and the pressure callback runs once, on the thread whose
+///     charge or release caused it.
+///
+///   Tables are not thread-safe, so the budget never touches them: an
+///   Encoder picks the new level up at the start of its next block (one
+///   relaxed load), shrinking with a matching size update. Idle
+///   connections encode nothing, so the callback is where the application
+///   schedules Encoder::CheckMemoryPressure() on their I/O threads and
+///   ticks their TableSizeController to advertise smaller decoder tables.
+///
+///   Thread-safe.
+class MemoryBudget {
+ public:
+  using PressureCallback = std::function<void(MemoryPressure level)>;
+
+  explicit MemoryBudget(const MemoryBudgetConfig& config = {}) noexcept;
+  MemoryBudget(const MemoryBudget&) = delete;
+  MemoryBudget& operator=(const MemoryBudget&) = delete;
+
+  /// @brief Set before any table charges the budget.
+  void SetPressureCallback(PressureCallback callback) noexcept {
+    callback_ = std::move(callback);
+  }
+
+  /// @brief Charge `bytes` even past the limit.
+  void Charge(std::size_t bytes) noexcept;
+  /// @brief Charge `bytes` unless that crosses the limit.
+  bool TryCharge(std::size_t bytes) noexcept;
+  void Release(std::size_t bytes) noexcept;
+
+  MemoryPressure Pressure() const noexcept {
+    return level_.load(std::memory_order_relaxed);
+  }
+  /// @brief Bumped on every level change.
+  uint32_t Generation() const noexcept {
+    return generation_.load(std::memory_order_acquire);
+  }
+  std::size_t Used() const noexcept {
+    return used_.load(std::memory_order_relaxed);
+  }
+  std::size_t Limit() const noexcept {
+    return config_.limit_bytes;
+  }
+  /// @brief Encoder table cap at `level` (SIZE_MAX: no cap).
+  std::size_t TableCap(MemoryPressure level) const noexcept;
+
+ private:
+  MemoryBudgetConfig config_;
+  std::size_t high_bytes_;
+  std::size_t critical_bytes_;
+  PressureCallback callback_;
+  std::atomic<std::size_t> used_{0};
+  std::atomic<MemoryPressure> level_{MemoryPressure::None};
+  std::atomic<uint32_t> generation_{0};
+
+  void Update(std::size_t used) noexcept;
+};
+
+}  // namespace hpack
+}  // namespace h2v
@@ -0,0 +1,127 @@
+// include/h2v/hpack/request_pseudo_headers.h
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "absl/strings/string_view.h"
+#include "h2v/hpack/decoder.h"
+#include "h2v/hpack/header_id.h"
+#include "h2v/stream/raw_buffer.h"
+
+namespace h2v {
+namespace hpack {
+
+/// @brief Request method carried by `:method`.
+enum class RequestMethod : uint8_t {
+  None = 0,  ///< no :method (yet)
+  Get,
+  Post,
+  Head,
+  Put,
+  Delete,
+  Connect,
+  Options,
+  Trace,
+  Patch,
+  Other  ///< extension method, see RequestPseudoHeaders::MethodName()
+};
+
+/// @brief Map a method token to its enum (case-sensitive, RFC 9110 §9.1).
+RequestMethod ParseRequestMethod(absl::string_view token) noexcept;
+
+/// @brief Fixed-layout request pseudo-header section (RFC 9113 §8.3.1).
+/// @details Filled by Decoder::Decode(..., RequestPseudoHeaders&) while the
+///   leading pseudo-headers are parsed; they never reach the HeaderHandler.
+///   The section is checked as it arrives: a duplicate, an unknown or
+///   response pseudo-header, or one following a regular field makes the
+///   block malformed at once, and the missing-field rules are applied as
+///   soon as the first regular field (or the end of the block) closes the
+///   section, before any regular field is handed out.
+///
+///   `:method` resolves to an enum without a string compare when it is the
+///   static entry 2 (GET) or 3 (POST). Values are copied into an internal
+///   arena: the views stay valid until the next Clear() or decode of a new
+///   block into this object, so reuse one descriptor per connection to
+///   keep the arena warm.
+///
+///   Not thread-safe: owned by the connection's I/O thread.
+class RequestPseudoHeaders {
+ public:
+  enum Field : uint8_t {
+    kMethod = 1u << 0,
+    kScheme = 1u << 1,
+    kAuthority = 1u << 2,
+    kPath = 1u << 3,
+    kProtocol = 1u << 4  ///< extended CONNECT (RFC 8441)
+  };
+
+  /// @brief Outcome of Add() for one decoded field.
+  enum class AddResult : uint8_t {
+    Regular,    ///< not a pseudo-header: hand it to the HeaderHandler
+    Stored,     ///< pseudo-header recorded
+    Malformed,  ///< the request is malformed (RFC 9113 §8.1.1)
+    OutOfMemory
+  };
+
+  RequestMethod Method() const noexcept {
+    return method_;
+  }
+  absl::string_view MethodName() const noexcept {
+    return Get(0);
+  }
+  absl::string_view Scheme() const noexcept {
+    return Get(1);
+  }
+  absl::string_view Authority() const noexcept {
+    return Get(2);
+  }
+  absl::string_view Path() const noexcept {
+    return Get(3);
+  }
+  absl::string_view Protocol() const noexcept {
+    return Get(4);
+  }
+  bool Has(Field f) const noexcept {
+    return (present_ & f) != 0;
+  }
+  /// @brief The section was closed and passed the request rules.
+  bool Valid() const noexcept {
+    return closed_ && valid_;
+  }
+
+  /// @brief Forget the previous request; keeps the arena's capacity.
+  void Clear() noexcept;
+
+  /// @brief Record one field of the block, in wire order.
+  AddResult Add(const DecodedHeader& header) noexcept;
+
+  /// @brief Close the section (first regular field or end of block) and
+  ///   apply the required-field rules of RFC 9113 §8.3.1 / RFC 8441 §4.
+  /// @return false if the request is malformed.
+  bool CloseSection() noexcept;
+
+ private:
+  struct Slice {
+    uint32_t offset = 0;
+    uint32_t length = 0;
+  };
+
+  stream::RawBuffer<> arena_;
+  std::array<Slice, 5> slices_{};
+  RequestMethod method_ = RequestMethod::None;
+  uint8_t present_ = 0;
+  bool closed_ = false;
+  bool valid_ = false;
+
+  absl::string_view Get(std::size_t slot) const noexcept {
+    const Slice& s = slices_[slot];
+    return absl::string_view(reinterpret_cast<const char*>(arena_.raw()) +
+                                 s.offset,
+                             s.length);
+  }
+};
+
+}  // namespace hpack
+}  // namespace h2v
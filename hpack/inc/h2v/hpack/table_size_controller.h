@@ -0,0 +1,100 @@
+// include/h2v/hpack/table_size_controller.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "h2v/hpack/encoder.h"
+#include "h2v/hpack/hpack_stats.h"
+#include "h2v/hpack/memory_budget.h"
+
+namespace h2v {
+namespace hpack {
+
+/// @brief Bounds and pacing of a TableSizeController.
+struct TableSizeControllerConfig {
+  /// Encoder table size of a new or re-awakened connection.
+  std::size_t initial_bytes = 4096;
+  /// Smallest size an active connection is shrunk to.
+  std::size_t min_active_bytes = 512;
+  /// Encoder size, and advertised decoder size, of an idle connection.
+  std::size_t idle_bytes = 0;
+  /// Ticks without a single encoded field before the connection is idle.
+  uint32_t idle_ticks = 4;
+  /// Ticks without an eviction before an underused table is shrunk.
+  uint32_t shrink_ticks = 2;
+  /// Grow while fewer than this share of fields (in 1/1000) are indexed
+  /// hits and entries are being evicted.
+  uint32_t grow_below_hit_permille = 950;
+
+  /// SETTINGS_HEADER_TABLE_SIZE we advertise for our decoder.
+  std::size_t decoder_bytes = 4096;
+  /// Encoder cap and advertised decoder size under MemoryPressure::High.
+  std::size_t pressure_bytes = 512;
+};
+
+/// @brief Outcome of one TableSizeController::Tick().
+struct TableSizeDecision {
+  std::size_t encoder_bytes = 0;  ///< applied to the Encoder
+  std::size_t decoder_bytes = 0;  ///< to advertise for our Decoder
+  /// decoder_bytes differs from the last value returned: send SETTINGS
+  /// and, once acknowledged, Decoder::SetMaxTableSizeLimit(decoder_bytes).
+  bool advertise = false;
+};
+
+/// @brief Sizes one connection's HPACK tables from its own traffic.
+/// @details Called by the connection at a steady pace (a timer, or every
+///   N header blocks); each Tick() looks at the encoder's HpackStats since
+///   the previous one:
+///
+///   - entries evicted while the hit ratio is below
+///     `grow_below_hit_permille`: the working set does not fit, the
+///     encoder table doubles, up to Encoder::TableLimit() (the peer's
+///     SETTINGS_HEADER_TABLE_SIZE);
+///   - no eviction for `shrink_ticks` and at most a quarter of the table
+///     in use: it halves towards twice its content, not below
+///     `min_active_bytes`;
+///   - no field at all for `idle_ticks`: the encoder drops to `idle_bytes`
+///     (0 by default, which frees its lookup maps) and the decoder size
+///     to advertise follows; the first busy tick restores the last active
+///     size.
+///
+///   MemoryPressure caps both sides at `pressure_bytes` (High) or 0
+///   (Critical) whatever the traffic. A smaller decoder size only takes
+///   effect once the peer acknowledges the SETTINGS and sends a table size
+///   update, so the decision reports when it changed.
+///
+///   Not thread-safe: owned by the connection's I/O thread.
+class TableSizeController {
+ public:
+  explicit TableSizeController(
+      const TableSizeControllerConfig& config = {}) noexcept;
+
+  /// @brief Re-evaluate from `encoder`'s stats and apply the encoder size.
+  TableSizeDecision Tick(
+      Encoder& encoder,
+      MemoryPressure pressure = MemoryPressure::None) noexcept;
+
+  bool Idle() const noexcept {
+    return idle_;
+  }
+  /// @brief Encoder size chosen for an active connection (before caps).
+  std::size_t ActiveBytes() const noexcept {
+    return active_bytes_;
+  }
+
+ private:
+  TableSizeControllerConfig config_;
+  HpackStats last_;  ///< encoder stats at the previous tick
+  std::size_t active_bytes_;
+  std::size_t advertised_;
+  uint32_t quiet_ticks_ = 0;     ///< ticks without a field
+  uint32_t no_evict_ticks_ = 0;  ///< busy ticks without an eviction
+  bool idle_ = false;
+
+  void Adapt(const HpackStats& now, std::size_t used,
+             std::size_t limit) noexcept;
+};
+
+}  // namespace hpack
+}  // namespace h2v
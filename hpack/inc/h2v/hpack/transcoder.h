@@ -0,0 +1,59 @@
+// include/h2v/hpack/transcoder.h
+#pragma once
+
+#include "absl/strings/string_view.h"
+#include "h2v/hpack/decoder.h"
+#include "h2v/hpack/encoder.h"
+#include "h2v/hpack/error_code.h"
+#include "h2v/stream/raw_buffer.h"
+
+namespace h2v {
+namespace hpack {
+
+/// @brief Re-encodes header blocks decoded on one connection for another
+///   connection's encoder (a proxy hop).
+/// @details Passed as the HeaderHandler of the downstream Decoder, so each
+///   field goes to the upstream Encoder as soon as it is decoded:
+///
+///   - the HeaderId the decoder resolved is reused, no name lookup;
+///   - literals forwarded unmodified are copied in their wire form,
+///     Huffman-coded bytes verbatim, instead of being Huffman-encoded again
+///     (a downstream dynamic table hit carries the entry's wire bytes too);
+///   - indexing is decided by the upstream table and its AdmissionPolicy,
+///     except that never-indexed fields stay never-indexed (RFC 7541
+///     §6.2.3).
+///
+///   To drop or rewrite fields, derive and override OnHeader(), calling
+///   Forward() for the fields kept as-is and Add() for new values.
+///
+///   Not thread-safe: used on the I/O thread owning both connections'
+///   codecs for the duration of one block.
+class Transcoder : public HeaderHandler {
+ public:
+  explicit Transcoder(Encoder& upstream) noexcept : encoder_(upstream) {}
+
+  /// @brief Start an upstream block, appended to `out` until Finish().
+  HpackErrorCode Begin(stream::RawBuffer<>& out) noexcept;
+
+  void OnHeader(const DecodedHeader& header) override {
+    Forward(header);
+  }
+
+  /// @brief Forward a decoded field unmodified.
+  void Forward(const DecodedHeader& header) noexcept;
+  /// @brief Add a field the proxy generated or rewrote.
+  void Add(absl::string_view name, absl::string_view value) noexcept;
+
+  /// @brief End the block.
+  /// @return NONE, or the first encoder error (the upstream connection is
+  ///   then out of sync and must be closed).
+  HpackErrorCode Finish() noexcept;
+
+ private:
+  Encoder& encoder_;
+  stream::RawBuffer<>* out_ = nullptr;
+  HpackErrorCode rc_ = HPACK_ERR::NONE;
+};
+
+}  // namespace hpack
+}  // namespace h2v
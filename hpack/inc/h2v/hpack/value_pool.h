@@ -0,0 +1,201 @@
+// include/h2v/hpack/value_pool.h
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "absl/container/flat_hash_set.h"
+#include "absl/hash/hash.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
+#include "h2v/hpack/field_hash.h"
+
+namespace h2v {
+namespace hpack {
+
+class ValuePool;
+
+namespace value_pool_internal {
+
+/// @brief One interned string; its bytes follow the header in the same
+///   allocation.
+struct Node {
+  std::atomic<uint32_t> refs;
+  uint32_t size;
+  uint64_t hash;    ///< FieldHash() of the bytes
+  std::size_t key;  ///< seeded hash of the bytes: shard and bucket
+  ValuePool* pool;
+
+  const char* bytes() const noexcept {
+    return reinterpret_cast<const char*>(this + 1);
+  }
+  char* mutable_bytes() noexcept {
+    return reinterpret_cast<char*>(this + 1);
+  }
+};
+
+}  // namespace value_pool_internal
+
+/// @brief Thresholds of a ValuePool.
+struct ValuePoolConfig {
+  /// Shortest value interned. Shorter ones stay in their table entry,
+  /// where the string's inline buffer costs less than a pooled node.
+  std::size_t min_bytes = 16;
+};
+
+/// @brief Counted reference to a string interned in a ValuePool.
+/// @details The bytes are immutable and live until the last reference
+///   goes, so reading them takes no lock and copying a reference is one
+///   atomic increment. Empty (false) when default-constructed or when the
+///   pool could not allocate.
+class PooledString {
+ public:
+  PooledString() noexcept = default;
+  PooledString(const PooledString& o) noexcept : node_(o.node_) {
+    if (node_) {
+      node_->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+  PooledString(PooledString&& o) noexcept
+                  : node_(std::exchange(o.node_, nullptr)) {}
+  PooledString& operator=(PooledString o) noexcept {
+    std::swap(node_, o.node_);
+    return *this;
+  }
+  ~PooledString();
+
+  explicit operator bool() const noexcept {
+    return node_ != nullptr;
+  }
+  absl::string_view view() const noexcept {
+    return node_ ? absl::string_view(node_->bytes(), node_->size)
+                 : absl::string_view();
+  }
+  /// @brief FieldHash() of the bytes.
+  uint64_t hash() const noexcept {
+    return node_ ? node_->hash : FieldHash(absl::string_view());
+  }
+
+ private:
+  friend class ValuePool;
+  explicit PooledString(value_pool_internal::Node* node) noexcept
+                  : node_(node) {}
+
+  value_pool_internal::Node* node_ = nullptr;
+};
+
+/// @brief Process-wide pool of decoded header values, shared by every
+///   connection's decoder.
+/// @details The same user-agent, accept or content-type strings arrive on
+///   most connections; with HpackConfig::value_pool set, a dynamic table
+///   entry whose value reaches `min_bytes` holds a PooledString instead of
+///   its own copy, so each distinct value is stored once per process.
+///
+///   Strings are spread over 64 shards, and over the buckets of each, by
+///   an absl::Hash of their bytes, which is seeded per process: the
+///   FieldHash the decoder hands in is unkeyed, so values a peer built to
+///   collide in it would otherwise share one shard and one probe chain.
+///   A lookup holds its shard's lock shared, an insertion or the removal
+///   of a string's last reference holds it exclusive; reading and copying
+///   references never lock. A string is freed as soon as its last
+///   reference is dropped.
+///
+///   Must outlive every codec using it and every PooledString it handed
+///   out. Thread-safe.
+class ValuePool {
+ public:
+  explicit ValuePool(const ValuePoolConfig& config = {}) noexcept;
+  ValuePool(const ValuePool&) = delete;
+  ValuePool& operator=(const ValuePool&) = delete;
+  ~ValuePool();
+
+  std::size_t MinBytes() const noexcept {
+    return config_.min_bytes;
+  }
+
+  /// @brief Reference to the pooled copy of `value`, added if missing.
+  /// @param hash  FieldHash(value).
+  /// @return an empty reference on allocation failure.
+  PooledString Intern(absl::string_view value, uint64_t hash) noexcept;
+  PooledString Intern(absl::string_view value) noexcept {
+    return Intern(value, FieldHash(value));
+  }
+
+  /// @brief Distinct strings held, and their bytes (headers excluded).
+  std::size_t Strings() const noexcept {
+    return strings_.load(std::memory_order_relaxed);
+  }
+  std::size_t Bytes() const noexcept {
+    return bytes_.load(std::memory_order_relaxed);
+  }
+  /// @brief Intern() calls that found the string already pooled.
+  uint64_t Hits() const noexcept {
+    return hits_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  friend class PooledString;
+  using Node = value_pool_internal::Node;
+
+  static constexpr std::size_t kShardBits = 6;
+
+  struct Key {
+    absl::string_view bytes;
+    std::size_t key;  ///< KeyOf(bytes)
+  };
+  static std::size_t KeyOf(absl::string_view bytes) noexcept {
+    return absl::HashOf(bytes);
+  }
+  /// Nodes hash and compare by content, so a Key finds its Node.
+  struct NodeHash {
+    using is_transparent = void;
+    std::size_t operator()(const Node* n) const noexcept {
+      return n->key;
+    }
+    std::size_t operator()(const Key& k) const noexcept {
+      return k.key;
+    }
+  };
+  struct NodeEq {
+    using is_transparent = void;
+    static Key KeyOf(const Node* n) noexcept {
+      return {absl::string_view(n->bytes(), n->size), n->key};
+    }
+    static Key KeyOf(const Key& k) noexcept {
+      return k;
+    }
+    template <typename A, typename B>
+    bool operator()(const A& a, const B& b) const noexcept {
+      const Key ka = KeyOf(a), kb = KeyOf(b);
+      return ka.key == kb.key && ka.bytes == kb.bytes;
+    }
+  };
+  struct alignas(64) Shard {
+    absl::Mutex mutex;
+    absl::flat_hash_set<Node*, NodeHash, NodeEq> nodes;
+  };
+
+  ValuePoolConfig config_;
+  std::array<Shard, std::size_t{1} << kShardBits> shards_;
+  std::atomic<std::size_t> strings_{0};
+  std::atomic<std::size_t> bytes_{0};
+  std::atomic<uint64_t> hits_{0};
+
+  Shard& ShardOf(std::size_t key) noexcept {
+    return shards_[key >> (sizeof(std::size_t) * 8 - kShardBits)];
+  }
+  void Release(Node* node) noexcept;
+  static void Destroy(Node* node) noexcept;
+};
+
+inline PooledString::~PooledString() {
+  if (node_) {
+    node_->pool->Release(node_);
+  }
+}
+
+}  // namespace hpack
+}  // namespace h2v
@@ -0,0 +1,113 @@
+// src/h2v/hpack/admission_policy.cc
+#include "h2v/hpack/admission_policy.h"
+
+#include <algorithm>
+
+namespace h2v {
+namespace hpack {
+
+namespace {
+
+/// @brief Odd multipliers giving each sketch row an independent cell.
+constexpr uint64_t kRowSeeds[4] = {
+    0x9e3779b97f4a7c15ull, 0xc2b2ae3d27d4eb4full, 0x165667b19e3779f9ull,
+    0xd6e8feb86659fd93ull};
+
+/// @brief Fields whose value changes on (nearly) every message: indexing
+///   them only evicts entries that would have been reused.
+bool Churns(HeaderId id) noexcept {
+  switch (id) {
+    case HeaderId::ContentLength:
+    case HeaderId::Etag:
+    case HeaderId::IfModifiedSince:
+    case HeaderId::IfNoneMatch:
+    case HeaderId::Location:
+    case HeaderId::SetCookie:
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+std::size_t TinyLfuAdmission::Cell(uint64_t hash, int row) noexcept {
+  return static_cast<std::size_t>((hash * kRowSeeds[row]) >>
+                                  (64 - kWidthBits));
+}
+
+uint32_t TinyLfuAdmission::Counter(int row, std::size_t cell) const noexcept {
+  const uint8_t b = sketch_[row][cell >> 1];
+  return (cell & 1) ? (b >> 4) : (b & 0x0f);
+}
+
+uint32_t TinyLfuAdmission::Frequency(uint64_t field_hash) const noexcept {
+  uint32_t f = 15;
+  for (int r = 0; r < kDepth; ++r) {
+    f = std::min(f, Counter(r, Cell(field_hash, r)));
+  }
+  return f;
+}
+
+void TinyLfuAdmission::Age() noexcept {
+  for (auto& row : sketch_) {
+    for (uint8_t& b : row) {
+      b = static_cast<uint8_t>((b >> 1) & 0x77);
+    }
+  }
+  records_ = 0;
+}
+
+bool TinyLfuAdmission::MostlyDistinct(const NameSlot& slot) noexcept {
+  // linear counting: d = 64 ln(64 / zeros). More than kWindow / 2 distinct
+  // values means d > 16, i.e. fewer than 64 e^-0.25 ≈ 49.8 zero bits.
+  return __builtin_popcountll(slot.bitmap) > 14;
+}
+
+void TinyLfuAdmission::Record(uint64_t field_hash, uint64_t name_hash,
+                              uint64_t value_hash) noexcept {
+  // conservative update: raise only the counters holding the minimum
+  const uint32_t f = Frequency(field_hash);
+  if (f < 15) {
+    for (int r = 0; r < kDepth; ++r) {
+      const std::size_t c = Cell(field_hash, r);
+      if (Counter(r, c) == f) {
+        sketch_[r][c >> 1] += (c & 1) ? 0x10 : 0x01;
+      }
+    }
+  }
+  if (++records_ >= kResetAfter) {
+    Age();
+  }
+
+  NameSlot& s = names_[name_hash & (kNameSlots - 1)];
+  if (s.name_hash != name_hash) {
+    s = NameSlot{};
+    s.name_hash = name_hash;
+  }
+  s.bitmap |= uint64_t(1) << (value_hash & 63);
+  if (++s.seen == kWindow) {
+    s.high = MostlyDistinct(s);
+    s.judged = true;
+    s.seen = 0;
+    s.bitmap = 0;
+  }
+}
+
+bool TinyLfuAdmission::HighCardinality(uint64_t name_hash) const noexcept {
+  const NameSlot& s = names_[name_hash & (kNameSlots - 1)];
+  return s.name_hash == name_hash && s.judged && s.high;
+}
+
+bool TinyLfuAdmission::Admit(const AdmissionCandidate& candidate) noexcept {
+  if (Churns(candidate.id) || HighCardinality(candidate.name_hash)) {
+    return false;
+  }
+  if (!candidate.evicts) {
+    return true;
+  }
+  return Frequency(candidate.field_hash) > Frequency(candidate.victim_hash);
+}
+
+}  // namespace hpack
+}  // namespace h2v
@@ -19,6 +19,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "h2v/hpack/field_class.h"
 #include "huffman_table.h"
 
 namespace h2v {
@@ -153,7 +154,7 @@ static void EmitNibbleTables(std::ofstream& out,
          "//  bits [21..20] = emit_count (2 bits)\n"
          "//  bits [19..12] = s0 (8 bits)\n"
          "//  bits [11..4 ] = s1 (8 bits)\n"
-         "//  bits [3..0  ] = 0 (unused)\n";
+         "//  bits [3..0  ] = FIELD_CLASS bits of s0 | s1 (field_class.h)\n";
   out << "using NibblePackedEntry = uint32_t;\n";
   out << "static constexpr NibblePackedEntry kNibbleDecodeTable["
       << (NUM_NEW * 16) << "] = {\n";
@@ -217,9 +218,13 @@ static void EmitNibbleTables(std::ofstream& out,
         //  bits21..20 = emit_count (2 bits)
         //  bits19..12 = s0 (8 bits)
         //  bits11..4  = s1 (8 bits)
-        //  bits3..0   = 0
+        //  bits3..0   = character classes of the emitted symbols
+        uint32_t classes = 0;
+        for (uint8_t sym : emits) {
+          classes |= hpack::FieldClassOf(sym);
+        }
         packed = (uint32_t(newNext & 0x01FF) << 22) | (ec << 20) |
-                 ((s0 & 0xFF) << 12) | ((s1 & 0xFF) << 4);
+                 ((s0 & 0xFF) << 12) | ((s1 & 0xFF) << 4) | (classes & 0x0F);
       }
 
       // Output as hex, comma/newline except last entry
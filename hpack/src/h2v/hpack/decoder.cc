@@ -0,0 +1,643 @@
+// src/h2v/hpack/decoder.cc
+#include "h2v/hpack/decoder.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#include "h2v/hpack/huffman_codec.h"
+#include "h2v/hpack/integer_codec.h"
+#include "h2v/hpack/request_pseudo_headers.h"
+#include "h2v/hpack/static_table.h"
+
+namespace h2v {
+namespace hpack {
+
+namespace {
+
+/// @brief A string literal header parsed from the wire (RFC 7541 §5.2).
+struct StringRef {
+  const uint8_t* data = nullptr;
+  uint32_t len = 0;
+  bool huffman = false;
+  std::size_t header = 0;  ///< bytes of the H bit + length prefix
+};
+
+HpackErrorCode ReadInteger(const uint8_t* in, std::size_t in_size, int n,
+                           uint32_t& value, std::size_t& used) noexcept {
+  if (in_size == 0) {
+    return HPACK_ERR::INTEGER_DECODE_TRUNCATED;
+  }
+  return integer_codec::DecodeInteger(in, in_size, n, value, used);
+}
+
+HpackErrorCode ReadString(const uint8_t* in, std::size_t in_size,
+                          StringRef& s) noexcept {
+  if (in_size == 0) {
+    return HPACK_ERR::INTEGER_DECODE_TRUNCATED;
+  }
+  s.huffman = (in[0] & 0x80) != 0;
+  const HpackErrorCode rc = ReadInteger(in, in_size, 7, s.len, s.header);
+  s.data = in + s.header;
+  return rc;
+}
+
+/// @brief Fewest bytes `s` can decode to (longest Huffman code is 30 bits).
+std::size_t DecodedLowerBound(const StringRef& s) noexcept {
+  return s.huffman ? (std::size_t(s.len) * 8) / 30 : s.len;
+}
+
+/// @brief Most bytes `s` can decode to (shortest Huffman code is 5 bits).
+std::size_t DecodedUpperBound(const StringRef& s) noexcept {
+  return s.huffman ? (std::size_t(s.len) * 8) / 5 + 1 : s.len;
+}
+
+absl::string_view View(const uint8_t* p, std::size_t n) noexcept {
+  return absl::string_view(reinterpret_cast<const char*>(p), n);
+}
+
+/// @brief Decode `s` (Huffman into `out`, raw in place) together with its
+///   FIELD_CLASS bits and FieldHash when asked: a Huffman string gets both
+///   from the decoding pass itself.
+HpackErrorCode DecodeString(const StringRef& s, uint8_t* out, std::size_t cap,
+                            bool classify, bool hash, absl::string_view& str,
+                            uint8_t& classes, uint64_t& digest) noexcept {
+  if (!s.huffman) {
+    str = View(s.data, s.len);
+    if (classify) {
+      classes = ClassifyField(s.data, s.len);
+    }
+    if (hash) {
+      digest = FieldHash(s.data, s.len);
+    }
+    return HPACK_ERR::NONE;
+  }
+  std::size_t n = 0;
+  HpackErrorCode rc;
+  if (classify) {
+    rc = hash ? huffman::FastDecodeFused<true, true>(s.data, s.len, out, cap,
+                                                     n, classes, digest)
+              : huffman::FastDecodeFused<true, false>(s.data, s.len, out, cap,
+                                                      n, classes, digest);
+  } else {
+    rc = hash ? huffman::FastDecodeFused<false, true>(s.data, s.len, out, cap,
+                                                      n, classes, digest)
+              : huffman::FastDecodeFused<false, false>(s.data, s.len, out,
+                                                       cap, n, classes, digest);
+  }
+  str = View(out, n);
+  return rc;
+}
+
+}  // namespace
+
+Decoder::Decoder(const HpackConfig& config) noexcept
+                : config_(config),
+                  table_(config.max_dynamic_table_size_bytes,
+                         config.memory_budget, config.value_pool),
+                  max_table_size_limit_(config.max_dynamic_table_size_bytes) {}
+
+HpackErrorCode Decoder::Fail(HpackErrorCode rc) noexcept {
+  failed_ = true;
+  in_block_ = false;
+  carry_.reset();
+  scratch_.reset();
+  crumbs_.clear();
+  Unpin();
+  if (auto cb = GetErrorCallback())
+    cb(0, make_error(0x1, uint16_t(rc)), "HPACK decode failed");
+  return rc;
+}
+
+bool Decoder::Admit(std::size_t field_size) noexcept {
+  if (Suppressed()) {
+    return false;
+  }
+  if (list_size_ + field_size > config_.max_header_list_size_bytes) {
+    overflow_ = true;
+    return false;
+  }
+  list_size_ += field_size;
+  return true;
+}
+
+void Decoder::Unpin() noexcept {
+  if (pin_ != 0) {
+    table_.Unpin(pin_);
+    pin_ = 0;
+  }
+}
+
+HpackErrorCode Decoder::Emit(HeaderHandler& handler,
+                             const DecodedHeader& header,
+                             const DynamicTable::Entry* owner) noexcept {
+  decoded_headers_++;
+  if (pseudo_) {
+    switch (pseudo_->Add(header)) {
+      case RequestPseudoHeaders::AddResult::Regular:
+        break;
+      case RequestPseudoHeaders::AddResult::Stored:
+        return HPACK_ERR::NONE;
+      case RequestPseudoHeaders::AddResult::Malformed:
+        malformed_ = true;
+        return HPACK_ERR::NONE;
+      case RequestPseudoHeaders::AddResult::OutOfMemory:
+        return HPACK_ERR::OUT_OF_MEMORY;
+    }
+  }
+  if (config_.join_cookies && header.id == HeaderId::Cookie) {
+    return HoldCrumb(header, owner);
+  }
+  handler.OnHeader(header);
+  return HPACK_ERR::NONE;
+}
+
+HpackErrorCode Decoder::HoldCrumb(const DecodedHeader& header,
+                                  const DynamicTable::Entry* owner) noexcept {
+  Crumb crumb;
+  if (owner) {
+    crumb.owner = owner;  // immutable and pinned until the block ends
+  } else {
+    const std::size_t n = header.value.size();
+    uint8_t* dst = n > 0 ? crumb_bytes_.append(n) : nullptr;
+    if (n > 0 && !dst) {
+      return HPACK_ERR::OUT_OF_MEMORY;
+    }
+    if (n > 0) {
+      std::memcpy(dst, header.value.data(), n);
+    }
+    crumb.offset = static_cast<uint32_t>(crumb_bytes_.size() - n);
+    crumb.length = static_cast<uint32_t>(n);
+  }
+  try {
+    crumbs_.push_back(crumb);
+  } catch (...) {
+    return HPACK_ERR::OUT_OF_MEMORY;
+  }
+  return HPACK_ERR::NONE;
+}
+
+absl::string_view Decoder::CrumbValue(const Crumb& crumb) const noexcept {
+  if (crumb.owner) {
+    return crumb.owner->Value();
+  }
+  return View(crumb_bytes_.raw() + crumb.offset, crumb.length);
+}
+
+HpackErrorCode Decoder::EmitCookie(HeaderHandler& handler) noexcept {
+  DecodedHeader cookie;
+  cookie.name = StaticTable::GetByIndex(32)->name;
+  cookie.type = EntryType::LiteralWithoutIndexing;
+  cookie.index = 32;
+  cookie.id = HeaderId::Cookie;
+  if (crumbs_.size() == 1) {
+    cookie.value = CrumbValue(crumbs_[0]);
+  } else {
+    std::size_t total = 2 * (crumbs_.size() - 1);
+    for (const Crumb& c : crumbs_) {
+      total += CrumbValue(c).size();
+    }
+    cookie_.clear();
+    if (cookie_.capacity() < total) {
+      cookie_.reset();
+      try {
+        cookie_.reserve(total);
+      } catch (...) {
+        return HPACK_ERR::OUT_OF_MEMORY;
+      }
+    }
+    uint8_t* p = cookie_.append(total);
+    for (std::size_t i = 0; i < crumbs_.size(); ++i) {
+      if (i > 0) {
+        *p++ = ';';
+        *p++ = ' ';
+      }
+      const absl::string_view v = CrumbValue(crumbs_[i]);
+      std::memcpy(p, v.data(), v.size());
+      p += v.size();
+    }
+    cookie.value = View(cookie_.raw(), total);
+  }
+  handler.OnHeader(cookie);
+  crumbs_.clear();
+  crumb_bytes_.clear();
+  return HPACK_ERR::NONE;
+}
+
+HpackErrorCode Decoder::Decode(absl::Span<const uint8_t> fragment,
+                               bool end_of_block,
+                               HeaderHandler& handler) noexcept {
+  pseudo_ = nullptr;
+  return DecodeFragment(fragment, end_of_block, handler);
+}
+
+HpackErrorCode Decoder::Decode(absl::Span<const uint8_t> fragment,
+                               bool end_of_block, HeaderHandler& handler,
+                               RequestPseudoHeaders& pseudo) noexcept {
+  if (!in_block_) {
+    pseudo.Clear();
+  }
+  pseudo_ = &pseudo;
+  return DecodeFragment(fragment, end_of_block, handler);
+}
+
+HpackErrorCode Decoder::DecodeFragment(absl::Span<const uint8_t> fragment,
+                                       bool end_of_block,
+                                       HeaderHandler& handler) noexcept {
+  if (failed_) {
+    return HPACK_ERR::DECODE_FAILED;
+  }
+  if (!in_block_) {
+    in_block_ = true;
+    overflow_ = false;
+    malformed_ = false;
+    violation_ = FieldViolation::None;
+    crumbs_.clear();
+    crumb_bytes_.clear();
+    size_update_allowed_ = true;
+    list_size_ = 0;
+    pin_ = table_.Pin();
+    if (pin_ == 0) {
+      return Fail(HPACK_ERR::OUT_OF_MEMORY);
+    }
+  }
+  decoded_bytes_ += fragment.size();
+
+  const uint8_t* p = fragment.data();
+  std::size_t n = fragment.size();
+
+  // 1) finish skipping a string that straddled the previous fragment
+  if (skip_remaining_ > 0) {
+    const std::size_t take = std::size_t(std::min<uint64_t>(skip_remaining_, n));
+    p += take;
+    n -= take;
+    skip_remaining_ -= take;
+  }
+
+  // 2) glue the carried partial representation to the new bytes
+  const bool use_carry = carry_.size() > 0;
+  if (use_carry && n > 0) {
+    uint8_t* dst = carry_.append(n);
+    if (!dst) {
+      return Fail(HPACK_ERR::OUT_OF_MEMORY);
+    }
+    std::memcpy(dst, p, n);
+  }
+  const uint8_t* in = use_carry ? carry_.raw() : p;
+  const std::size_t in_size = use_carry ? carry_.size() : n;
+
+  // 3) decode every complete representation
+  std::size_t pos = 0;
+  while (pos < in_size && skip_remaining_ == 0) {
+    std::size_t used = 0;
+    const HpackErrorCode rc =
+        skip_value_pending_ ? SkipString(in + pos, in_size - pos, used)
+                            : DecodeOne(in + pos, in_size - pos, used, handler);
+    if (rc == HPACK_ERR::INTEGER_DECODE_TRUNCATED) {
+      break;
+    }
+    if (rc != HPACK_ERR::NONE) {
+      return Fail(rc);
+    }
+    pos += used;
+  }
+
+  // 4) keep the incomplete tail for the next fragment
+  const std::size_t left = in_size - pos;
+  if (use_carry) {
+    std::memmove(carry_.mutable_raw(), carry_.raw() + pos, left);
+    carry_.clear();
+    carry_.append(left);
+  } else if (left > 0) {
+    uint8_t* dst = carry_.append(left);
+    if (!dst) {
+      return Fail(HPACK_ERR::OUT_OF_MEMORY);
+    }
+    std::memcpy(dst, in + pos, left);
+  }
+
+  if (!end_of_block) {
+    return HPACK_ERR::NONE;
+  }
+  if (left > 0 || skip_remaining_ > 0 || skip_value_pending_) {
+    return Fail(HPACK_ERR::DECODE_BLOCK_TRUNCATED);
+  }
+  in_block_ = false;
+  if (carry_.capacity() > config_.max_header_list_size_bytes) {
+    carry_.reset();  // do not pin a large carry between blocks
+  }
+  if (pseudo_ && !Suppressed() && !pseudo_->CloseSection()) {
+    malformed_ = true;  // no regular field: the section ends with the block
+  }
+  if (!crumbs_.empty() && !Suppressed()) {
+    const HpackErrorCode rc = EmitCookie(handler);
+    if (rc != HPACK_ERR::NONE) {
+      return Fail(rc);
+    }
+  }
+  crumbs_.clear();
+  Unpin();  // evicted entries the block referenced can go
+  if (crumb_bytes_.capacity() > config_.max_header_list_size_bytes) {
+    crumb_bytes_.reset();
+  }
+  if (overflow_) {
+    return HPACK_ERR::DECODE_HEADER_LIST_TOO_LARGE;
+  }
+  if (violation_ != FieldViolation::None) {
+    return HPACK_ERR::DECODE_MALFORMED_FIELD;
+  }
+  return malformed_ ? HPACK_ERR::DECODE_MALFORMED_REQUEST : HPACK_ERR::NONE;
+}
+
+void Decoder::Reject(FieldViolation violation) noexcept {
+  if (violation != FieldViolation::None && !malformed_) {
+    malformed_ = true;
+    violation_ = violation;
+  }
+}
+
+HpackErrorCode Decoder::DecodeOne(const uint8_t* in, std::size_t in_size,
+                                  std::size_t& used,
+                                  HeaderHandler& handler) noexcept {
+  const uint8_t b = in[0];
+
+  // indexed header field (RFC 7541 §6.1)
+  if (b & 0x80) {
+    uint32_t index = 0;
+    const HpackErrorCode rc = ReadInteger(in, in_size, 7, index, used);
+    if (rc != HPACK_ERR::NONE) {
+      return rc;
+    }
+    size_update_allowed_ = false;
+    if (index == 0) {
+      return HPACK_ERR::DECODE_INVALID_INDEX;
+    }
+    if (index <= StaticTable::Size()) {
+      const Header h = *StaticTable::GetByIndex(index);
+      if (Admit(h.name.size() + h.value.size() + kEntryOverhead)) {
+        return Emit(handler, {h.name, h.value, EntryType::IndexedHeader,
+                              index, StaticHeaderId(index)});
+      }
+      return HPACK_ERR::NONE;
+    }
+    const DynamicTable::Entry* e = table_.FindByIndex(index);
+    if (!e) {
+      return HPACK_ERR::DECODE_INVALID_INDEX;
+    }
+    Reject(e->name_violation != FieldViolation::None ? e->name_violation
+                                                     : e->value_violation);
+    if (Admit(e->Size())) {
+      DecodedHeader h{e->decoded_name, e->Value(), EntryType::IndexedHeader,
+                      index, e->id};
+      h.wire_name = e->raw_name;
+      h.wire_value = e->raw_value;
+      h.wire_name_huffman = e->name_huffman;
+      h.wire_value_huffman = e->value_huffman;
+      h.has_wire = true;
+      h.name_hash = e->name_hash;
+      h.value_hash = e->value_hash;
+      h.has_hash = true;
+      if (e->pooled_value) {
+        h.pooled_value = &e->pooled_value;
+      }
+      return Emit(handler, h, e);
+    }
+    return HPACK_ERR::NONE;
+  }
+
+  // dynamic table size update (RFC 7541 §6.3)
+  if ((b & 0xE0) == 0x20) {
+    uint32_t size = 0;
+    const HpackErrorCode rc = ReadInteger(in, in_size, 5, size, used);
+    if (rc != HPACK_ERR::NONE) {
+      return rc;
+    }
+    // only allowed before the first field of a block (RFC 7541 §4.2)
+    if (!size_update_allowed_ || size > max_table_size_limit_) {
+      return HPACK_ERR::DECODE_INVALID_TABLE_SIZE_UPDATE;
+    }
+    table_.SetMaxBytes(size);
+    return HPACK_ERR::NONE;
+  }
+
+  return DecodeLiteral(in, in_size, used, handler);
+}
+
+HpackErrorCode Decoder::DecodeLiteral(const uint8_t* in, std::size_t in_size,
+                                      std::size_t& used,
+                                      HeaderHandler& handler) noexcept {
+  EntryType type;
+  int prefix;
+  if ((in[0] & 0xC0) == 0x40) {
+    type = EntryType::LiteralWithIncrementalIndexing;
+    prefix = 6;
+  } else if ((in[0] & 0xF0) == 0x10) {
+    type = EntryType::LiteralNeverIndexed;
+    prefix = 4;
+  } else {
+    type = EntryType::LiteralWithoutIndexing;
+    prefix = 4;
+  }
+  const bool indexing = type == EntryType::LiteralWithIncrementalIndexing;
+
+  uint32_t name_index = 0;
+  std::size_t off = 0;
+  HpackErrorCode rc = ReadInteger(in, in_size, prefix, name_index, off);
+  if (rc != HPACK_ERR::NONE) {
+    return rc;
+  }
+
+  // name: table reference or string literal
+  const DynamicTable::Entry* name_entry = nullptr;
+  absl::string_view name;
+  absl::string_view raw_name;
+  bool name_huffman = false;
+  HeaderId id = HeaderId::Unknown;
+  StringRef ns;
+  std::size_t name_lower = 0;
+  FieldViolation name_violation = FieldViolation::None;
+  uint64_t name_hash = 0;
+  if (name_index > 0) {
+    if (name_index <= StaticTable::Size()) {
+      name = StaticTable::GetByIndex(name_index)->name;
+      raw_name = name;
+      id = StaticHeaderId(name_index);
+      if (indexing) {
+        name_hash = FieldHash(name);
+      }
+    } else {
+      name_entry = table_.FindByIndex(name_index);
+      if (!name_entry) {
+        return HPACK_ERR::DECODE_INVALID_INDEX;
+      }
+      name = name_entry->decoded_name;
+      raw_name = name_entry->raw_name;
+      name_huffman = name_entry->name_huffman;
+      id = name_entry->id;
+      name_violation = name_entry->name_violation;
+      name_hash = name_entry->name_hash;
+    }
+    name_lower = name.size();
+  } else {
+    rc = ReadString(in + off, in_size - off, ns);
+    if (rc != HPACK_ERR::NONE) {
+      return rc;
+    }
+    off += ns.header;
+    name_lower = DecodedLowerBound(ns);
+    if (off + ns.len > in_size) {
+      if (!overflow_ && list_size_ + name_lower + kEntryOverhead >
+                            config_.max_header_list_size_bytes) {
+        overflow_ = true;
+      }
+      if (Suppressed() &&
+          (!indexing || name_lower + kEntryOverhead > table_.MaxBytes())) {
+        // nothing of this field survives: skip it without buffering
+        if (indexing) {
+          table_.EvictAll();
+        }
+        size_update_allowed_ = false;
+        skip_remaining_ = off + ns.len - in_size;
+        skip_value_pending_ = true;
+        used = in_size;
+        return HPACK_ERR::NONE;
+      }
+      return HPACK_ERR::INTEGER_DECODE_TRUNCATED;
+    }
+    off += ns.len;
+  }
+
+  // value
+  StringRef vs;
+  rc = ReadString(in + off, in_size - off, vs);
+  if (rc != HPACK_ERR::NONE) {
+    return rc;
+  }
+  off += vs.header;
+  const std::size_t lower = name_lower + DecodedLowerBound(vs) + kEntryOverhead;
+  if (!overflow_ && list_size_ + lower > config_.max_header_list_size_bytes) {
+    overflow_ = true;
+  }
+  const bool storable = indexing && lower <= table_.MaxBytes();
+  if (off + vs.len > in_size) {
+    if (Suppressed() && !storable) {
+      if (indexing) {
+        table_.EvictAll();
+      }
+      size_update_allowed_ = false;
+      skip_remaining_ = off + vs.len - in_size;
+      used = in_size;
+      return HPACK_ERR::NONE;
+    }
+    return HPACK_ERR::INTEGER_DECODE_TRUNCATED;
+  }
+  used = off + vs.len;
+  size_update_allowed_ = false;
+  if (Suppressed() && !storable) {
+    if (indexing) {
+      table_.EvictAll();
+    }
+    return HPACK_ERR::NONE;
+  }
+
+  // decode the string literals (Huffman into scratch, raw in place),
+  // collecting their character classes on the way when validating and
+  // their hashes when the field goes to the table
+  const bool validate = config_.validate_fields;
+  uint8_t classes = 0;
+  const std::size_t name_cap = name_index > 0 ? 0 : DecodedUpperBound(ns);
+  const std::size_t cap = name_cap + DecodedUpperBound(vs);
+  scratch_.clear();
+  uint8_t* out = cap > 0 ? scratch_.append(cap) : nullptr;
+  if (cap > 0 && !out) {
+    return HPACK_ERR::OUT_OF_MEMORY;
+  }
+  if (name_index == 0) {
+    raw_name = View(ns.data, ns.len);
+    name_huffman = ns.huffman;
+    rc = DecodeString(ns, out, name_cap, validate, indexing, name, classes,
+                      name_hash);
+    if (rc != HPACK_ERR::NONE) {
+      return rc;
+    }
+    if (validate) {
+      name_violation = CheckFieldName(
+          reinterpret_cast<const uint8_t*>(name.data()), name.size(), classes);
+    }
+    id = LookupHeaderId(name);
+  }
+  absl::string_view value;
+  const absl::string_view raw_value = View(vs.data, vs.len);
+  uint64_t value_hash = 0;
+  rc = DecodeString(vs, out + name_cap, cap - name_cap, validate, indexing,
+                    value, classes, value_hash);
+  if (rc != HPACK_ERR::NONE) {
+    return rc;
+  }
+  const FieldViolation value_violation =
+      validate ? CheckFieldValue(reinterpret_cast<const uint8_t*>(value.data()),
+                                 value.size(), classes)
+               : FieldViolation::None;
+  Reject(name_violation != FieldViolation::None ? name_violation
+                                                : value_violation);
+
+  const std::size_t field_size = name.size() + value.size() + kEntryOverhead;
+  DynamicTable::Entry* e = nullptr;
+  if (indexing) {
+    e = table_.Insert(raw_name, raw_value, name, value, type, id, name_hash,
+                      value_hash);
+    if (!e && field_size <= table_.MaxBytes()) {
+      return HPACK_ERR::OUT_OF_MEMORY;
+    }
+    if (e) {
+      e->name_huffman = name_huffman;
+      e->value_huffman = vs.huffman;
+      e->name_violation = name_violation;
+      e->value_violation = value_violation;
+    }
+  }
+  if (Admit(field_size)) {
+    DecodedHeader h{name, value, type, name_index, id};
+    h.wire_name = raw_name;
+    h.wire_value = raw_value;
+    h.wire_name_huffman = name_huffman;
+    h.wire_value_huffman = vs.huffman;
+    h.has_wire = true;
+    h.name_hash = name_hash;
+    h.value_hash = value_hash;
+    h.has_hash = indexing;
+    if (e && e->pooled_value) {
+      h.pooled_value = &e->pooled_value;
+    }
+    return Emit(handler, h, e);
+  }
+  return HPACK_ERR::NONE;
+}
+
+HpackErrorCode Decoder::SkipString(const uint8_t* in, std::size_t in_size,
+                                   std::size_t& used) noexcept {
+  StringRef s;
+  const HpackErrorCode rc = ReadString(in, in_size, s);
+  if (rc != HPACK_ERR::NONE) {
+    return rc;
+  }
+  skip_value_pending_ = false;
+  const std::size_t total = s.header + s.len;
+  if (total <= in_size) {
+    used = total;
+  } else {
+    skip_remaining_ = total - in_size;
+    used = in_size;
+  }
+  return HPACK_ERR::NONE;
+}
+
+void Decoder::SnapshotStats(HpackStats& out) const noexcept {
+  table_.SnapshotStats(out);
+  out.total_decoded_headers = decoded_headers_;
+  out.total_bytes_processed = decoded_bytes_;
+  out.error_count += failed_ ? 1 : 0;
+}
+
+}  // namespace hpack
+}  // namespace h2v
@@ -1,26 +1,37 @@
 // src/h2v/hpack/dynamic_table.cc
 #include "h2v/hpack/dynamic_table.h"
 
+#include <algorithm>
 #include <cstring>
 
+#include "h2v/hpack/static_table.h"
+
 namespace h2v {
 namespace hpack {
 
-DynamicTable::DynamicTable(std::size_t max_bytes) noexcept
-                : raw_buffer_{}, max_bytes_(max_bytes) {
-  raw_buffer_.reserve(max_bytes_);
-  queue_.reserve(1024);
-}
+namespace {
+
+constexpr std::size_t kSlotBytes = sizeof(std::unique_ptr<DynamicTable::Entry>);
+
+}  // namespace
+
+DynamicTable::DynamicTable(std::size_t max_bytes, MemoryBudget* budget,
+                           ValuePool* pool) noexcept
+                : max_bytes_(max_bytes), budget_(budget), pool_(pool) {}
 
 DynamicTable::~DynamicTable() {
   Clear();
-  raw_buffer_.reset();
+  if (budget_) {
+    budget_->Release(queue_.size() * kSlotBytes);
+  }
+  pins_.clear();
+  Reclaim();
 }
 
-std::shared_ptr<DynamicTable::Entry> DynamicTable::Find(
-    absl::string_view name) noexcept {
+const DynamicTable::Entry* DynamicTable::Find(
+    absl::string_view name, uint64_t name_hash) noexcept {
   absl::MutexLock lk(&mutex_);
-  auto it = cache_.find(name);
+  auto it = cache_.find(NameKey{name, name_hash});
   if (it == cache_.end()) {
     stats_.cache_misses++;
     return nullptr;
@@ -29,87 +40,211 @@ std::shared_ptr<DynamicTable::Entry> DynamicTable::Find(
   return it->second;
 }
 
-std::shared_ptr<DynamicTable::Entry> DynamicTable::FindByIndex(
+const DynamicTable::Entry* DynamicTable::FindByIndex(
     uint32_t idx) noexcept {
   absl::MutexLock lk(&mutex_);
-  // dynamic indices start at static_table_size + 1
-  // we store entries in queue_ in insertion order; their Entry::index
-  // tracks absolute index
-  for (auto& e : queue_) {
-    if (e && e->index == idx) {
-      stats_.cache_hits++;
-      return e;
-    }
+  // dynamic indices start at static_table_size + 1, newest first
+  if (idx <= StaticTable::Size() || idx - StaticTable::Size() > count_) {
+    stats_.cache_misses++;
+    return nullptr;
   }
-  stats_.cache_misses++;
-  return nullptr;
+  const std::size_t rel = idx - StaticTable::Size() - 1;
+  stats_.cache_hits++;
+  return queue_[(head_ + count_ - 1 - rel) % queue_.size()].get();
 }
 
-std::shared_ptr<DynamicTable::Entry> DynamicTable::Insert(
-    absl::string_view name_slice, absl::string_view value_slice,
-    std::string&& dec_name, std::string&& dec_value, EntryType type) noexcept {
+uint32_t DynamicTable::IndexOf(const Entry& entry) const noexcept {
   absl::MutexLock lk(&mutex_);
-  std::size_t need = name_slice.size() + value_slice.size();
-  EvictIfNeeded(need);
+  const uint32_t age = inserted_ - 1 - entry.index;  // 0 = newest
+  if (age >= count_) {
+    return 0;
+  }
+  return StaticTable::Size() + 1 + age;
+}
 
-  // append raw
-  uint8_t* np = raw_buffer_.append(name_slice.size());
-  if (!np) {
-    stats_.error_count++;
-    if (auto cb = GetErrorCallback())
-      cb(0, make_error(0x1, 5), "OOM name");
+bool DynamicTable::GrowQueue() noexcept {
+  std::vector<std::unique_ptr<Entry>> bigger;
+  try {
+    bigger.resize(queue_.empty() ? 16 : queue_.size() * 2);
+  } catch (...) {
+    return false;
+  }
+  for (std::size_t i = 0; i < count_; ++i) {
+    bigger[i] = std::move(queue_[(head_ + i) % queue_.size()]);
+  }
+  if (budget_) {
+    budget_->Charge((bigger.size() - queue_.size()) * kSlotBytes);
+  }
+  queue_.swap(bigger);
+  head_ = 0;
+  return true;
+}
+
+void DynamicTable::ReleaseStorage() noexcept {
+  if (budget_) {
+    budget_->Release(queue_.size() * kSlotBytes);
+  }
+  std::vector<std::unique_ptr<Entry>>().swap(queue_);
+  decltype(cache_)().swap(cache_);
+  head_ = 0;
+}
+
+DynamicTable::Entry* DynamicTable::Insert(
+    absl::string_view name_slice, absl::string_view value_slice,
+    absl::string_view dec_name, absl::string_view dec_value, EntryType type,
+    HeaderId id, uint64_t name_hash, uint64_t value_hash) noexcept {
+  absl::MutexLock lk(&mutex_);
+  const std::size_t need = dec_name.size() + dec_value.size() + kEntryOverhead;
+  if (need > max_bytes_) {
+    // RFC 7541 §4.4: not an error, the table just ends up empty
+    while (count_ > 0) {
+      EvictOne();
+    }
     return nullptr;
   }
-  std::memcpy(np, name_slice.data(), name_slice.size());
-  uint8_t* vp = raw_buffer_.append(value_slice.size());
-  if (!vp) {
+  EvictIfNeeded(need);
+
+  std::unique_ptr<Entry> e;
+  try {
+    if (count_ == queue_.size() && !GrowQueue()) {
+      stats_.error_count++;
+      if (auto cb = GetErrorCallback())
+        cb(0, make_error(0x1, 5), "OOM queue");
+      return nullptr;
+    }
+    e = std::make_unique<Entry>();
+    e->raw.reserve(name_slice.size() + value_slice.size());
+    e->raw.append(name_slice.data(), name_slice.size());
+    e->raw.append(value_slice.data(), value_slice.size());
+    e->decoded_name.assign(dec_name.data(), dec_name.size());
+    if (pool_ && dec_value.size() >= pool_->MinBytes()) {
+      e->pooled_value = pool_->Intern(dec_value, value_hash);
+    }
+    if (!e->pooled_value) {
+      e->decoded_value.assign(dec_value.data(), dec_value.size());
+    }
+  } catch (...) {
     stats_.error_count++;
     if (auto cb = GetErrorCallback())
-      cb(0, make_error(0x1, 5), "OOM value");
+      cb(0, make_error(0x1, 5), "OOM entry");
     return nullptr;
   }
-  std::memcpy(vp, value_slice.data(), value_slice.size());
-
-  // make entry
-  auto e = std::make_shared<Entry>();
-  e->raw_name =
-      absl::string_view(reinterpret_cast<const char*>(np), name_slice.size());
+  e->raw_name = absl::string_view(e->raw.data(), name_slice.size());
   e->raw_value =
-      absl::string_view(reinterpret_cast<const char*>(vp), value_slice.size());
-  e->decoded_name = std::move(dec_name);
-  e->decoded_value = std::move(dec_value);
+      absl::string_view(e->raw.data() + name_slice.size(), value_slice.size());
   e->type = type;
-  // index = static_table_size + cache_.size()+1
-  e->index = static_cast<uint32_t>(/*static*/ 61 + cache_.size() + 1);
+  e->id = id;
+  e->name_hash = name_hash;
+  e->value_hash = value_hash;
+  e->index = inserted_++;
 
-  // enqueue
-  if (queue_.size() == 0 || tail_ == queue_.size())
-    queue_.push_back(e);
-  else
-    queue_[tail_] = e;
-  tail_ = (tail_ + 1) % queue_.capacity();
+  // enqueue as newest
+  Entry* const entry = e.get();
+  queue_[(head_ + count_) % queue_.size()] = std::move(e);
+  count_++;
 
-  cache_.emplace(e->raw_name, e);
+  // newest entry wins the name slot; the key must view the new entry's bytes
+  const NameKey key{entry->decoded_name, name_hash};
+  cache_.erase(key);
+  cache_.emplace(key, entry);
   current_bytes_ += need;
+  if (budget_) {
+    budget_->Charge(need);
+  }
   stats_.total_encoded_headers++;
-  return e;
+  return entry;
 }
 
 void DynamicTable::EvictIfNeeded(std::size_t need) noexcept {
-  while (current_bytes_ + need > max_bytes_ && head_ != tail_) {
+  while (current_bytes_ + need > max_bytes_ && count_ > 0) {
     EvictOne();
   }
 }
 
 void DynamicTable::EvictOne() noexcept {
-  if (head_ == tail_)
+  if (count_ == 0)
     return;
-  auto& e = queue_[head_];
-  std::size_t sz = e->raw_name.size() + e->raw_value.size();
-  cache_.erase(e->raw_name);
-  head_ = (head_ + 1) % queue_.capacity();
+  std::unique_ptr<Entry> e = std::move(queue_[head_]);
+  auto it = cache_.find(NameKey{e->decoded_name, e->name_hash});
+  if (it != cache_.end() && it->second == e.get()) {
+    cache_.erase(it);
+  }
+  head_ = (head_ + 1) % queue_.size();
+  count_--;
+  const std::size_t sz = e->Size();
   current_bytes_ = current_bytes_ > sz ? current_bytes_ - sz : 0;
+  if (budget_) {
+    budget_->Release(sz);
+  }
   stats_.evictions++;
+  Drop(std::move(e));
+}
+
+void DynamicTable::Drop(std::unique_ptr<Entry> e) noexcept {
+  if (pins_.empty()) {
+    return;  // nobody can see it: freed here
+  }
+  // pins up to epoch_ may hold views of it
+  Entry* const retired = e.release();
+  retired->retired_epoch = epoch_;
+  retired->next_retired = nullptr;
+  if (retired_tail_) {
+    retired_tail_->next_retired = retired;
+  } else {
+    retired_head_ = retired;
+  }
+  retired_tail_ = retired;
+  retired_count_++;
+}
+
+void DynamicTable::Reclaim() noexcept {
+  uint64_t oldest = UINT64_MAX;
+  for (const uint64_t pin : pins_) {
+    oldest = std::min(oldest, pin);
+  }
+  // retired in epoch order: stop at the first one a pin can still see
+  while (retired_head_ && retired_head_->retired_epoch < oldest) {
+    std::unique_ptr<Entry> e(retired_head_);
+    retired_head_ = e->next_retired;
+    retired_count_--;
+  }
+  if (!retired_head_) {
+    retired_tail_ = nullptr;
+  }
+}
+
+uint64_t DynamicTable::Pin() noexcept {
+  absl::MutexLock lk(&mutex_);
+  try {
+    pins_.push_back(epoch_ + 1);
+  } catch (...) {
+    return 0;
+  }
+  return ++epoch_;
+}
+
+void DynamicTable::Unpin(uint64_t epoch) noexcept {
+  absl::MutexLock lk(&mutex_);
+  for (std::size_t i = 0; i < pins_.size(); ++i) {
+    if (pins_[i] == epoch) {
+      pins_[i] = pins_.back();
+      pins_.pop_back();
+      Reclaim();
+      return;
+    }
+  }
+}
+
+std::size_t DynamicTable::RetiredCount() const noexcept {
+  absl::MutexLock lk(&mutex_);
+  return retired_count_;
+}
+
+void DynamicTable::EvictAll() noexcept {
+  absl::MutexLock lk(&mutex_);
+  while (count_ > 0) {
+    EvictOne();
+  }
 }
 
 void DynamicTable::SetMaxBytes(std::size_t new_max) noexcept {
@@ -117,6 +252,9 @@ void DynamicTable::SetMaxBytes(std::size_t new_max) noexcept {
   max_bytes_ = new_max;
   // Immediately evict if we're now over capacity
   EvictIfNeeded(0);
+  if (max_bytes_ == 0) {
+    ReleaseStorage();  // parked: nothing can be inserted until it grows
+  }
 }
 
 std::size_t DynamicTable::BytesUsed() const noexcept {
@@ -124,13 +262,29 @@ std::size_t DynamicTable::BytesUsed() const noexcept {
   return current_bytes_;
 }
 
+std::size_t DynamicTable::MaxBytes() const noexcept {
+  absl::MutexLock lk(&mutex_);
+  return max_bytes_;
+}
+
+std::size_t DynamicTable::EntryCount() const noexcept {
+  absl::MutexLock lk(&mutex_);
+  return count_;
+}
+
 void DynamicTable::Clear() noexcept {
   absl::MutexLock lk(&mutex_);
   cache_.clear();
-  queue_.clear();
-  head_ = tail_ = 0;
+  for (auto& e : queue_) {
+    if (e) {
+      Drop(std::move(e));
+    }
+  }
+  head_ = count_ = 0;
+  if (budget_) {
+    budget_->Release(current_bytes_);
+  }
   current_bytes_ = 0;
-  raw_buffer_.clear();
   stats_ = HpackStats{};
 }
 
@@ -0,0 +1,617 @@
+// src/h2v/hpack/encoder.cc
+#include "h2v/hpack/encoder.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#include "absl/hash/hash.h"
+#include "h2v/hpack/dynamic_table.h"
+#include "h2v/hpack/field_class.h"
+#include "h2v/hpack/field_hash.h"
+#include "h2v/hpack/fold_encode.h"
+#include "h2v/hpack/huffman_codec.h"
+#include "h2v/hpack/integer_codec.h"
+#include "h2v/hpack/static_table.h"
+
+namespace h2v {
+namespace hpack {
+
+namespace {
+
+/// @brief Static table entries sharing one name: [first, first + count).
+struct StaticRange {
+  uint8_t first = 0;
+  uint8_t count = 0;
+};
+
+constexpr std::array<StaticRange, kHeaderIdCount> BuildStaticRanges() {
+  std::array<StaticRange, kHeaderIdCount> r{};
+  for (uint32_t i = 1; i <= StaticTable::Size(); ++i) {
+    StaticRange& s = r[static_cast<std::size_t>(StaticHeaderId(i))];
+    if (s.count == 0) {
+      s.first = static_cast<uint8_t>(i);
+    }
+    s.count++;
+  }
+  return r;
+}
+
+constexpr std::array<StaticRange, kHeaderIdCount> kStaticRanges =
+    BuildStaticRanges();
+
+/// @brief Fields a compression oracle must not be able to probe
+///   (RFC 7541 §7.1.3).
+bool Sensitive(HeaderId id, absl::string_view value) noexcept {
+  return id == HeaderId::Authorization || id == HeaderId::ProxyAuthorization ||
+         (id == HeaderId::Cookie && value.size() < 20);
+}
+
+bool PutInteger(stream::RawBuffer<>& out, uint8_t prefix_bits, int n,
+                uint32_t value) noexcept {
+  uint8_t tmp[integer_codec::ENCODE_MAX_BYTES];
+  std::size_t size = sizeof(tmp);
+  integer_codec::ncodeInteger(tmp, size, prefix_bits, n, value);
+  uint8_t* dst = out.append(size);
+  if (!dst) {
+    return false;
+  }
+  std::memcpy(dst, tmp, size);
+  return true;
+}
+
+/// @brief Octets ncodeInteger() writes for `value` with an `n`-bit prefix.
+constexpr std::size_t IntegerSize(int n, std::size_t value) noexcept {
+  const std::size_t max_prefix = (std::size_t{1} << n) - 1;
+  if (value < max_prefix) {
+    return 1;
+  }
+  std::size_t size = 2;
+  for (value -= max_prefix; value >= 128; value >>= 7) {
+    size++;
+  }
+  return size;
+}
+
+bool PutString(stream::RawBuffer<>& out, absl::string_view s) noexcept {
+  const auto* in = reinterpret_cast<const uint8_t*>(s.data());
+  const std::size_t huffman_len = huffman::EncodedLength(in, s.size());
+  const bool use_huffman = huffman_len < s.size();
+  const std::size_t len = use_huffman ? huffman_len : s.size();
+  if (!PutInteger(out, use_huffman ? 0x1 : 0x0, 7,
+                  static_cast<uint32_t>(len))) {
+    return false;
+  }
+  if (len == 0) {
+    return true;
+  }
+  uint8_t* dst = out.append(len);
+  if (!dst) {
+    return false;
+  }
+  if (use_huffman) {
+    std::size_t encoded = 0;
+    huffman::FastEncode(in, s.size(), dst, len, encoded);
+  } else {
+    std::memcpy(dst, in, len);
+  }
+  return true;
+}
+
+/// @brief A string literal already in wire form (RFC 7541 §5.2).
+bool PutEncoded(stream::RawBuffer<>& out, absl::string_view bytes,
+                bool huffman) noexcept {
+  if (!PutInteger(out, huffman ? 0x1 : 0x0, 7,
+                  static_cast<uint32_t>(bytes.size()))) {
+    return false;
+  }
+  if (bytes.empty()) {
+    return true;
+  }
+  uint8_t* dst = out.append(bytes.size());
+  if (!dst) {
+    return false;
+  }
+  std::memcpy(dst, bytes.data(), bytes.size());
+  return true;
+}
+
+/// @brief Exact static match of (id, value), 0 if none.
+uint32_t StaticIndex(HeaderId id, absl::string_view value) noexcept {
+  const StaticRange& sr = kStaticRanges[static_cast<std::size_t>(id)];
+  for (uint32_t i = sr.first; i < uint32_t(sr.first) + sr.count; ++i) {
+    if (StaticTable::GetByIndex(i)->value == value) {
+      return i;
+    }
+  }
+  return 0;
+}
+
+}  // namespace
+
+// -----------------------------------------------------------------------------
+// DynamicTableTemplate
+// -----------------------------------------------------------------------------
+
+HpackErrorCode DynamicTableTemplate::Build(
+    absl::Span<const Header> fields) noexcept {
+  slots_.clear();
+  index_.clear();
+  wire_.clear();
+  try {
+    for (const Header& f : fields) {
+      if (slots_.size() == kMaxEntries) {
+        break;
+      }
+      const HeaderId id = LookupHeaderId(f.name);
+      if (StaticIndex(id, f.value) || Sensitive(id, f.value) ||
+          f.name.size() + f.value.size() + kEntryOverhead >
+              kDefaultHeaderTableSize / 2 ||
+          index_.contains(FieldKey(f.name, f.value))) {
+        continue;
+      }
+      const std::size_t start = wire_.size();
+      const uint32_t name_index =
+          kStaticRanges[static_cast<std::size_t>(id)].first;
+      if (!PutInteger(wire_, 0x1, 6, name_index) ||
+          (!name_index && !PutString(wire_, f.name)) ||
+          !PutString(wire_, f.value)) {
+        return HPACK_ERR::OUT_OF_MEMORY;
+      }
+      slots_.push_back({std::string(f.name), std::string(f.value),
+                        static_cast<uint32_t>(start),
+                        static_cast<uint32_t>(wire_.size() - start)});
+      const Slot& s = slots_.back();
+      index_.emplace(FieldKey(s.name, s.value),
+                     static_cast<int>(slots_.size() - 1));
+    }
+  } catch (...) {
+    return HPACK_ERR::OUT_OF_MEMORY;
+  }
+  return HPACK_ERR::NONE;
+}
+
+// -----------------------------------------------------------------------------
+// Encoder
+// -----------------------------------------------------------------------------
+
+Encoder::Encoder(const HpackConfig& config) noexcept : config_(config) {
+  CheckMemoryPressure();
+  ApplyTableLimit();
+}
+
+Encoder::~Encoder() {
+  if (config_.memory_budget) {
+    config_.memory_budget->Release(used_);
+  }
+}
+
+void Encoder::UseTemplate(const DynamicTableTemplate* tmpl) noexcept {
+  template_ = tmpl;
+  const std::size_t n = tmpl ? tmpl->Size() : 0;
+  template_pending_ = n >= 64 ? ~uint64_t(0) : (uint64_t(1) << n) - 1;
+}
+
+void Encoder::CheckMemoryPressure() noexcept {
+  MemoryBudget* budget = config_.memory_budget;
+  if (!budget) {
+    return;
+  }
+  budget_generation_ = budget->Generation();
+  pressure_cap_ = budget->TableCap(budget->Pressure());
+  ApplyTableLimit();
+}
+
+void Encoder::SetPeerMaxTableSize(std::size_t bytes) noexcept {
+  peer_max_bytes_ = bytes;
+  ApplyTableLimit();
+}
+
+void Encoder::SetTableTarget(std::size_t bytes) noexcept {
+  target_bytes_ = bytes;
+  ApplyTableLimit();
+}
+
+std::size_t Encoder::TableLimit() const noexcept {
+  return std::min(peer_max_bytes_, config_.max_dynamic_table_size_bytes);
+}
+
+void Encoder::ApplyTableLimit() noexcept {
+  const std::size_t target =
+      std::min({TableLimit(), target_bytes_, pressure_cap_});
+  if (target == max_bytes_) {
+    return;
+  }
+  // the decoder must see the smallest size reached (RFC 7541 §4.2)
+  min_size_pending_ = std::min(min_size_pending_, target);
+  max_bytes_ = target;
+  EvictTo(target);
+  size_update_pending_ = true;
+  if (entries_.empty()) {
+    // an idle connection parked at size 0 keeps no lookup storage
+    decltype(fields_)().swap(fields_);
+    decltype(names_)().swap(names_);
+    decltype(name_keys_)().swap(name_keys_);
+    entries_.shrink_to_fit();
+  }
+}
+
+uint32_t Encoder::DynamicIndex(uint32_t seq) const noexcept {
+  // the newest entry (seq inserted_ - 1) is index 62
+  return StaticTable::Size() + (inserted_ - seq);
+}
+
+void Encoder::EvictTo(std::size_t bytes) noexcept {
+  while (used_ > bytes && !entries_.empty()) {
+    const Entry& e = entries_.front();
+    const auto f = fields_.find(FieldKey(e.name, e.value));
+    if (f != fields_.end() && f->second == e.seq) {
+      fields_.erase(f);
+    }
+    const auto n = names_.find(e.name);
+    if (n != names_.end() && n->second == e.seq) {
+      names_.erase(n);
+      const auto k = name_keys_.find(e.name_key);
+      if (k != name_keys_.end() && --k->second == 0) {
+        name_keys_.erase(k);
+      }
+    }
+    const std::size_t size = e.name.size() + e.value.size() + kEntryOverhead;
+    used_ -= size;
+    if (config_.memory_budget) {
+      config_.memory_budget->Release(size);
+    }
+    entries_.pop_front();
+    stats_.evictions++;
+  }
+}
+
+HpackErrorCode Encoder::Insert(absl::string_view name, absl::string_view value,
+                               uint64_t hash, uint64_t name_key) noexcept {
+  const std::size_t size = name.size() + value.size() + kEntryOverhead;
+  EvictTo(max_bytes_ - size);
+  try {
+    entries_.push_back(
+        {std::string(name), std::string(value), hash, name_key, inserted_});
+    const Entry& e = entries_.back();
+    // keys must view the newest entry: the one they replace may be evicted
+    fields_.erase(FieldKey(e.name, e.value));
+    fields_.emplace(FieldKey(e.name, e.value), e.seq);
+    const bool new_name = names_.erase(e.name) == 0;
+    names_.emplace(e.name, e.seq);
+    if (new_name) {
+      name_keys_[e.name_key]++;
+    }
+  } catch (...) {
+    if (config_.memory_budget) {
+      config_.memory_budget->Release(size);
+    }
+    failed_ = true;
+    return HPACK_ERR::OUT_OF_MEMORY;
+  }
+  used_ += size;
+  inserted_++;
+  return HPACK_ERR::NONE;
+}
+
+bool Encoder::ReplayTemplate(absl::string_view name, absl::string_view value,
+                             uint64_t hash, stream::RawBuffer<>& out,
+                             HpackErrorCode& rc) noexcept {
+  const int slot = template_->Find(name, value);
+  const uint64_t bit = slot < 0 ? 0 : uint64_t(1) << slot;
+  if (!(template_pending_ & bit)) {
+    return false;
+  }
+  template_pending_ &= ~bit;  // once: after an eviction it is a literal
+  const std::size_t size = name.size() + value.size() + kEntryOverhead;
+  if (size > max_bytes_ / 2) {
+    return false;
+  }
+  if (config_.memory_budget) {
+    EvictTo(max_bytes_ - size);
+    if (!config_.memory_budget->TryCharge(size)) {
+      return false;
+    }
+  }
+  const absl::Span<const uint8_t> wire = template_->Wire(slot);
+  uint8_t* dst = out.append(wire.size());
+  if (!dst) {
+    if (config_.memory_budget) {
+      config_.memory_budget->Release(size);
+    }
+    rc = HPACK_ERR::OUT_OF_MEMORY;
+    return true;
+  }
+  std::memcpy(dst, wire.data(), wire.size());
+  stats_.cache_misses++;
+  rc = Insert(name, value, hash, FieldHash(name));
+  return true;
+}
+
+HpackErrorCode Encoder::EncodeField(absl::string_view name,
+                                    absl::string_view value, HeaderId id,
+                                    stream::RawBuffer<>& out,
+                                    const DecodedHeader* wire) noexcept {
+  // a never-indexed field keeps that representation on every hop
+  // (RFC 7541 §6.2.3)
+  const bool forwarded_never =
+      wire && wire->type == EntryType::LiteralNeverIndexed;
+  const StaticRange& sr = kStaticRanges[static_cast<std::size_t>(id)];
+  const uint64_t name_hash = absl::HashOf(name);
+  const uint64_t value_hash = absl::HashOf(value);
+  const uint64_t field_hash = name_hash ^ (value_hash * 0x9e3779b97f4a7c15ull);
+  // hits are recorded too: they are what keeps an entry worth its slot
+  policy_->Record(field_hash, name_hash, value_hash);
+
+  // indexed header field (RFC 7541 §6.1)
+  uint32_t index = forwarded_never ? 0 : StaticIndex(id, value);
+  if (!index && !forwarded_never) {
+    const auto f = fields_.find(FieldKey(name, value));
+    if (f != fields_.end()) {
+      index = DynamicIndex(f->second);
+    }
+  }
+  if (index) {
+    stats_.cache_hits++;
+    return PutInteger(out, 0x1, 7, index) ? HPACK_ERR::NONE
+                                          : HPACK_ERR::OUT_OF_MEMORY;
+  }
+
+  HpackErrorCode rc = HPACK_ERR::NONE;
+  if (template_pending_ && !forwarded_never &&
+      ReplayTemplate(name, value, field_hash, out, rc)) {
+    return rc;
+  }
+
+  // literal (RFC 7541 §6.2), name by reference when the tables know it
+  uint32_t name_index = sr.first;
+  if (!name_index) {
+    const auto n = names_.find(name);
+    if (n != names_.end()) {
+      name_index = DynamicIndex(n->second);
+    }
+  }
+  stats_.cache_misses++;
+  const bool never = forwarded_never || Sensitive(id, value);
+  const bool indexing =
+      !never && ShouldIndex(id, name, value, field_hash, name_hash);
+  bool ok;
+  if (indexing) {
+    ok = PutInteger(out, 0x1, 6, name_index);
+  } else if (never) {
+    ok = PutInteger(out, 0x1, 4, name_index);
+  } else {
+    ok = PutInteger(out, 0x0, 4, name_index);
+  }
+  if (wire && wire->has_wire) {
+    // forwarded as received: no Huffman pass over either string
+    ok = ok &&
+         (name_index ||
+          PutEncoded(out, wire->wire_name, wire->wire_name_huffman)) &&
+         PutEncoded(out, wire->wire_value, wire->wire_value_huffman);
+  } else {
+    ok = ok && (name_index || PutString(out, name)) && PutString(out, value);
+  }
+  if (!ok) {
+    return HPACK_ERR::OUT_OF_MEMORY;
+  }
+  return indexing ? Insert(name, value, field_hash, FieldHash(name))
+                  : HPACK_ERR::NONE;
+}
+
+bool Encoder::ShouldIndex(HeaderId id, absl::string_view name,
+                          absl::string_view value, uint64_t field_hash,
+                          uint64_t name_hash) noexcept {
+  const std::size_t size = name.size() + value.size() + kEntryOverhead;
+  bool indexing = size <= max_bytes_ / 2;
+  if (indexing) {
+    AdmissionCandidate c;
+    c.id = id;
+    c.name = name;
+    c.value = value;
+    c.field_hash = field_hash;
+    c.name_hash = name_hash;
+    c.evicts = used_ + size > max_bytes_ && !entries_.empty();
+    c.victim_hash = c.evicts ? entries_.front().hash : 0;
+    indexing = policy_->Admit(c);
+    stats_.admission_rejects += indexing ? 0 : 1;
+  }
+  if (indexing && config_.memory_budget) {
+    // charged net of what the insertion evicts
+    EvictTo(max_bytes_ - size);
+    indexing = config_.memory_budget->TryCharge(size);
+  }
+  return indexing;
+}
+
+HpackErrorCode Encoder::EncodeNewName(absl::string_view name,
+                                      absl::string_view value,
+                                      std::size_t name_prefix,
+                                      std::size_t huffman_size,
+                                      uint64_t name_key, std::size_t start,
+                                      stream::RawBuffer<>& out) noexcept {
+  const uint64_t name_hash = absl::HashOf(name);
+  const uint64_t value_hash = absl::HashOf(value);
+  const uint64_t field_hash = name_hash ^ (value_hash * 0x9e3779b97f4a7c15ull);
+  policy_->Record(field_hash, name_hash, value_hash);
+  stats_.cache_misses++;
+  const bool indexing =
+      ShouldIndex(HeaderId::Unknown, name, value, field_hash, name_hash);
+
+  // literal with a new name (RFC 7541 §6.2.1, §6.2.2): the representation
+  // octet and the name's length go in front of the code already in `out`
+  uint8_t* field = out.mutable_raw() + start;
+  field[0] = indexing ? 0x40 : 0x00;
+  uint8_t* code = field + 1 + name_prefix;
+  const bool use_huffman = huffman_size < name.size();
+  const std::size_t len = use_huffman ? huffman_size : name.size();
+  if (!use_huffman) {
+    std::memcpy(code, name.data(), len);
+  }
+  uint8_t prefix[integer_codec::ENCODE_MAX_BYTES];
+  std::size_t prefix_size = sizeof(prefix);
+  integer_codec::ncodeInteger(prefix, prefix_size, use_huffman ? 0x1 : 0x0,
+                              7, static_cast<uint32_t>(len));
+  if (prefix_size < name_prefix) {
+    // a Huffman code short enough for a shorter length prefix
+    std::memmove(field + 1 + prefix_size, code, len);
+  }
+  std::memcpy(field + 1, prefix, prefix_size);
+  out.truncate(start + 1 + prefix_size + len);
+
+  if (!PutString(out, value)) {
+    return HPACK_ERR::OUT_OF_MEMORY;
+  }
+  return indexing ? Insert(name, value, field_hash, name_key)
+                  : HPACK_ERR::NONE;
+}
+
+HpackErrorCode Encoder::BeginBlock(stream::RawBuffer<>& out) noexcept {
+  if (failed_) {
+    return HPACK_ERR::ENCODE_FAILED;
+  }
+  if (config_.memory_budget &&
+      config_.memory_budget->Generation() != budget_generation_) {
+    CheckMemoryPressure();
+  }
+  if (size_update_pending_) {
+    const std::size_t start = out.size();
+    if (min_size_pending_ < max_bytes_ &&
+        !PutInteger(out, 0x1, 5, static_cast<uint32_t>(min_size_pending_))) {
+      return HPACK_ERR::OUT_OF_MEMORY;
+    }
+    if (!PutInteger(out, 0x1, 5, static_cast<uint32_t>(max_bytes_))) {
+      return HPACK_ERR::OUT_OF_MEMORY;
+    }
+    size_update_pending_ = false;
+    min_size_pending_ = SIZE_MAX;
+    stats_.total_bytes_processed += out.size() - start;
+  }
+  return HPACK_ERR::NONE;
+}
+
+HpackErrorCode Encoder::EncodeHeader(absl::string_view name,
+                                     absl::string_view value, HeaderId id,
+                                     stream::RawBuffer<>& out,
+                                     const DecodedHeader* wire) noexcept {
+  if (failed_) {
+    return HPACK_ERR::ENCODE_FAILED;
+  }
+  const std::size_t start = out.size();
+  stats_.total_encoded_headers++;
+  HpackErrorCode rc = HPACK_ERR::NONE;
+  if (id == HeaderId::Cookie && config_.crumble_cookies && !value.empty() &&
+      (!wire || value.find(';') != absl::string_view::npos)) {
+    // one field per cookie-pair; the "; " delimiter is restored by the
+    // peer when it joins them (RFC 9113 §8.2.3)
+    absl::string_view rest = value;
+    while (!rest.empty() && rc == HPACK_ERR::NONE) {
+      const std::size_t semi = rest.find(';');
+      const absl::string_view crumb = rest.substr(0, semi);
+      rest = semi == absl::string_view::npos ? absl::string_view()
+                                             : rest.substr(semi + 1);
+      while (!rest.empty() && (rest[0] == ' ' || rest[0] == '\t')) {
+        rest.remove_prefix(1);
+      }
+      if (!crumb.empty()) {
+        rc = EncodeField(name, crumb, id, out, nullptr);
+      }
+    }
+  } else {
+    rc = EncodeField(name, value, id, out, wire);
+  }
+  if (rc != HPACK_ERR::NONE) {
+    failed_ = true;
+    stats_.error_count++;
+    return rc;
+  }
+  stats_.total_bytes_processed += out.size() - start;
+  return HPACK_ERR::NONE;
+}
+
+HpackErrorCode Encoder::Encode(absl::Span<const Header> fields,
+                               stream::RawBuffer<>& out) noexcept {
+  HpackErrorCode rc = BeginBlock(out);
+  for (const Header& f : fields) {
+    if (rc != HPACK_ERR::NONE) {
+      break;
+    }
+    rc = EncodeHeader(f.name, f.value, LookupHeaderId(f.name), out, nullptr);
+  }
+  return rc;
+}
+
+HpackErrorCode Encoder::Transcode(const DecodedHeader& header,
+                                  stream::RawBuffer<>& out) noexcept {
+  return EncodeHeader(header.name, header.value, header.id, out, &header);
+}
+
+HpackErrorCode Encoder::EncodeFoldedField(absl::string_view name,
+                                          absl::string_view value,
+                                          stream::RawBuffer<>& out) noexcept {
+  const HeaderId id = LookupHeaderIdIgnoreCase(name);
+  if (id != HeaderId::Unknown) {
+    return EncodeHeader(HeaderIdName(id), value, id, out, nullptr);
+  }
+  if (name.empty()) {
+    return HPACK_ERR::ENCODE_INVALID_FIELD_NAME;
+  }
+  if (failed_) {
+    return HPACK_ERR::ENCODE_FAILED;
+  }
+  try {
+    folded_.resize(name.size());
+  } catch (...) {
+    return HPACK_ERR::OUT_OF_MEMORY;
+  }
+  // room for the representation octet, the name's length prefix as a raw
+  // string (a Huffman code never needs a longer one) and its code
+  const std::size_t start = out.size();
+  const std::size_t name_prefix = IntegerSize(7, name.size());
+  uint8_t* field =
+      out.append(1 + name_prefix + FoldEncodeBound(name.size()));
+  if (!field) {
+    failed_ = true;
+    stats_.error_count++;
+    return HPACK_ERR::OUT_OF_MEMORY;
+  }
+  FoldedName folded;
+  if (!FoldEncodeName(reinterpret_cast<const uint8_t*>(name.data()),
+                      name.size(), reinterpret_cast<uint8_t*>(&folded_[0]),
+                      field + 1 + name_prefix, folded)) {
+    out.truncate(start);
+    return HPACK_ERR::ENCODE_INVALID_FIELD_NAME;
+  }
+  if (template_pending_ || name_keys_.contains(folded.hash)) {
+    // the table may hold the name (or the field): drop the code and
+    // index them as Encode() would
+    out.truncate(start);
+    return EncodeHeader(folded_, value, HeaderId::Unknown, out, nullptr);
+  }
+  stats_.total_encoded_headers++;
+  const HpackErrorCode rc =
+      EncodeNewName(folded_, value, name_prefix, folded.huffman_size,
+                    folded.hash, start, out);
+  if (rc != HPACK_ERR::NONE) {
+    failed_ = true;
+    stats_.error_count++;
+    return rc;
+  }
+  stats_.total_bytes_processed += out.size() - start;
+  return HPACK_ERR::NONE;
+}
+
+HpackErrorCode Encoder::EncodeFolded(absl::Span<const Header> fields,
+                                     stream::RawBuffer<>& out) noexcept {
+  HpackErrorCode rc = BeginBlock(out);
+  for (const Header& f : fields) {
+    if (rc != HPACK_ERR::NONE) {
+      break;
+    }
+    rc = EncodeFoldedField(f.name, f.value, out);
+  }
+  return rc;
+}
+
+}  // namespace hpack
+}  // namespace h2v
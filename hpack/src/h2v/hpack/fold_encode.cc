@@ -0,0 +1,181 @@
+// src/h2v/hpack/fold_encode.cc
+#include "h2v/hpack/fold_encode.h"
+
+#include <array>
+
+#include "h2v/hpack/field_class.h"
+#include "h2v/hpack/field_hash.h"
+#include "h2v/hpack/generated/huffman_byte_table_encode.h"
+
+#if defined(H2V_HAVE_HIGHWAY)
+#include "hwy/highway.h"
+#endif
+
+namespace h2v {
+namespace hpack {
+
+namespace {
+
+constexpr uint8_t kNotToken =
+    FIELD_CLASS::NAME_FORBIDDEN | FIELD_CLASS::NON_TOKEN;
+
+/// @brief Right-aligned Huffman code of one octet.
+struct HuffmanCode {
+  uint32_t bits;
+  uint8_t length;
+};
+
+constexpr std::array<HuffmanCode, 256> MakeHuffmanCodes() noexcept {
+  std::array<HuffmanCode, 256> codes{};
+  for (int c = 0; c < 256; ++c) {
+    const auto& e = huffman::table::kEncodeTable[c];
+    uint64_t left = 0;
+    for (int b = 0; b < e.byte_count; ++b) {
+      left |= uint64_t(e.bytes[b]) << (56 - 8 * b);
+    }
+    codes[c] = {uint32_t(left >> (64 - e.bit_length)), e.bit_length};
+  }
+  return codes;
+}
+
+constexpr std::array<HuffmanCode, 256> kHuffmanCodes = MakeHuffmanCodes();
+
+constexpr bool TokenCodesFit() noexcept {
+  for (int c = 0; c < 256; ++c) {
+    if (!(kFieldClass[c] & kNotToken) && kHuffmanCodes[c].length > 16) {
+      return false;
+    }
+  }
+  return true;
+}
+static_assert(TokenCodesFit(), "FoldEncodeBound() assumes 16-bit codes");
+
+/// @brief Appends Huffman codes to an output run, 32 bits at a time.
+class BitPacker {
+ public:
+  explicit BitPacker(uint8_t* out) noexcept : out_(out) {}
+
+  void Put(uint8_t c) noexcept {
+    const HuffmanCode code = kHuffmanCodes[c];
+    // at most 31 pending bits plus a 30-bit code: fits the accumulator
+    acc_ = (acc_ << code.length) | code.bits;
+    bits_ += code.length;
+    if (bits_ >= 32) {
+      bits_ -= 32;
+      const uint32_t word = uint32_t(acc_ >> bits_);
+      out_[size_] = uint8_t(word >> 24);
+      out_[size_ + 1] = uint8_t(word >> 16);
+      out_[size_ + 2] = uint8_t(word >> 8);
+      out_[size_ + 3] = uint8_t(word);
+      size_ += 4;
+    }
+  }
+
+  /// @brief Pad the last octet with the EOS prefix (all ones) and return
+  ///   the size of the code.
+  std::size_t Finish() noexcept {
+    const int pad = (8 - bits_ % 8) % 8;
+    acc_ = (acc_ << pad) | ((uint64_t{1} << pad) - 1);
+    bits_ += pad;
+    while (bits_ > 0) {
+      bits_ -= 8;
+      out_[size_++] = uint8_t(acc_ >> bits_);
+    }
+    return size_;
+  }
+
+ private:
+  uint8_t* out_;
+  std::size_t size_ = 0;
+  uint64_t acc_ = 0;
+  int bits_ = 0;
+};
+
+#if defined(H2V_HAVE_HIGHWAY)
+
+namespace hn = hwy::HWY_NAMESPACE;
+
+/// Octet c is a tchar iff kTokenByLow[c & 15] & kTokenByHigh[c >> 4]:
+/// bit h of the low table is set when (h << 4 | low) is a tchar, and the
+/// high table maps h to that bit (none for h >= 8, non-ASCII).
+struct TokenNibbleTables {
+  std::array<uint8_t, 16> low{};
+  std::array<uint8_t, 16> high{};
+};
+
+constexpr TokenNibbleTables MakeTokenNibbleTables() noexcept {
+  TokenNibbleTables t;
+  for (int h = 0; h < 8; ++h) {
+    t.high[h] = uint8_t(1u << h);
+    for (int l = 0; l < 16; ++l) {
+      if (!(kFieldClass[h << 4 | l] & kNotToken)) {
+        t.low[l] |= uint8_t(1u << h);
+      }
+    }
+  }
+  return t;
+}
+
+alignas(16) constexpr TokenNibbleTables kTokenNibbles =
+    MakeTokenNibbleTables();
+
+#endif
+
+}  // namespace
+
+bool FoldEncodeName(const uint8_t* in, std::size_t n, uint8_t* folded,
+                    uint8_t* huffman, FoldedName& result) noexcept {
+  BitPacker packer(huffman);
+  uint64_t h = kFieldHashSeed;
+  std::size_t i = 0;
+#if defined(H2V_HAVE_HIGHWAY)
+  const hn::ScalableTag<uint8_t> d;
+  const std::size_t lanes = hn::Lanes(d);
+  const auto token_by_low = hn::LoadDup128(d, kTokenNibbles.low.data());
+  const auto token_by_high = hn::LoadDup128(d, kTokenNibbles.high.data());
+  const auto low_nibble = hn::Set(d, uint8_t{0x0f});
+  const auto upper_a = hn::Set(d, uint8_t{'A'});
+  const auto letters = hn::Set(d, uint8_t{26});
+  const auto case_bit = hn::Set(d, uint8_t{0x20});
+  for (; i + lanes <= n; i += lanes) {
+    const auto v = hn::LoadU(d, in + i);
+    const auto token =
+        hn::And(hn::TableLookupBytes(token_by_low, hn::And(v, low_nibble)),
+                hn::TableLookupBytes(token_by_high, hn::ShiftRight<4>(v)));
+    if (!hn::AllFalse(d, hn::Eq(token, hn::Zero(d)))) {
+      return false;
+    }
+    const auto upper = hn::Lt(hn::Sub(v, upper_a), letters);
+    hn::StoreU(hn::Or(v, hn::IfThenElseZero(upper, case_bit)), d,
+               folded + i);
+    for (std::size_t k = i; k < i + lanes; ++k) {
+      h = FieldHashStep(h, folded[k]);
+      packer.Put(folded[k]);
+    }
+  }
+#else
+  for (; i + 8 <= n; i += 8) {
+    if (FoldFieldName(in + i, 8, folded + i) & kNotToken) {
+      return false;
+    }
+    for (std::size_t k = i; k < i + 8; ++k) {
+      h = FieldHashStep(h, folded[k]);
+      packer.Put(folded[k]);
+    }
+  }
+#endif
+  for (; i < n; ++i) {
+    if (kFieldClass[in[i]] & kNotToken) {
+      return false;
+    }
+    folded[i] = LowerAscii(in[i]);
+    h = FieldHashStep(h, folded[i]);
+    packer.Put(folded[i]);
+  }
+  result.hash = FieldHashFinish(h);
+  result.huffman_size = packer.Finish();
+  return true;
+}
+
+}  // namespace hpack
+}  // namespace h2v
@@ -0,0 +1,235 @@
+// src/h2v/hpack/header_block.cc
+#include "h2v/hpack/header_block.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+
+namespace h2v {
+namespace hpack {
+
+namespace {
+
+constexpr std::size_t kMaxBytes = std::numeric_limits<uint32_t>::max();
+
+void MarkId(std::array<uint64_t, 2>& ids, HeaderId id) noexcept {
+  const std::size_t i = static_cast<std::size_t>(id);
+  ids[i / 64] |= uint64_t{1} << (i % 64);
+}
+
+}  // namespace
+
+bool HeaderBlockView::FromBytes(absl::Span<const uint8_t> bytes,
+                                HeaderBlockView& out) noexcept {
+  if (bytes.size() < kPrefixBytes) {
+    return false;
+  }
+  uint32_t count, bytes_size;
+  std::memcpy(&count, bytes.data(), sizeof(count));
+  std::memcpy(&bytes_size, bytes.data() + sizeof(count), sizeof(bytes_size));
+  const std::size_t slots_size = std::size_t{count} * sizeof(Slot);
+  if (bytes.size() - kPrefixBytes != slots_size + bytes_size) {
+    return false;
+  }
+  HeaderBlockView view;
+  view.slots_ = bytes.data() + kPrefixBytes;
+  view.bytes_ = view.slots_ + slots_size;
+  view.count_ = count;
+  view.bytes_size_ = bytes_size;
+  for (std::size_t i = 0; i < count; ++i) {
+    const Slot s = view.SlotAt(i);
+    if (s.name_offset > bytes_size ||
+        s.name_length > bytes_size - s.name_offset ||
+        s.value_offset > bytes_size ||
+        s.value_length > bytes_size - s.value_offset ||
+        static_cast<std::size_t>(s.id) >= kHeaderIdCount ||
+        s.type > EntryType::LiteralNeverIndexed) {
+      return false;
+    }
+    MarkId(view.ids_, s.id);
+  }
+  out = view;
+  return true;
+}
+
+std::size_t HeaderBlockView::Find(HeaderId id,
+                                  std::size_t from) const noexcept {
+  if (!Contains(id)) {
+    return npos;
+  }
+  for (std::size_t i = from; i < count_; ++i) {
+    if (slots_[i * sizeof(Slot) + offsetof(Slot, id)] ==
+        static_cast<uint8_t>(id)) {
+      return i;
+    }
+  }
+  return npos;
+}
+
+HpackErrorCode HeaderBlockView::SerializeTo(
+    stream::RawBuffer<>& out) const noexcept {
+  uint8_t* dst = out.append(ByteSize());
+  if (!dst) {
+    return HPACK_ERR::OUT_OF_MEMORY;
+  }
+  std::memcpy(dst, &count_, sizeof(count_));
+  std::memcpy(dst + sizeof(count_), &bytes_size_, sizeof(bytes_size_));
+  dst += kPrefixBytes;
+  if (count_ > 0) {
+    std::memcpy(dst, slots_, count_ * sizeof(Slot));
+    dst += count_ * sizeof(Slot);
+  }
+  if (bytes_size_ > 0) {
+    std::memcpy(dst, bytes_, bytes_size_);
+  }
+  return HPACK_ERR::NONE;
+}
+
+HeaderBlock::HeaderBlock(HeaderBlock&& o) noexcept
+                : arena_(std::move(o.arena_)),
+                  slot_cap_(std::exchange(o.slot_cap_, 0)),
+                  byte_cap_(std::exchange(o.byte_cap_, 0)),
+                  count_(std::exchange(o.count_, 0)),
+                  bytes_used_(std::exchange(o.bytes_used_, 0)),
+                  ids_(std::exchange(o.ids_, {})),
+                  failed_(std::exchange(o.failed_, false)) {}
+
+HeaderBlock& HeaderBlock::operator=(HeaderBlock&& o) noexcept {
+  if (this != &o) {
+    arena_ = std::move(o.arena_);
+    slot_cap_ = std::exchange(o.slot_cap_, 0);
+    byte_cap_ = std::exchange(o.byte_cap_, 0);
+    count_ = std::exchange(o.count_, 0);
+    bytes_used_ = std::exchange(o.bytes_used_, 0);
+    ids_ = std::exchange(o.ids_, {});
+    failed_ = std::exchange(o.failed_, false);
+  }
+  return *this;
+}
+
+void HeaderBlock::OnHeader(const DecodedHeader& header) {
+  if (Append(header.name, header.value, header.id, header.type) !=
+      HPACK_ERR::NONE) {
+    failed_ = true;
+  }
+}
+
+HpackErrorCode HeaderBlock::Grow(std::size_t slot_cap,
+                                 std::size_t byte_cap) noexcept {
+  stream::RawBuffer<> bigger;
+  uint8_t* dst = bigger.append(slot_cap * sizeof(Slot) + byte_cap);
+  if (!dst) {
+    return HPACK_ERR::OUT_OF_MEMORY;
+  }
+  if (count_ > 0) {
+    std::memcpy(dst, arena_.raw(), count_ * sizeof(Slot));
+  }
+  if (bytes_used_ > 0) {
+    std::memcpy(dst + slot_cap * sizeof(Slot), Bytes(), bytes_used_);
+  }
+  arena_ = std::move(bigger);
+  slot_cap_ = slot_cap;
+  byte_cap_ = byte_cap;
+  return HPACK_ERR::NONE;
+}
+
+HpackErrorCode HeaderBlock::Reserve(std::size_t fields,
+                                    std::size_t bytes) noexcept {
+  if (fields > kMaxBytes - count_ || bytes > kMaxBytes - bytes_used_) {
+    return HPACK_ERR::OUT_OF_MEMORY;
+  }
+  const std::size_t slot_need = count_ + fields;
+  const std::size_t byte_need = bytes_used_ + bytes;
+  if (slot_need <= slot_cap_ && byte_need <= byte_cap_) {
+    return HPACK_ERR::NONE;
+  }
+  return Grow(std::max(slot_need, slot_cap_), std::max(byte_need, byte_cap_));
+}
+
+HpackErrorCode HeaderBlock::Append(absl::string_view name,
+                                   absl::string_view value, HeaderId id,
+                                   EntryType type) noexcept {
+  const std::size_t n = name.size() + value.size();
+  if (n > kMaxBytes - bytes_used_ || count_ == kMaxBytes) {
+    return HPACK_ERR::OUT_OF_MEMORY;
+  }
+  if (count_ == slot_cap_ || bytes_used_ + n > byte_cap_) {
+    const std::size_t slot_cap =
+        count_ < slot_cap_ ? slot_cap_ : std::max<std::size_t>(16, 2 * count_);
+    const std::size_t byte_cap =
+        bytes_used_ + n <= byte_cap_
+            ? byte_cap_
+            : std::min(kMaxBytes,
+                       std::max<std::size_t>({512, 2 * byte_cap_,
+                                              bytes_used_ + n}));
+    const HpackErrorCode rc = Grow(slot_cap, byte_cap);
+    if (rc != HPACK_ERR::NONE) {
+      return rc;
+    }
+  }
+  Slot s{};
+  s.name_offset = bytes_used_;
+  s.name_length = static_cast<uint32_t>(name.size());
+  s.value_offset = bytes_used_ + s.name_length;
+  s.value_length = static_cast<uint32_t>(value.size());
+  s.id = id;
+  s.type = type;
+  uint8_t* bytes = Bytes();
+  if (!name.empty()) {
+    std::memcpy(bytes + s.name_offset, name.data(), name.size());
+  }
+  if (!value.empty()) {
+    std::memcpy(bytes + s.value_offset, value.data(), value.size());
+  }
+  std::memcpy(arena_.mutable_raw() + count_ * sizeof(Slot), &s, sizeof(s));
+  count_++;
+  bytes_used_ += static_cast<uint32_t>(n);
+  MarkId(ids_, id);
+  return HPACK_ERR::NONE;
+}
+
+HpackErrorCode HeaderBlock::CopyFrom(const HeaderBlockView& view) noexcept {
+  if (view.slots_ == arena_.raw() && view.count_ > 0) {
+    return HPACK_ERR::NONE;  // a view of this block
+  }
+  Clear();
+  if (view.count_ > slot_cap_ || view.bytes_size_ > byte_cap_) {
+    // exact fit: a copy is usually kept, not appended to
+    const HpackErrorCode rc = Grow(std::max<std::size_t>(view.count_, 1),
+                                   view.bytes_size_);
+    if (rc != HPACK_ERR::NONE) {
+      return rc;
+    }
+  }
+  if (view.count_ > 0) {
+    std::memcpy(arena_.mutable_raw(), view.slots_,
+                view.count_ * sizeof(Slot));
+  }
+  if (view.bytes_size_ > 0) {
+    std::memcpy(Bytes(), view.bytes_, view.bytes_size_);
+  }
+  count_ = view.count_;
+  bytes_used_ = view.bytes_size_;
+  ids_ = view.ids_;
+  return HPACK_ERR::NONE;
+}
+
+void HeaderBlock::Clear() noexcept {
+  count_ = 0;
+  bytes_used_ = 0;
+  ids_ = {};
+  failed_ = false;
+}
+
+HeaderBlockView HeaderBlock::View() const noexcept {
+  HeaderBlockView view;
+  view.slots_ = arena_.raw();
+  view.bytes_ = arena_.raw() + slot_cap_ * sizeof(Slot);
+  view.count_ = count_;
+  view.bytes_size_ = bytes_used_;
+  view.ids_ = ids_;
+  return view;
+}
+
+}  // namespace hpack
+}  // namespace h2v
@@ -0,0 +1,274 @@
+// src/h2v/hpack/http1_converter.cc
+#include "h2v/hpack/http1_converter.h"
+
+#include "absl/strings/match.h"
+#include "h2v/hpack/field_class.h"
+
+namespace h2v {
+namespace hpack {
+
+namespace {
+
+/// @brief Next line of `rest` without its CRLF or LF; `rest` moves past it.
+absl::string_view NextLine(absl::string_view& rest) noexcept {
+  const std::size_t nl = rest.find('\n');
+  absl::string_view line = rest.substr(0, nl);
+  rest = nl == absl::string_view::npos ? absl::string_view()
+                                       : rest.substr(nl + 1);
+  if (!line.empty() && line.back() == '\r') {
+    line.remove_suffix(1);
+  }
+  return line;
+}
+
+/// @brief `s` without leading and trailing SP / HTAB (RFC 9110 OWS).
+absl::string_view TrimOws(absl::string_view s) noexcept {
+  while (!s.empty() && (s.front() == ' ' || s.front() == '\t')) {
+    s.remove_prefix(1);
+  }
+  while (!s.empty() && (s.back() == ' ' || s.back() == '\t')) {
+    s.remove_suffix(1);
+  }
+  return s;
+}
+
+uint8_t Classes(absl::string_view s) noexcept {
+  return ClassifyField(reinterpret_cast<const uint8_t*>(s.data()), s.size());
+}
+
+bool Token(absl::string_view s) noexcept {
+  return !s.empty() &&
+         !(Classes(s) & (FIELD_CLASS::NAME_FORBIDDEN | FIELD_CLASS::NON_TOKEN));
+}
+
+bool Digits(absl::string_view s) noexcept {
+  for (const char c : s) {
+    if (c < '0' || c > '9') {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// @brief Fields that only make sense on one HTTP/1.1 connection (RFC 9113
+///   §8.2.2), plus Host, which becomes `:authority`.
+bool ConnectionSpecific(HeaderId id) noexcept {
+  switch (id) {
+    case HeaderId::Connection:
+    case HeaderId::KeepAlive:
+    case HeaderId::ProxyConnection:
+    case HeaderId::TransferEncoding:
+    case HeaderId::Upgrade:
+    case HeaderId::Host:
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+HpackErrorCode Http1Converter::ParseFields(absl::string_view rest) noexcept {
+  fields_.clear();
+  nominated_.clear();
+  try {
+    while (!rest.empty()) {
+      const absl::string_view line = NextLine(rest);
+      if (line.empty()) {
+        break;  // end of the head
+      }
+      // obs-fold continuation lines are rejected (RFC 9112 §5.2), as is
+      // whitespace between the name and the colon (§5.1)
+      const std::size_t colon = line.find(':');
+      if (colon == absl::string_view::npos) {
+        return HPACK_ERR::CONVERT_MALFORMED_HTTP1;
+      }
+      const absl::string_view name = line.substr(0, colon);
+      const absl::string_view value = TrimOws(line.substr(colon + 1));
+      if (!Token(name) || (Classes(value) & FIELD_CLASS::VALUE_FORBIDDEN)) {
+        return HPACK_ERR::CONVERT_MALFORMED_HTTP1;
+      }
+      const HeaderId id = LookupHeaderIdIgnoreCase(name);
+      fields_.push_back({name, value, id});
+      if (id != HeaderId::Connection) {
+        continue;
+      }
+      absl::string_view list = value;
+      while (!list.empty()) {
+        const std::size_t comma = list.find(',');
+        const absl::string_view option = TrimOws(list.substr(0, comma));
+        list = comma == absl::string_view::npos ? absl::string_view()
+                                                : list.substr(comma + 1);
+        if (!option.empty()) {
+          nominated_.push_back(option);
+        }
+      }
+    }
+  } catch (...) {
+    return HPACK_ERR::OUT_OF_MEMORY;
+  }
+  return HPACK_ERR::NONE;
+}
+
+bool Http1Converter::Nominated(absl::string_view name) const noexcept {
+  for (const absl::string_view option : nominated_) {
+    if (absl::EqualsIgnoreCase(option, name)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+HpackErrorCode Http1Converter::EmitFields(stream::RawBuffer<>& out) noexcept {
+  HpackErrorCode rc = HPACK_ERR::NONE;
+  for (const Field& f : fields_) {
+    if (ConnectionSpecific(f.id) || Nominated(f.name)) {
+      continue;
+    }
+    if (f.id == HeaderId::Te) {
+      if (absl::EqualsIgnoreCase(f.value, "trailers")) {
+        rc = encoder_.EncodeFoldedField("te", "trailers", out);
+      }
+    } else if (f.id == HeaderId::Cookie) {
+      absl::string_view rest = f.value;
+      while (!rest.empty() && rc == HPACK_ERR::NONE) {
+        const std::size_t semi = rest.find(';');
+        const absl::string_view crumb = TrimOws(rest.substr(0, semi));
+        rest = semi == absl::string_view::npos ? absl::string_view()
+                                               : rest.substr(semi + 1);
+        if (!crumb.empty()) {
+          rc = encoder_.EncodeFoldedField("cookie", crumb, out);
+        }
+      }
+    } else {
+      rc = encoder_.EncodeFoldedField(f.name, f.value, out);
+    }
+    if (rc != HPACK_ERR::NONE) {
+      return rc;
+    }
+  }
+  return HPACK_ERR::NONE;
+}
+
+HpackErrorCode Http1Converter::Convert(absl::string_view head,
+                                       absl::string_view scheme,
+                                       stream::RawBuffer<>& out) noexcept {
+  absl::string_view rest = head;
+  const absl::string_view start = NextLine(rest);
+  HpackErrorCode rc = ParseFields(rest);
+  if (rc != HPACK_ERR::NONE) {
+    return rc;
+  }
+
+  // start line (RFC 9112 §3, §4)
+  absl::string_view method, target_scheme, authority, path, status;
+  const bool response = absl::StartsWith(start, "HTTP/");
+  if (response) {
+    // HTTP-version SP 3DIGIT SP [ reason-phrase ]
+    const std::size_t sp = start.find(' ');
+    if (sp == absl::string_view::npos || sp + 4 > start.size() ||
+        (sp + 4 < start.size() && start[sp + 4] != ' ')) {
+      return HPACK_ERR::CONVERT_MALFORMED_HTTP1;
+    }
+    status = start.substr(sp + 1, 3);
+    if (!Digits(status)) {
+      return HPACK_ERR::CONVERT_MALFORMED_HTTP1;
+    }
+  } else {
+    // method SP request-target SP HTTP-version
+    const std::size_t sp1 = start.find(' ');
+    const std::size_t sp2 = sp1 == absl::string_view::npos
+                                ? absl::string_view::npos
+                                : start.find(' ', sp1 + 1);
+    if (sp2 == absl::string_view::npos) {
+      return HPACK_ERR::CONVERT_MALFORMED_HTTP1;
+    }
+    method = start.substr(0, sp1);
+    const absl::string_view target = start.substr(sp1 + 1, sp2 - sp1 - 1);
+    const absl::string_view version = start.substr(sp2 + 1);
+    if (!Token(method) || target.empty() ||
+        (Classes(target) & FIELD_CLASS::NAME_FORBIDDEN) ||
+        version.size() != 8 || !absl::StartsWith(version, "HTTP/1.")) {
+      return HPACK_ERR::CONVERT_MALFORMED_HTTP1;
+    }
+    absl::string_view host;
+    for (const Field& f : fields_) {
+      if (f.id == HeaderId::Host) {
+        if (host.data()) {
+          return HPACK_ERR::CONVERT_MALFORMED_HTTP1;  // RFC 9112 §3.2
+        }
+        host = f.value;
+      }
+    }
+
+    if (method == "CONNECT") {
+      authority = target;  // authority-form: no :scheme, no :path
+    } else if (target[0] == '/' || target == "*") {
+      if (!host.data() && version != "HTTP/1.0") {
+        return HPACK_ERR::CONVERT_MALFORMED_HTTP1;  // RFC 9112 §3.2
+      }
+      target_scheme = scheme;
+      authority = host;
+      path = target;
+    } else {
+      // absolute-form: its authority wins over Host (RFC 9112 §3.2.2)
+      const std::size_t sep = target.find("://");
+      if (sep == 0 || sep == absl::string_view::npos) {
+        return HPACK_ERR::CONVERT_MALFORMED_HTTP1;
+      }
+      target_scheme = target.substr(0, sep);
+      const absl::string_view rest_of = target.substr(sep + 3);
+      const std::size_t end = rest_of.find_first_of("/?");
+      authority = rest_of.substr(0, end);
+      if (end == absl::string_view::npos) {
+        path = "/";
+      } else if (rest_of[end] == '/') {
+        path = rest_of.substr(end);
+      } else {
+        try {
+          path_.assign("/");
+          path_.append(rest_of.data() + end, rest_of.size() - end);
+        } catch (...) {
+          return HPACK_ERR::OUT_OF_MEMORY;
+        }
+        path = path_;
+      }
+      if (authority.empty()) {
+        return HPACK_ERR::CONVERT_MALFORMED_HTTP1;
+      }
+    }
+    if (authority.find('@') != absl::string_view::npos) {
+      // userinfo has no place in :authority (RFC 9113 §8.3.1)
+      return HPACK_ERR::CONVERT_MALFORMED_HTTP1;
+    }
+    if (method != "CONNECT" && target_scheme.empty()) {
+      return HPACK_ERR::INVALID_ARGS;
+    }
+  }
+
+  // nothing can fail for the input from here on: encode
+  rc = encoder_.BeginBlock(out);
+  const auto emit = [&](absl::string_view name, absl::string_view value) {
+    if (rc == HPACK_ERR::NONE) {
+      rc = encoder_.EncodeFoldedField(name, value, out);
+    }
+  };
+  if (response) {
+    emit(":status", status);
+  } else {
+    emit(":method", method);
+    if (!target_scheme.empty()) {
+      emit(":scheme", target_scheme);
+    }
+    if (!authority.empty()) {
+      emit(":authority", authority);
+    }
+    if (!path.empty()) {
+      emit(":path", path);
+    }
+  }
+  return rc != HPACK_ERR::NONE ? rc : EmitFields(out);
+}
+
+}  // namespace hpack
+}  // namespace h2v
@@ -0,0 +1,72 @@
+// src/h2v/hpack/memory_budget.cc
+#include "h2v/hpack/memory_budget.h"
+
+#include <algorithm>
+
+namespace h2v {
+namespace hpack {
+
+MemoryBudget::MemoryBudget(const MemoryBudgetConfig& config) noexcept
+                : config_(config),
+                  high_bytes_(config.limit_bytes / 1000 * config.high_permille),
+                  critical_bytes_(config.limit_bytes / 1000 *
+                                  config.critical_permille) {}
+
+std::size_t MemoryBudget::TableCap(MemoryPressure level) const noexcept {
+  switch (level) {
+    case MemoryPressure::High:
+      return config_.pressure_table_bytes;
+    case MemoryPressure::Critical:
+      return 0;
+    default:
+      return SIZE_MAX;
+  }
+}
+
+void MemoryBudget::Charge(std::size_t bytes) noexcept {
+  Update(used_.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+}
+
+bool MemoryBudget::TryCharge(std::size_t bytes) noexcept {
+  std::size_t used = used_.load(std::memory_order_relaxed);
+  do {
+    if (used + bytes > config_.limit_bytes) {
+      return false;
+    }
+  } while (!used_.compare_exchange_weak(used, used + bytes,
+                                        std::memory_order_relaxed));
+  Update(used + bytes);
+  return true;
+}
+
+void MemoryBudget::Release(std::size_t bytes) noexcept {
+  Update(used_.fetch_sub(bytes, std::memory_order_relaxed) - bytes);
+}
+
+void MemoryBudget::Update(std::size_t used) noexcept {
+  const auto level_at = [used](std::size_t high, std::size_t critical) {
+    return used >= critical ? MemoryPressure::Critical
+           : used >= high   ? MemoryPressure::High
+                            : MemoryPressure::None;
+  };
+  MemoryPressure cur = level_.load(std::memory_order_relaxed);
+  MemoryPressure next;
+  do {
+    // rise at the threshold, fall only below 90% of it
+    const MemoryPressure up = level_at(high_bytes_, critical_bytes_);
+    const MemoryPressure down =
+        level_at(high_bytes_ / 10 * 9, critical_bytes_ / 10 * 9);
+    next = std::max(up, std::min(cur, down));
+    if (next == cur) {
+      return;
+    }
+  } while (!level_.compare_exchange_weak(cur, next,
+                                         std::memory_order_relaxed));
+  generation_.fetch_add(1, std::memory_order_release);
+  if (callback_) {
+    callback_(next);
+  }
+}
+
+}  // namespace hpack
+}  // namespace h2v
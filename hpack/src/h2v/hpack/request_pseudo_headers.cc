@@ -0,0 +1,133 @@
+// src/h2v/hpack/request_pseudo_headers.cc
+#include "h2v/hpack/request_pseudo_headers.h"
+
+#include <cstring>
+
+namespace h2v {
+namespace hpack {
+
+RequestMethod ParseRequestMethod(absl::string_view token) noexcept {
+  switch (token.size()) {
+    case 3:
+      if (token == "GET") return RequestMethod::Get;
+      if (token == "PUT") return RequestMethod::Put;
+      break;
+    case 4:
+      if (token == "POST") return RequestMethod::Post;
+      if (token == "HEAD") return RequestMethod::Head;
+      break;
+    case 5:
+      if (token == "PATCH") return RequestMethod::Patch;
+      if (token == "TRACE") return RequestMethod::Trace;
+      break;
+    case 6:
+      if (token == "DELETE") return RequestMethod::Delete;
+      break;
+    case 7:
+      if (token == "CONNECT") return RequestMethod::Connect;
+      if (token == "OPTIONS") return RequestMethod::Options;
+      break;
+    default:
+      break;
+  }
+  return token.empty() ? RequestMethod::None : RequestMethod::Other;
+}
+
+void RequestPseudoHeaders::Clear() noexcept {
+  arena_.clear();
+  slices_ = {};
+  method_ = RequestMethod::None;
+  present_ = 0;
+  closed_ = false;
+  valid_ = false;
+}
+
+RequestPseudoHeaders::AddResult RequestPseudoHeaders::Add(
+    const DecodedHeader& header) noexcept {
+  if (header.name.empty() || header.name[0] != ':') {
+    if (!closed_ && !CloseSection()) {
+      return AddResult::Malformed;
+    }
+    return AddResult::Regular;
+  }
+  // pseudo-headers must precede every regular field (RFC 9113 §8.3)
+  if (closed_) {
+    return AddResult::Malformed;
+  }
+
+  std::size_t slot;
+  switch (header.id) {
+    case HeaderId::Method:
+      slot = 0;
+      break;
+    case HeaderId::Scheme:
+      slot = 1;
+      break;
+    case HeaderId::Authority:
+      slot = 2;
+      break;
+    case HeaderId::Path:
+      slot = 3;
+      break;
+    case HeaderId::Protocol:
+      slot = 4;
+      break;
+    default:
+      return AddResult::Malformed;  // :status or an undefined pseudo-header
+  }
+  const uint8_t bit = static_cast<uint8_t>(1u << slot);
+  if (present_ & bit) {
+    return AddResult::Malformed;  // duplicate
+  }
+  present_ |= bit;
+
+  if (slot == 0) {
+    const bool indexed = header.type == EntryType::IndexedHeader;
+    if (indexed && header.index == 2) {
+      method_ = RequestMethod::Get;
+    } else if (indexed && header.index == 3) {
+      method_ = RequestMethod::Post;
+    } else {
+      method_ = ParseRequestMethod(header.value);
+      if (method_ == RequestMethod::None) {
+        return AddResult::Malformed;  // empty :method
+      }
+    }
+  }
+
+  const std::size_t n = header.value.size();
+  uint8_t* dst = n > 0 ? arena_.append(n) : nullptr;
+  if (n > 0 && !dst) {
+    return AddResult::OutOfMemory;
+  }
+  if (n > 0) {
+    std::memcpy(dst, header.value.data(), n);
+  }
+  slices_[slot] = {static_cast<uint32_t>(arena_.size() - n),
+                   static_cast<uint32_t>(n)};
+  return AddResult::Stored;
+}
+
+bool RequestPseudoHeaders::CloseSection() noexcept {
+  if (closed_) {
+    return valid_;
+  }
+  closed_ = true;
+  valid_ = false;
+  if (!Has(kMethod)) {
+    return false;
+  }
+  if (method_ == RequestMethod::Connect && !Has(kProtocol)) {
+    // CONNECT names only the target authority (RFC 9113 §8.5)
+    valid_ = Has(kAuthority) && !Has(kScheme) && !Has(kPath);
+    return valid_;
+  }
+  if (Has(kProtocol) && method_ != RequestMethod::Connect) {
+    return false;  // :protocol only on extended CONNECT (RFC 8441 §4)
+  }
+  valid_ = Has(kScheme) && Has(kPath) && !Path().empty();
+  return valid_;
+}
+
+}  // namespace hpack
+}  // namespace h2v
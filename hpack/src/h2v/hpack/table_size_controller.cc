@@ -0,0 +1,78 @@
+// src/h2v/hpack/table_size_controller.cc
+#include "h2v/hpack/table_size_controller.h"
+
+#include <algorithm>
+
+namespace h2v {
+namespace hpack {
+
+TableSizeController::TableSizeController(
+    const TableSizeControllerConfig& config) noexcept
+                : config_(config),
+                  active_bytes_(config.initial_bytes),
+                  advertised_(config.decoder_bytes) {}
+
+void TableSizeController::Adapt(const HpackStats& now, std::size_t used,
+                                std::size_t limit) noexcept {
+  const uint64_t fields =
+      now.total_encoded_headers - last_.total_encoded_headers;
+  const uint64_t hits = now.cache_hits - last_.cache_hits;
+  const uint64_t evictions = now.evictions - last_.evictions;
+
+  if (evictions > 0) {
+    no_evict_ticks_ = 0;
+    if (hits * 1000 < fields * config_.grow_below_hit_permille) {
+      active_bytes_ = std::min(std::max(active_bytes_ * 2,
+                                        config_.min_active_bytes),
+                               limit);
+    }
+    return;
+  }
+  if (++no_evict_ticks_ < config_.shrink_ticks || used * 4 > active_bytes_) {
+    return;
+  }
+  no_evict_ticks_ = 0;
+  active_bytes_ = std::max(std::max(active_bytes_ / 2, used * 2),
+                           config_.min_active_bytes);
+}
+
+TableSizeDecision TableSizeController::Tick(Encoder& encoder,
+                                            MemoryPressure pressure) noexcept {
+  HpackStats now;
+  encoder.SnapshotStats(now);
+  const std::size_t limit = encoder.TableLimit();
+
+  if (now.total_encoded_headers == last_.total_encoded_headers) {
+    if (++quiet_ticks_ >= config_.idle_ticks) {
+      idle_ = true;
+    }
+  } else {
+    quiet_ticks_ = 0;
+    if (!idle_) {
+      Adapt(now, encoder.TableBytes(), limit);
+    }
+    idle_ = false;  // woken: the last active size comes back
+  }
+  last_ = now;
+
+  std::size_t enc = idle_ ? config_.idle_bytes : active_bytes_;
+  std::size_t dec = idle_ ? std::min(config_.idle_bytes, config_.decoder_bytes)
+                          : config_.decoder_bytes;
+  if (pressure == MemoryPressure::High) {
+    enc = std::min(enc, config_.pressure_bytes);
+    dec = std::min(dec, config_.pressure_bytes);
+  } else if (pressure == MemoryPressure::Critical) {
+    enc = dec = 0;
+  }
+  encoder.SetTableTarget(enc);
+
+  TableSizeDecision d;
+  d.encoder_bytes = encoder.MaxTableBytes();
+  d.decoder_bytes = dec;
+  d.advertise = dec != advertised_;
+  advertised_ = dec;
+  return d;
+}
+
+}  // namespace hpack
+}  // namespace h2v
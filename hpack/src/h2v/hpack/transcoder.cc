@@ -0,0 +1,36 @@
+// src/h2v/hpack/transcoder.cc
+#include "h2v/hpack/transcoder.h"
+
+namespace h2v {
+namespace hpack {
+
+HpackErrorCode Transcoder::Begin(stream::RawBuffer<>& out) noexcept {
+  out_ = &out;
+  rc_ = encoder_.BeginBlock(out);
+  return rc_;
+}
+
+void Transcoder::Forward(const DecodedHeader& header) noexcept {
+  if (out_ && rc_ == HPACK_ERR::NONE) {
+    rc_ = encoder_.Transcode(header, *out_);
+  }
+}
+
+void Transcoder::Add(absl::string_view name, absl::string_view value) noexcept {
+  DecodedHeader header;
+  header.name = name;
+  header.value = value;
+  header.type = EntryType::LiteralWithoutIndexing;
+  header.id = LookupHeaderId(name);
+  Forward(header);
+}
+
+HpackErrorCode Transcoder::Finish() noexcept {
+  out_ = nullptr;
+  const HpackErrorCode rc = rc_;
+  rc_ = HPACK_ERR::NONE;
+  return rc;
+}
+
+}  // namespace hpack
+}  // namespace h2v
@@ -0,0 +1,97 @@
+// src/h2v/hpack/value_pool.cc
+#include "h2v/hpack/value_pool.h"
+
+#include <cstring>
+#include <new>
+
+namespace h2v {
+namespace hpack {
+
+ValuePool::ValuePool(const ValuePoolConfig& config) noexcept
+                : config_(config) {}
+
+ValuePool::~ValuePool() {
+  for (Shard& shard : shards_) {
+    for (Node* node : shard.nodes) {
+      Destroy(node);
+    }
+  }
+}
+
+void ValuePool::Destroy(Node* node) noexcept {
+  node->~Node();
+  ::operator delete(node);
+}
+
+PooledString ValuePool::Intern(absl::string_view value,
+                               uint64_t hash) noexcept {
+  const Key key{value, KeyOf(value)};
+  Shard& shard = ShardOf(key.key);
+  {
+    absl::ReaderMutexLock lk(&shard.mutex);
+    auto it = shard.nodes.find(key);
+    if (it != shard.nodes.end()) {
+      // a listed node has a reference: the last one is only dropped with
+      // the shard held exclusively
+      (*it)->refs.fetch_add(1, std::memory_order_relaxed);
+      hits_.fetch_add(1, std::memory_order_relaxed);
+      return PooledString(*it);
+    }
+  }
+
+  void* mem = ::operator new(sizeof(Node) + value.size(), std::nothrow);
+  if (!mem) {
+    return {};
+  }
+  Node* node = new (mem) Node{{1}, static_cast<uint32_t>(value.size()), hash,
+                              key.key, this};
+  if (!value.empty()) {
+    std::memcpy(node->mutable_bytes(), value.data(), value.size());
+  }
+
+  absl::MutexLock lk(&shard.mutex);
+  std::pair<absl::flat_hash_set<Node*, NodeHash, NodeEq>::iterator, bool> ins;
+  try {
+    ins = shard.nodes.insert(node);
+  } catch (...) {
+    Destroy(node);
+    return {};
+  }
+  if (!ins.second) {
+    // another thread interned it since the lookup
+    Destroy(node);
+    (*ins.first)->refs.fetch_add(1, std::memory_order_relaxed);
+    hits_.fetch_add(1, std::memory_order_relaxed);
+    return PooledString(*ins.first);
+  }
+  strings_.fetch_add(1, std::memory_order_relaxed);
+  bytes_.fetch_add(value.size(), std::memory_order_relaxed);
+  return PooledString(node);
+}
+
+void ValuePool::Release(Node* node) noexcept {
+  // drop all but the last reference without locking
+  uint32_t refs = node->refs.load(std::memory_order_relaxed);
+  while (refs > 1) {
+    if (node->refs.compare_exchange_weak(refs, refs - 1,
+                                         std::memory_order_acq_rel,
+                                         std::memory_order_relaxed)) {
+      return;
+    }
+  }
+  Shard& shard = ShardOf(node->key);
+  {
+    absl::MutexLock lk(&shard.mutex);
+    // an Intern() may have taken a new reference before we got the lock
+    if (node->refs.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+      return;
+    }
+    shard.nodes.erase(node);
+  }
+  strings_.fetch_sub(1, std::memory_order_relaxed);
+  bytes_.fetch_sub(node->size, std::memory_order_relaxed);
+  Destroy(node);
+}
+
+}  // namespace hpack
+}  // namespace h2v
@@ -0,0 +1,80 @@
+// inc/h2v/transport/epoll_transport.h
+#pragma once
+
+#include <sys/epoll.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "h2v/transport/transport.h"
+
+namespace h2v {
+namespace transport {
+
+/// @brief Readiness-based reference transport (epoll, edge-triggered).
+/// @details The portable fallback: every socket is non-blocking, reads land
+///   in one loop-wide buffer (handed to OnRead() and reused right after),
+///   Writev() is a sendmsg(2) straight from the FrameWriter's iovecs, so
+///   nothing is staged or copied on the write path.
+///
+///   Not thread-safe: owned by the thread running Poll(); only Wake() may be
+///   called from other threads.
+class EpollTransport final : public Transport {
+ public:
+  explicit EpollTransport(const TransportConfig& config = {}) noexcept;
+  ~EpollTransport() override;
+  EpollTransport(const EpollTransport&) = delete;
+  EpollTransport& operator=(const EpollTransport&) = delete;
+
+  TransportKind Kind() const noexcept override {
+    return TransportKind::Epoll;
+  }
+  TransportErrorCode Init() noexcept override;
+  TransportErrorCode Listen(const char* ipv4, uint16_t port,
+                            ConnectionHandler& handler) noexcept override;
+  uint16_t ListenPort() const noexcept override {
+    return listen_port_;
+  }
+  TransportErrorCode Connect(const char* ipv4, uint16_t port,
+                             ConnectionHandler& handler,
+                             Connection** out = nullptr) noexcept override;
+  int Poll(int timeout_ms) noexcept override;
+  void Wake() noexcept override;
+  std::size_t OpenConnections() const noexcept override {
+    return open_;
+  }
+
+ private:
+  class Conn;
+  static constexpr int kMaxEvents = 256;
+
+  TransportConfig config_;
+  bool ready_ = false;
+  int epoll_fd_ = -1;
+  int wake_fd_ = -1;
+  int listen_fd_ = -1;
+  uint16_t listen_port_ = 0;
+  ConnectionHandler* listen_handler_ = nullptr;
+
+  std::unique_ptr<Conn[]> conns_;
+  std::vector<uint32_t> free_;     ///< free slot indices
+  std::vector<uint32_t> closing_;  ///< slots waiting for OnClose()
+  std::size_t open_ = 0;
+  std::unique_ptr<uint8_t[]> recv_buffer_;
+  epoll_event events_[kMaxEvents];
+
+  Conn* Register(int fd, ConnectionHandler& handler) noexcept;
+  void AcceptAll() noexcept;
+  void OnConnEvent(Conn& conn, uint32_t events) noexcept;
+  void CloseLater(Conn& conn, int error) noexcept;
+  void FinishCloses() noexcept;
+  TransportErrorCode SystemError(int err) noexcept {
+    last_errno_ = err;
+    return TRANSPORT_ERR::SYSTEM_ERROR;
+  }
+};
+
+}  // namespace transport
+}  // namespace h2v
@@ -0,0 +1,27 @@
+// inc/h2v/transport/error_code.h
+#pragma once
+
+#include <cstdint>
+
+namespace h2v {
+namespace transport {
+
+using TransportErrorCode = int32_t;
+
+/// @brief Library-level status codes returned by the reference transports.
+/// @details System call failures are reported as SYSTEM_ERROR; the errno
+///   value is kept by the transport (Transport::LastErrno()).
+namespace TRANSPORT_ERR {
+
+static constexpr TransportErrorCode NONE = 0;
+static constexpr TransportErrorCode INVALID_ARGS = 1;
+static constexpr TransportErrorCode OUT_OF_MEMORY = 2;
+static constexpr TransportErrorCode UNSUPPORTED = 3;
+static constexpr TransportErrorCode SYSTEM_ERROR = 4;
+static constexpr TransportErrorCode TOO_MANY_CONNECTIONS = 5;
+static constexpr TransportErrorCode NOT_INITIALIZED = 6;
+
+}  // namespace TRANSPORT_ERR
+
+}  // namespace transport
+}  // namespace h2v
@@ -0,0 +1,26 @@
+// inc/h2v/transport/socket_util.h
+#pragma once
+
+#include <cstdint>
+
+namespace h2v {
+namespace transport {
+
+/// @brief Bind and listen on `ipv4`:`port` with SO_REUSEADDR.
+/// @return the socket, or -errno.
+int OpenListenSocket(const char* ipv4, uint16_t port, int backlog,
+                     bool non_blocking) noexcept;
+
+/// @brief Blocking connect to `ipv4`:`port`.
+/// @return the socket, or -errno.
+int OpenClientSocket(const char* ipv4, uint16_t port) noexcept;
+
+/// @brief Local port a socket is bound to, 0 on error.
+uint16_t LocalPort(int fd) noexcept;
+
+/// @brief Apply per-connection options (TCP_NODELAY, O_NONBLOCK).
+/// @return 0 or -errno.
+int ConfigureStream(int fd, bool no_delay, bool non_blocking) noexcept;
+
+}  // namespace transport
+}  // namespace h2v
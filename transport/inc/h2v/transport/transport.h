@@ -0,0 +1,149 @@
+// inc/h2v/transport/transport.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "absl/types/span.h"
+#include "h2v/frame/frame_writer.h"
+#include "h2v/transport/error_code.h"
+
+namespace h2v {
+namespace transport {
+
+/// @brief Sizing of a reference transport. Everything is allocated by
+///   Init(); accepting, reading and writing never allocate afterwards
+///   (io_uring send staging is allocated the first time a slot is used and
+///   kept for the transport's lifetime).
+struct TransportConfig {
+  /// Connection slots; accepts beyond this are closed immediately.
+  std::size_t max_connections = 1024;
+  /// Size of one receive buffer.
+  std::size_t recv_buffer_size = 16 * 1024;
+  /// io_uring: provided receive buffers shared by all connections (power of
+  /// two, at most 32768).
+  uint32_t recv_buffer_count = 512;
+  /// io_uring: per-connection send staging, twice this size (one half in
+  /// flight, one filling).
+  std::size_t send_buffer_size = 64 * 1024;
+  /// io_uring: submission queue entries (the CQ gets four times as many).
+  uint32_t queue_depth = 1024;
+  /// listen(2) backlog.
+  int backlog = 1024;
+  /// Set TCP_NODELAY on every connection.
+  bool no_delay = true;
+};
+
+/// @brief One byte stream, as seen by the frame layer.
+/// @details A Connection is a frame::FrameSink, so FrameWriter::Flush() can
+///   write to it directly. Writev() never blocks: a short count or 0 means
+///   the transport is full, WriteBlocked() turns true and
+///   ConnectionHandler::OnWritable() follows once it drains.
+///
+///   Connections live in slots owned by the transport and are reused after
+///   ConnectionHandler::OnClose(); do not keep pointers past that call.
+class Connection : public frame::FrameSink {
+ public:
+  /// @brief Close the connection. Outstanding I/O is cancelled and
+  ///   OnClose() is delivered from a later Poll(); further Writev() calls
+  ///   fail.
+  virtual void Close() noexcept = 0;
+
+  bool WriteBlocked() const noexcept {
+    return write_blocked_;
+  }
+  bool Closing() const noexcept {
+    return closing_;
+  }
+  /// @brief Slot index, stable while the connection is open.
+  uint32_t Id() const noexcept {
+    return id_;
+  }
+
+  /// Free for the owner of the connection (typically its h2v session).
+  void* user_data = nullptr;
+
+ protected:
+  bool write_blocked_ = false;
+  bool closing_ = false;
+  uint32_t id_ = 0;
+};
+
+/// @brief Connection events, delivered on the thread calling Poll().
+class ConnectionHandler {
+ public:
+  virtual ~ConnectionHandler() = default;
+
+  /// @brief A connection was accepted or connected.
+  virtual void OnOpen(Connection& conn) noexcept = 0;
+  /// @brief Read completion. `data` is a transport buffer that is recycled
+  ///   when the call returns; feed it to the FrameParser right away.
+  virtual void OnRead(Connection& conn,
+                      absl::Span<const uint8_t> data) noexcept = 0;
+  /// @brief The transport drained after Writev() reported backpressure.
+  virtual void OnWritable(Connection& conn) noexcept = 0;
+  /// @brief Final event of a connection.
+  /// @param error  0 for an orderly close (peer EOF or Close()), else errno.
+  virtual void OnClose(Connection& conn, int error) noexcept = 0;
+};
+
+enum class TransportKind : uint8_t {
+  Epoll = 0,
+  IoUring = 1
+};
+
+/// @brief Minimal event-loop transport: TCP over IPv4, one loop per
+///   instance.
+/// @details Not thread-safe except Wake(): Listen(), Connect() and Poll()
+///   belong to the thread running the loop.
+class Transport {
+ public:
+  virtual ~Transport() = default;
+
+  virtual TransportKind Kind() const noexcept = 0;
+
+  /// @brief Create the kernel objects and preallocate every slot.
+  virtual TransportErrorCode Init() noexcept = 0;
+
+  /// @brief Accept connections on `ipv4`:`port` (0 picks a free port, see
+  ///   ListenPort()); accepted connections report to `handler`.
+  virtual TransportErrorCode Listen(const char* ipv4, uint16_t port,
+                                    ConnectionHandler& handler) noexcept = 0;
+  virtual uint16_t ListenPort() const noexcept = 0;
+
+  /// @brief Connect to `ipv4`:`port`. The connect itself is blocking (meant
+  ///   for loopback load generation); OnOpen() runs before this returns.
+  virtual TransportErrorCode Connect(const char* ipv4, uint16_t port,
+                                     ConnectionHandler& handler,
+                                     Connection** out = nullptr) noexcept = 0;
+
+  /// @brief Wait up to `timeout_ms` (-1: forever, 0: don't wait) and
+  ///   dispatch every ready event.
+  /// @return events dispatched, or a negative TRANSPORT_ERR code.
+  virtual int Poll(int timeout_ms) noexcept = 0;
+
+  /// @brief Make a blocked Poll() return (any thread), e.g. after
+  ///   frame::OutboundQueue::Push() asked for a wakeup.
+  virtual void Wake() noexcept = 0;
+
+  virtual std::size_t OpenConnections() const noexcept = 0;
+
+  /// @brief errno of the last SYSTEM_ERROR.
+  int LastErrno() const noexcept {
+    return last_errno_;
+  }
+
+ protected:
+  int last_errno_ = 0;
+};
+
+/// @brief Create and Init() a transport: io_uring when `prefer_io_uring`
+///   and the kernel supports multishot receive with provided buffers,
+///   epoll otherwise.
+/// @return nullptr if neither could be initialized.
+std::unique_ptr<Transport> CreateTransport(const TransportConfig& config = {},
+                                           bool prefer_io_uring = true) noexcept;
+
+}  // namespace transport
+}  // namespace h2v
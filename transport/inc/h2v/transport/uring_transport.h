@@ -0,0 +1,132 @@
+// inc/h2v/transport/uring_transport.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "h2v/transport/transport.h"
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+struct io_uring_buf;
+
+namespace h2v {
+namespace transport {
+
+/// @brief Completion-based reference transport (io_uring, raw syscalls).
+/// @details
+///   - Receive: one multishot recv per connection draws from a provided
+///     buffer ring registered with the kernel; OnRead() sees the buffer in
+///     place and it is handed back to the ring when the call returns.
+///   - Accept: one multishot accept on the listening socket.
+///   - Send: Writev() copies into the connection's staging half that is not
+///     in flight and submits it if the socket is idle. FrameWriter retires
+///     bytes as soon as Writev() accepts them, so they must be owned by the
+///     transport until the completion; a full staging area is reported as
+///     backpressure.
+///   - Wake(): eventfd watched by a multishot poll.
+///
+///   Requires a kernel with provided buffer rings and multishot recv
+///   (Linux 6.0+); Init() returns UNSUPPORTED otherwise so callers can fall
+///   back to EpollTransport.
+///
+///   Not thread-safe: owned by the thread running Poll(); only Wake() may be
+///   called from other threads.
+class UringTransport final : public Transport {
+ public:
+  explicit UringTransport(const TransportConfig& config = {}) noexcept;
+  ~UringTransport() override;
+  UringTransport(const UringTransport&) = delete;
+  UringTransport& operator=(const UringTransport&) = delete;
+
+  TransportKind Kind() const noexcept override {
+    return TransportKind::IoUring;
+  }
+  TransportErrorCode Init() noexcept override;
+  TransportErrorCode Listen(const char* ipv4, uint16_t port,
+                            ConnectionHandler& handler) noexcept override;
+  uint16_t ListenPort() const noexcept override {
+    return listen_port_;
+  }
+  TransportErrorCode Connect(const char* ipv4, uint16_t port,
+                             ConnectionHandler& handler,
+                             Connection** out = nullptr) noexcept override;
+  int Poll(int timeout_ms) noexcept override;
+  void Wake() noexcept override;
+  std::size_t OpenConnections() const noexcept override {
+    return open_;
+  }
+
+ private:
+  class Conn;
+
+  TransportConfig config_;
+  bool ready_ = false;
+  int ring_fd_ = -1;
+
+  // submission ring
+  void* sq_ring_ = nullptr;
+  std::size_t sq_ring_size_ = 0;
+  io_uring_sqe* sqes_ = nullptr;
+  std::size_t sqes_size_ = 0;
+  uint32_t* sq_head_ = nullptr;
+  uint32_t* sq_tail_ = nullptr;
+  uint32_t sq_mask_ = 0;
+  uint32_t sq_entries_ = 0;
+  uint32_t sqe_tail_ = 0;  ///< local tail, published by Enter()
+
+  // completion ring (shares sq_ring_ with IORING_FEAT_SINGLE_MMAP)
+  void* cq_ring_ = nullptr;
+  std::size_t cq_ring_size_ = 0;
+  uint32_t* cq_head_ = nullptr;
+  uint32_t* cq_tail_ = nullptr;
+  uint32_t cq_mask_ = 0;
+  io_uring_cqe* cqes_ = nullptr;
+
+  // provided receive buffers
+  io_uring_buf* buf_ring_ = nullptr;  ///< entry 0's `resv` is the tail
+  std::size_t buf_ring_size_ = 0;
+  uint16_t buf_tail_ = 0;
+  bool buf_ring_registered_ = false;
+  std::unique_ptr<uint8_t[]> recv_buffers_;
+
+  int wake_fd_ = -1;
+  int listen_fd_ = -1;
+  uint16_t listen_port_ = 0;
+  ConnectionHandler* listen_handler_ = nullptr;
+
+  std::unique_ptr<Conn[]> conns_;
+  std::vector<uint32_t> free_;     ///< free slot indices
+  std::vector<uint32_t> closing_;  ///< slots with no I/O left, to finish
+  std::size_t open_ = 0;
+
+  /// @brief Next free SQE (zeroed), submitting queued ones if the ring is
+  ///   full; nullptr if still full.
+  io_uring_sqe* GetSqe() noexcept;
+  /// @brief Publish queued SQEs and optionally wait for completions.
+  int Enter(uint32_t min_complete, int timeout_ms) noexcept;
+  int Reap() noexcept;
+  void Dispatch(uint64_t user_data, int32_t res, uint32_t flags) noexcept;
+
+  bool ArmAccept() noexcept;
+  bool ArmWake() noexcept;
+  bool ArmRecv(Conn& conn) noexcept;
+  bool SubmitSend(Conn& conn) noexcept;
+  void RecycleBuffer(uint16_t bid) noexcept;
+
+  Conn* Register(int fd, ConnectionHandler& handler) noexcept;
+  void OnRecv(Conn& conn, int32_t res, uint32_t flags) noexcept;
+  void OnSend(Conn& conn, int32_t res) noexcept;
+  void CloseLater(Conn& conn, int error) noexcept;
+  void MaybeFinish(Conn& conn) noexcept;
+  void FinishCloses() noexcept;
+  TransportErrorCode SystemError(int err) noexcept {
+    last_errno_ = err;
+    return TRANSPORT_ERR::SYSTEM_ERROR;
+  }
+};
+
+}  // namespace transport
+}  // namespace h2v
@@ -0,0 +1,377 @@
+// src/h2v/transport/epoll_transport.cc
+#include "h2v/transport/epoll_transport.h"
+
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <initializer_list>
+#include <new>
+
+#include "h2v/transport/socket_util.h"
+
+namespace h2v {
+namespace transport {
+
+namespace {
+
+// epoll_event.data.u64: generation << 32 | slot, or one of these tags
+constexpr uint32_t kListenTag = 0xFFFFFFFFu;
+constexpr uint32_t kWakeTag = 0xFFFFFFFEu;
+
+uint64_t MakeKey(uint32_t gen, uint32_t slot) noexcept {
+  return (uint64_t(gen) << 32) | slot;
+}
+
+}  // namespace
+
+// -----------------------------------------------------------------------------
+// EpollTransport::Conn
+// -----------------------------------------------------------------------------
+
+class EpollTransport::Conn final : public Connection {
+ public:
+  int64_t Writev(const struct iovec* iov, int iovcnt) noexcept override {
+    if (closing_ || fd < 0) {
+      return -1;
+    }
+    msghdr msg = {};
+    msg.msg_iov = const_cast<struct iovec*>(iov);
+    msg.msg_iovlen = static_cast<std::size_t>(iovcnt);
+    for (;;) {
+      const ssize_t n = ::sendmsg(fd, &msg, MSG_NOSIGNAL);
+      if (n >= 0) {
+        std::size_t offered = 0;
+        for (int i = 0; i < iovcnt; ++i) {
+          offered += iov[i].iov_len;
+        }
+        // short write: the socket buffer is full, EPOLLOUT follows
+        write_blocked_ = static_cast<std::size_t>(n) < offered;
+        return n;
+      }
+      if (errno == EINTR) {
+        continue;
+      }
+      if (errno == EAGAIN || errno == EWOULDBLOCK) {
+        write_blocked_ = true;
+        return 0;
+      }
+      owner->CloseLater(*this, errno);
+      return -1;
+    }
+  }
+
+  void Close() noexcept override {
+    owner->CloseLater(*this, 0);
+  }
+
+  void Open(int socket, ConnectionHandler& h) noexcept {
+    fd = socket;
+    handler = &h;
+    error = 0;
+    user_data = nullptr;
+    write_blocked_ = false;
+    closing_ = false;
+  }
+  void MarkClosing(int err) noexcept {
+    closing_ = true;
+    error = err;
+  }
+  bool TakeWritable() noexcept {
+    const bool was_blocked = write_blocked_;
+    write_blocked_ = false;
+    return was_blocked;
+  }
+  void SetId(uint32_t id) noexcept {
+    id_ = id;
+  }
+
+  EpollTransport* owner = nullptr;
+  ConnectionHandler* handler = nullptr;
+  int fd = -1;
+  int error = 0;
+  uint32_t gen = 0;
+};
+
+// -----------------------------------------------------------------------------
+// EpollTransport
+// -----------------------------------------------------------------------------
+
+EpollTransport::EpollTransport(const TransportConfig& config) noexcept
+                : config_(config) {}
+
+EpollTransport::~EpollTransport() {
+  if (conns_) {
+    for (std::size_t i = 0; i < config_.max_connections; ++i) {
+      if (conns_[i].fd >= 0) {
+        ::close(conns_[i].fd);
+      }
+    }
+  }
+  for (int fd : {listen_fd_, wake_fd_, epoll_fd_}) {
+    if (fd >= 0) {
+      ::close(fd);
+    }
+  }
+}
+
+TransportErrorCode EpollTransport::Init() noexcept {
+  if (ready_) {
+    return TRANSPORT_ERR::NONE;
+  }
+  if (epoll_fd_ >= 0) {
+    return TRANSPORT_ERR::INVALID_ARGS;  // an earlier Init() failed
+  }
+  if (config_.max_connections == 0 || config_.max_connections >= kWakeTag ||
+      config_.recv_buffer_size == 0) {
+    return TRANSPORT_ERR::INVALID_ARGS;
+  }
+
+  const std::size_t n = config_.max_connections;
+  conns_.reset(new (std::nothrow) Conn[n]);
+  recv_buffer_.reset(new (std::nothrow) uint8_t[config_.recv_buffer_size]);
+  if (!conns_ || !recv_buffer_) {
+    return TRANSPORT_ERR::OUT_OF_MEMORY;
+  }
+  free_.clear();
+  try {
+    free_.reserve(n);
+    closing_.reserve(n);
+  } catch (...) {
+    return TRANSPORT_ERR::OUT_OF_MEMORY;
+  }
+  for (std::size_t i = n; i-- > 0;) {
+    conns_[i].owner = this;
+    conns_[i].SetId(static_cast<uint32_t>(i));
+    free_.push_back(static_cast<uint32_t>(i));
+  }
+
+  epoll_fd_ = ::epoll_create1(EPOLL_CLOEXEC);
+  if (epoll_fd_ < 0) {
+    return SystemError(errno);
+  }
+  wake_fd_ = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (wake_fd_ < 0) {
+    return SystemError(errno);
+  }
+  epoll_event ev = {};
+  ev.events = EPOLLIN;
+  ev.data.u64 = kWakeTag;
+  if (::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, wake_fd_, &ev) != 0) {
+    return SystemError(errno);
+  }
+  ready_ = true;
+  return TRANSPORT_ERR::NONE;
+}
+
+TransportErrorCode EpollTransport::Listen(const char* ipv4, uint16_t port,
+                                          ConnectionHandler& handler) noexcept {
+  if (!ready_) {
+    return TRANSPORT_ERR::NOT_INITIALIZED;
+  }
+  if (listen_fd_ >= 0) {
+    return TRANSPORT_ERR::INVALID_ARGS;
+  }
+  const int fd = OpenListenSocket(ipv4, port, config_.backlog, true);
+  if (fd < 0) {
+    return SystemError(-fd);
+  }
+  epoll_event ev = {};
+  ev.events = EPOLLIN | EPOLLET;
+  ev.data.u64 = kListenTag;
+  if (::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &ev) != 0) {
+    const int err = errno;
+    ::close(fd);
+    return SystemError(err);
+  }
+  listen_fd_ = fd;
+  listen_port_ = LocalPort(fd);
+  listen_handler_ = &handler;
+  return TRANSPORT_ERR::NONE;
+}
+
+TransportErrorCode EpollTransport::Connect(const char* ipv4, uint16_t port,
+                                           ConnectionHandler& handler,
+                                           Connection** out) noexcept {
+  if (!ready_) {
+    return TRANSPORT_ERR::NOT_INITIALIZED;
+  }
+  const int fd = OpenClientSocket(ipv4, port);
+  if (fd < 0) {
+    return SystemError(-fd);
+  }
+  const int rc = ConfigureStream(fd, config_.no_delay, true);
+  if (rc < 0) {
+    ::close(fd);
+    return SystemError(-rc);
+  }
+  Conn* conn = Register(fd, handler);
+  if (!conn) {
+    ::close(fd);
+    return TRANSPORT_ERR::TOO_MANY_CONNECTIONS;
+  }
+  if (out) {
+    *out = conn;
+  }
+  handler.OnOpen(*conn);
+  return TRANSPORT_ERR::NONE;
+}
+
+EpollTransport::Conn* EpollTransport::Register(
+    int fd, ConnectionHandler& handler) noexcept {
+  if (free_.empty()) {
+    return nullptr;
+  }
+  const uint32_t slot = free_.back();
+  Conn& conn = conns_[slot];
+  epoll_event ev = {};
+  ev.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+  ev.data.u64 = MakeKey(conn.gen, slot);
+  if (::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &ev) != 0) {
+    last_errno_ = errno;
+    return nullptr;
+  }
+  free_.pop_back();
+  conn.Open(fd, handler);
+  open_++;
+  return &conn;
+}
+
+void EpollTransport::AcceptAll() noexcept {
+  for (;;) {
+    const int fd =
+        ::accept4(listen_fd_, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (fd < 0) {
+      if (errno == EINTR || errno == ECONNABORTED) {
+        continue;
+      }
+      // EAGAIN: drained; anything else (EMFILE...) is retried on the next
+      // edge rather than spinning here
+      return;
+    }
+    Conn* conn = nullptr;
+    if (ConfigureStream(fd, config_.no_delay, false) == 0) {
+      conn = Register(fd, *listen_handler_);
+    }
+    if (!conn) {
+      ::close(fd);
+      continue;
+    }
+    listen_handler_->OnOpen(*conn);
+  }
+}
+
+void EpollTransport::OnConnEvent(Conn& conn, uint32_t events) noexcept {
+  const bool hangup = events & (EPOLLRDHUP | EPOLLHUP | EPOLLERR);
+  if (events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) {
+    while (!conn.Closing()) {
+      const ssize_t n =
+          ::read(conn.fd, recv_buffer_.get(), config_.recv_buffer_size);
+      if (n > 0) {
+        conn.handler->OnRead(
+            conn, absl::MakeConstSpan(recv_buffer_.get(),
+                                      static_cast<std::size_t>(n)));
+        // a short read drained the socket; the next edge brings more, unless
+        // the peer is gone and the EOF still has to be read
+        if (static_cast<std::size_t>(n) < config_.recv_buffer_size &&
+            !hangup) {
+          break;
+        }
+        continue;
+      }
+      if (n == 0) {
+        CloseLater(conn, 0);
+        break;
+      }
+      if (errno == EINTR) {
+        continue;
+      }
+      if (errno != EAGAIN && errno != EWOULDBLOCK) {
+        CloseLater(conn, errno);
+      }
+      break;
+    }
+  }
+  if ((events & EPOLLERR) && !conn.Closing()) {
+    int err = 0;
+    socklen_t len = sizeof(err);
+    ::getsockopt(conn.fd, SOL_SOCKET, SO_ERROR, &err, &len);
+    CloseLater(conn, err ? err : EIO);
+  }
+  if ((events & EPOLLOUT) && !conn.Closing() && conn.TakeWritable()) {
+    conn.handler->OnWritable(conn);
+  }
+}
+
+void EpollTransport::CloseLater(Conn& conn, int error) noexcept {
+  if (conn.Closing() || conn.fd < 0) {
+    return;
+  }
+  conn.MarkClosing(error);
+  closing_.push_back(conn.Id());
+}
+
+void EpollTransport::FinishCloses() noexcept {
+  // OnClose() may close other connections; index, don't iterate
+  for (std::size_t i = 0; i < closing_.size(); ++i) {
+    Conn& conn = conns_[closing_[i]];
+    ::close(conn.fd);  // also drops it from the epoll set
+    conn.fd = -1;
+    conn.gen++;  // invalidates events still queued for the slot
+    open_--;
+    conn.handler->OnClose(conn, conn.error);
+    conn.handler = nullptr;
+    free_.push_back(conn.Id());
+  }
+  closing_.clear();
+}
+
+int EpollTransport::Poll(int timeout_ms) noexcept {
+  if (!ready_) {
+    return -TRANSPORT_ERR::NOT_INITIALIZED;
+  }
+  if (!closing_.empty()) {
+    // Close() was called outside Poll(): report it without waiting
+    timeout_ms = 0;
+  }
+  int n = ::epoll_wait(epoll_fd_, events_, kMaxEvents, timeout_ms);
+  if (n < 0) {
+    if (errno != EINTR) {
+      last_errno_ = errno;
+      return -TRANSPORT_ERR::SYSTEM_ERROR;
+    }
+    n = 0;
+  }
+  for (int i = 0; i < n; ++i) {
+    const uint64_t key = events_[i].data.u64;
+    if (key == kWakeTag) {
+      uint64_t count;
+      while (::read(wake_fd_, &count, sizeof(count)) > 0) {
+      }
+      continue;
+    }
+    if (key == kListenTag) {
+      AcceptAll();
+      continue;
+    }
+    Conn& conn = conns_[uint32_t(key)];
+    if (conn.fd < 0 || conn.gen != uint32_t(key >> 32)) {
+      continue;  // slot closed earlier in this batch
+    }
+    OnConnEvent(conn, events_[i].events);
+  }
+  FinishCloses();
+  return n;
+}
+
+void EpollTransport::Wake() noexcept {
+  const uint64_t one = 1;
+  ssize_t rc;
+  do {
+    rc = ::write(wake_fd_, &one, sizeof(one));
+  } while (rc < 0 && errno == EINTR);
+}
+
+}  // namespace transport
+}  // namespace h2v
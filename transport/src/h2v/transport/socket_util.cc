@@ -0,0 +1,101 @@
+// src/h2v/transport/socket_util.cc
+#include "h2v/transport/socket_util.h"
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+namespace h2v {
+namespace transport {
+
+namespace {
+
+bool MakeAddress(const char* ipv4, uint16_t port, sockaddr_in& addr) noexcept {
+  std::memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  return ipv4 && inet_pton(AF_INET, ipv4, &addr.sin_addr) == 1;
+}
+
+int FailClose(int fd) noexcept {
+  const int err = errno;
+  ::close(fd);
+  return -err;
+}
+
+}  // namespace
+
+int OpenListenSocket(const char* ipv4, uint16_t port, int backlog,
+                     bool non_blocking) noexcept {
+  sockaddr_in addr;
+  if (!MakeAddress(ipv4, port, addr)) {
+    return -EINVAL;
+  }
+  const int fd = ::socket(
+      AF_INET, SOCK_STREAM | SOCK_CLOEXEC | (non_blocking ? SOCK_NONBLOCK : 0),
+      0);
+  if (fd < 0) {
+    return -errno;
+  }
+  const int one = 1;
+  if (::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one)) != 0 ||
+      ::bind(fd, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) !=
+          0 ||
+      ::listen(fd, backlog) != 0) {
+    return FailClose(fd);
+  }
+  return fd;
+}
+
+int OpenClientSocket(const char* ipv4, uint16_t port) noexcept {
+  sockaddr_in addr;
+  if (!MakeAddress(ipv4, port, addr)) {
+    return -EINVAL;
+  }
+  const int fd = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (fd < 0) {
+    return -errno;
+  }
+  int rc;
+  do {
+    rc = ::connect(fd, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr));
+  } while (rc != 0 && errno == EINTR);
+  if (rc != 0) {
+    return FailClose(fd);
+  }
+  return fd;
+}
+
+uint16_t LocalPort(int fd) noexcept {
+  sockaddr_in addr;
+  socklen_t len = sizeof(addr);
+  if (::getsockname(fd, reinterpret_cast<sockaddr*>(&addr), &len) != 0) {
+    return 0;
+  }
+  return ntohs(addr.sin_port);
+}
+
+int ConfigureStream(int fd, bool no_delay, bool non_blocking) noexcept {
+  if (no_delay) {
+    const int one = 1;
+    if (::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one)) != 0) {
+      return -errno;
+    }
+  }
+  if (non_blocking) {
+    const int flags = ::fcntl(fd, F_GETFL, 0);
+    if (flags < 0 || ::fcntl(fd, F_SETFL, flags | O_NONBLOCK) != 0) {
+      return -errno;
+    }
+  }
+  return 0;
+}
+
+}  // namespace transport
+}  // namespace h2v
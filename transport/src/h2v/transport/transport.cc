@@ -0,0 +1,35 @@
+// src/h2v/transport/transport.cc
+#include "h2v/transport/transport.h"
+
+#include <new>
+
+#include "h2v/transport/epoll_transport.h"
+#if defined(H2V_HAVE_IO_URING)
+#include "h2v/transport/uring_transport.h"
+#endif
+
+namespace h2v {
+namespace transport {
+
+std::unique_ptr<Transport> CreateTransport(const TransportConfig& config,
+                                           bool prefer_io_uring) noexcept {
+#if defined(H2V_HAVE_IO_URING)
+  if (prefer_io_uring) {
+    std::unique_ptr<Transport> uring(new (std::nothrow)
+                                         UringTransport(config));
+    if (uring && uring->Init() == TRANSPORT_ERR::NONE) {
+      return uring;
+    }
+  }
+#else
+  (void)prefer_io_uring;
+#endif
+  std::unique_ptr<Transport> epoll(new (std::nothrow) EpollTransport(config));
+  if (epoll && epoll->Init() == TRANSPORT_ERR::NONE) {
+    return epoll;
+  }
+  return nullptr;
+}
+
+}  // namespace transport
+}  // namespace h2v
@@ -0,0 +1,698 @@
+// src/h2v/transport/uring_transport.cc
+#include "h2v/transport/uring_transport.h"
+
+#include <linux/io_uring.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <new>
+
+#include "h2v/transport/socket_util.h"
+
+namespace h2v {
+namespace transport {
+
+namespace {
+
+constexpr uint16_t kBufferGroup = 0;
+
+// user_data: operation << 56 | slot
+enum Op : uint64_t {
+  kOpAccept = 1,
+  kOpWake = 2,
+  kOpRecv = 3,
+  kOpSend = 4
+};
+
+uint64_t MakeKey(Op op, uint32_t slot) noexcept {
+  return (uint64_t(op) << 56) | slot;
+}
+
+int SysSetup(uint32_t entries, io_uring_params* p) noexcept {
+  return static_cast<int>(::syscall(__NR_io_uring_setup, entries, p));
+}
+
+int SysEnter(int fd, uint32_t to_submit, uint32_t min_complete, uint32_t flags,
+             const void* arg, std::size_t argsz) noexcept {
+  return static_cast<int>(::syscall(__NR_io_uring_enter, fd, to_submit,
+                                    min_complete, flags, arg, argsz));
+}
+
+int SysRegister(int fd, uint32_t opcode, const void* arg,
+                uint32_t nr_args) noexcept {
+  return static_cast<int>(
+      ::syscall(__NR_io_uring_register, fd, opcode, arg, nr_args));
+}
+
+template <typename T>
+T* At(void* base, uint32_t offset) noexcept {
+  return reinterpret_cast<T*>(static_cast<uint8_t*>(base) + offset);
+}
+
+}  // namespace
+
+// -----------------------------------------------------------------------------
+// UringTransport::Conn
+// -----------------------------------------------------------------------------
+
+class UringTransport::Conn final : public Connection {
+ public:
+  int64_t Writev(const struct iovec* iov, int iovcnt) noexcept override {
+    if (closing_ || fd < 0) {
+      return -1;
+    }
+    const std::size_t half = owner->config_.send_buffer_size;
+    if (!staging) {
+      staging.reset(new (std::nothrow) uint8_t[half * 2]);
+      if (!staging) {
+        owner->CloseLater(*this, ENOMEM);
+        return -1;
+      }
+    }
+    uint8_t* fill = staging.get() + fill_half * half;
+    std::size_t offered = 0;
+    std::size_t copied = 0;
+    for (int i = 0; i < iovcnt; ++i) {
+      offered += iov[i].iov_len;
+      const std::size_t n = std::min(iov[i].iov_len, half - fill_len);
+      if (n) {
+        std::memcpy(fill + fill_len, iov[i].iov_base, n);
+        fill_len += n;
+        copied += n;
+      }
+    }
+    if (copied < offered) {
+      write_blocked_ = true;
+    }
+    if (copied && !send_inflight && !owner->SubmitSend(*this)) {
+      return -1;
+    }
+    return static_cast<int64_t>(copied);
+  }
+
+  void Close() noexcept override {
+    owner->CloseLater(*this, 0);
+  }
+
+  void Open(int socket, ConnectionHandler& h) noexcept {
+    fd = socket;
+    handler = &h;
+    error = 0;
+    ops = 0;
+    queued = false;
+    send_inflight = false;
+    fill_half = 0;
+    fill_len = 0;
+    user_data = nullptr;
+    write_blocked_ = false;
+    closing_ = false;
+  }
+  void MarkClosing(int err) noexcept {
+    closing_ = true;
+    error = err;
+  }
+  bool TakeWritable() noexcept {
+    const bool was_blocked = write_blocked_;
+    write_blocked_ = false;
+    return was_blocked;
+  }
+  void SetId(uint32_t id) noexcept {
+    id_ = id;
+  }
+
+  UringTransport* owner = nullptr;
+  ConnectionHandler* handler = nullptr;
+  int fd = -1;
+  int error = 0;
+  uint32_t ops = 0;    ///< SQEs whose final CQE has not arrived
+  bool queued = false;  ///< on closing_
+
+  // two staging halves: one in flight, one filling
+  std::unique_ptr<uint8_t[]> staging;
+  bool send_inflight = false;
+  uint32_t fill_half = 0;
+  std::size_t fill_len = 0;
+  std::size_t inflight_len = 0;
+  std::size_t inflight_off = 0;
+
+  const uint8_t* InflightData() const noexcept {
+    return staging.get() + (fill_half ^ 1) * owner->config_.send_buffer_size +
+           inflight_off;
+  }
+};
+
+// -----------------------------------------------------------------------------
+// UringTransport
+// -----------------------------------------------------------------------------
+
+UringTransport::UringTransport(const TransportConfig& config) noexcept
+                : config_(config) {}
+
+UringTransport::~UringTransport() {
+  if (conns_) {
+    for (std::size_t i = 0; i < config_.max_connections; ++i) {
+      if (conns_[i].fd >= 0) {
+        ::close(conns_[i].fd);
+      }
+    }
+  }
+  if (listen_fd_ >= 0) {
+    ::close(listen_fd_);
+  }
+  if (buf_ring_registered_) {
+    io_uring_buf_reg reg;
+    std::memset(&reg, 0, sizeof(reg));
+    reg.bgid = kBufferGroup;
+    SysRegister(ring_fd_, IORING_UNREGISTER_PBUF_RING, &reg, 1);
+  }
+  if (ring_fd_ >= 0) {
+    ::close(ring_fd_);
+  }
+  if (wake_fd_ >= 0) {
+    ::close(wake_fd_);
+  }
+  if (buf_ring_) {
+    ::munmap(buf_ring_, buf_ring_size_);
+  }
+  if (sqes_) {
+    ::munmap(sqes_, sqes_size_);
+  }
+  if (cq_ring_ && cq_ring_ != sq_ring_) {
+    ::munmap(cq_ring_, cq_ring_size_);
+  }
+  if (sq_ring_) {
+    ::munmap(sq_ring_, sq_ring_size_);
+  }
+}
+
+TransportErrorCode UringTransport::Init() noexcept {
+  if (ready_) {
+    return TRANSPORT_ERR::NONE;
+  }
+  if (ring_fd_ >= 0) {
+    return TRANSPORT_ERR::INVALID_ARGS;  // an earlier Init() failed
+  }
+  const uint32_t nbuf = config_.recv_buffer_count;
+  if (config_.max_connections == 0 || config_.max_connections > 0xFFFFFFFFu ||
+      config_.recv_buffer_size == 0 || config_.recv_buffer_size > 0xFFFFFFFFu ||
+      config_.send_buffer_size == 0 || config_.queue_depth == 0 || nbuf == 0 ||
+      nbuf > 32768 || (nbuf & (nbuf - 1)) != 0) {
+    return TRANSPORT_ERR::INVALID_ARGS;
+  }
+
+  // ring
+  io_uring_params p;
+  std::memset(&p, 0, sizeof(p));
+  p.flags = IORING_SETUP_CQSIZE | IORING_SETUP_SUBMIT_ALL |
+            IORING_SETUP_COOP_TASKRUN;
+  p.cq_entries = config_.queue_depth * 4;
+  ring_fd_ = SysSetup(config_.queue_depth, &p);
+  if (ring_fd_ < 0 && errno == EINVAL) {
+    std::memset(&p, 0, sizeof(p));
+    p.flags = IORING_SETUP_CQSIZE;
+    p.cq_entries = config_.queue_depth * 4;
+    ring_fd_ = SysSetup(config_.queue_depth, &p);
+  }
+  if (ring_fd_ < 0) {
+    last_errno_ = errno;
+    return errno == ENOSYS || errno == EPERM ? TRANSPORT_ERR::UNSUPPORTED
+                                             : TRANSPORT_ERR::SYSTEM_ERROR;
+  }
+  if (!(p.features & IORING_FEAT_EXT_ARG)) {
+    return TRANSPORT_ERR::UNSUPPORTED;  // Poll() needs a timed wait
+  }
+
+  sq_ring_size_ = p.sq_off.array + p.sq_entries * sizeof(uint32_t);
+  cq_ring_size_ = p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe);
+  const bool single_mmap = p.features & IORING_FEAT_SINGLE_MMAP;
+  if (single_mmap) {
+    sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+  }
+  sq_ring_ = ::mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING);
+  if (sq_ring_ == MAP_FAILED) {
+    sq_ring_ = nullptr;
+    return SystemError(errno);
+  }
+  if (single_mmap) {
+    cq_ring_ = sq_ring_;
+  } else {
+    cq_ring_ = ::mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_CQ_RING);
+    if (cq_ring_ == MAP_FAILED) {
+      cq_ring_ = nullptr;
+      return SystemError(errno);
+    }
+  }
+  sqes_size_ = p.sq_entries * sizeof(io_uring_sqe);
+  void* sqes = ::mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES);
+  if (sqes == MAP_FAILED) {
+    return SystemError(errno);
+  }
+  sqes_ = static_cast<io_uring_sqe*>(sqes);
+
+  sq_head_ = At<uint32_t>(sq_ring_, p.sq_off.head);
+  sq_tail_ = At<uint32_t>(sq_ring_, p.sq_off.tail);
+  sq_mask_ = *At<uint32_t>(sq_ring_, p.sq_off.ring_mask);
+  sq_entries_ = p.sq_entries;
+  uint32_t* sq_array = At<uint32_t>(sq_ring_, p.sq_off.array);
+  for (uint32_t i = 0; i < sq_entries_; ++i) {
+    sq_array[i] = i;  // SQE slots are used in ring order
+  }
+  sqe_tail_ = *sq_tail_;
+  cq_head_ = At<uint32_t>(cq_ring_, p.cq_off.head);
+  cq_tail_ = At<uint32_t>(cq_ring_, p.cq_off.tail);
+  cq_mask_ = *At<uint32_t>(cq_ring_, p.cq_off.ring_mask);
+  cqes_ = At<io_uring_cqe>(cq_ring_, p.cq_off.cqes);
+
+  // provided buffer ring for multishot recv
+  buf_ring_size_ = nbuf * sizeof(io_uring_buf);
+  void* ring = ::mmap(nullptr, buf_ring_size_, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (ring == MAP_FAILED) {
+    return TRANSPORT_ERR::OUT_OF_MEMORY;
+  }
+  buf_ring_ = static_cast<io_uring_buf*>(ring);
+  io_uring_buf_reg reg;
+  std::memset(&reg, 0, sizeof(reg));
+  reg.ring_addr = reinterpret_cast<uint64_t>(buf_ring_);
+  reg.ring_entries = nbuf;
+  reg.bgid = kBufferGroup;
+  if (SysRegister(ring_fd_, IORING_REGISTER_PBUF_RING, &reg, 1) != 0) {
+    last_errno_ = errno;
+    return errno == EINVAL ? TRANSPORT_ERR::UNSUPPORTED
+                           : TRANSPORT_ERR::SYSTEM_ERROR;
+  }
+  buf_ring_registered_ = true;
+
+  const std::size_t n = config_.max_connections;
+  recv_buffers_.reset(new (std::nothrow)
+                          uint8_t[std::size_t(nbuf) * config_.recv_buffer_size]);
+  conns_.reset(new (std::nothrow) Conn[n]);
+  if (!recv_buffers_ || !conns_) {
+    return TRANSPORT_ERR::OUT_OF_MEMORY;
+  }
+  try {
+    free_.reserve(n);
+    closing_.reserve(n);
+  } catch (...) {
+    return TRANSPORT_ERR::OUT_OF_MEMORY;
+  }
+  for (std::size_t i = n; i-- > 0;) {
+    conns_[i].owner = this;
+    conns_[i].SetId(static_cast<uint32_t>(i));
+    free_.push_back(static_cast<uint32_t>(i));
+  }
+  for (uint32_t bid = 0; bid < nbuf; ++bid) {
+    RecycleBuffer(static_cast<uint16_t>(bid));
+  }
+
+  wake_fd_ = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (wake_fd_ < 0) {
+    return SystemError(errno);
+  }
+  if (!ArmWake()) {
+    return TRANSPORT_ERR::OUT_OF_MEMORY;
+  }
+  ready_ = true;
+  return TRANSPORT_ERR::NONE;
+}
+
+io_uring_sqe* UringTransport::GetSqe() noexcept {
+  for (int attempt = 0; attempt < 2; ++attempt) {
+    const uint32_t head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+    if (sqe_tail_ - head < sq_entries_) {
+      io_uring_sqe* sqe = &sqes_[sqe_tail_ & sq_mask_];
+      std::memset(sqe, 0, sizeof(*sqe));
+      sqe_tail_++;
+      return sqe;
+    }
+    Enter(0, 0);
+  }
+  return nullptr;
+}
+
+int UringTransport::Enter(uint32_t min_complete, int timeout_ms) noexcept {
+  __atomic_store_n(sq_tail_, sqe_tail_, __ATOMIC_RELEASE);
+  const uint32_t to_submit =
+      sqe_tail_ - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+  if (to_submit == 0 && min_complete == 0) {
+    return 0;
+  }
+  uint32_t flags = 0;
+  io_uring_getevents_arg arg;
+  __kernel_timespec ts;
+  const void* argp = nullptr;
+  std::size_t argsz = 0;
+  if (min_complete) {
+    flags |= IORING_ENTER_GETEVENTS;
+    if (timeout_ms >= 0) {
+      std::memset(&arg, 0, sizeof(arg));
+      ts.tv_sec = timeout_ms / 1000;
+      ts.tv_nsec = (timeout_ms % 1000) * 1000000LL;
+      arg.ts = reinterpret_cast<uint64_t>(&ts);
+      flags |= IORING_ENTER_EXT_ARG;
+      argp = &arg;
+      argsz = sizeof(arg);
+    }
+  }
+  const int rc =
+      SysEnter(ring_fd_, to_submit, min_complete, flags, argp, argsz);
+  if (rc < 0) {
+    // timeouts, signals and a full CQ only mean "reap what is there"
+    if (errno == ETIME || errno == EINTR || errno == EBUSY ||
+        errno == EAGAIN) {
+      return 0;
+    }
+    last_errno_ = errno;
+    return -1;
+  }
+  return rc;
+}
+
+void UringTransport::RecycleBuffer(uint16_t bid) noexcept {
+  const uint32_t mask = config_.recv_buffer_count - 1;
+  // io_uring_buf_ring::bufs is misplaced when the uapi header is compiled as
+  // C++ (its flexible-array wrapper gains a byte), so index the entries
+  // directly; the ring tail overlays entry 0's `resv`
+  io_uring_buf* buf = &buf_ring_[buf_tail_ & mask];
+  buf->addr = reinterpret_cast<uint64_t>(recv_buffers_.get() +
+                                         std::size_t(bid) *
+                                             config_.recv_buffer_size);
+  buf->len = static_cast<uint32_t>(config_.recv_buffer_size);
+  buf->bid = bid;
+  buf_tail_++;
+  __atomic_store_n(&buf_ring_[0].resv, buf_tail_, __ATOMIC_RELEASE);
+}
+
+bool UringTransport::ArmAccept() noexcept {
+  io_uring_sqe* sqe = GetSqe();
+  if (!sqe) {
+    return false;
+  }
+  sqe->opcode = IORING_OP_ACCEPT;
+  sqe->fd = listen_fd_;
+  sqe->ioprio = IORING_ACCEPT_MULTISHOT;
+  sqe->accept_flags = SOCK_CLOEXEC;
+  sqe->user_data = MakeKey(kOpAccept, 0);
+  return true;
+}
+
+bool UringTransport::ArmWake() noexcept {
+  io_uring_sqe* sqe = GetSqe();
+  if (!sqe) {
+    return false;
+  }
+  sqe->opcode = IORING_OP_POLL_ADD;
+  sqe->fd = wake_fd_;
+  sqe->len = IORING_POLL_ADD_MULTI;
+  sqe->poll32_events = POLLIN;
+  sqe->user_data = MakeKey(kOpWake, 0);
+  return true;
+}
+
+bool UringTransport::ArmRecv(Conn& conn) noexcept {
+  io_uring_sqe* sqe = GetSqe();
+  if (!sqe) {
+    CloseLater(conn, EBUSY);
+    return false;
+  }
+  sqe->opcode = IORING_OP_RECV;
+  sqe->fd = conn.fd;
+  sqe->ioprio = IORING_RECV_MULTISHOT;
+  sqe->flags = IOSQE_BUFFER_SELECT;
+  sqe->buf_group = kBufferGroup;
+  sqe->user_data = MakeKey(kOpRecv, conn.Id());
+  conn.ops++;
+  return true;
+}
+
+bool UringTransport::SubmitSend(Conn& conn) noexcept {
+  if (!conn.send_inflight) {
+    // the filled half goes out, the other one starts filling
+    conn.inflight_len = conn.fill_len;
+    conn.inflight_off = 0;
+    conn.fill_half ^= 1;
+    conn.fill_len = 0;
+  }
+  io_uring_sqe* sqe = GetSqe();
+  if (!sqe) {
+    CloseLater(conn, EBUSY);
+    return false;
+  }
+  sqe->opcode = IORING_OP_SEND;
+  sqe->fd = conn.fd;
+  sqe->addr = reinterpret_cast<uint64_t>(conn.InflightData());
+  sqe->len = static_cast<uint32_t>(conn.inflight_len - conn.inflight_off);
+  sqe->msg_flags = MSG_NOSIGNAL;
+  sqe->user_data = MakeKey(kOpSend, conn.Id());
+  conn.send_inflight = true;
+  conn.ops++;
+  return true;
+}
+
+TransportErrorCode UringTransport::Listen(const char* ipv4, uint16_t port,
+                                          ConnectionHandler& handler) noexcept {
+  if (!ready_) {
+    return TRANSPORT_ERR::NOT_INITIALIZED;
+  }
+  if (listen_fd_ >= 0) {
+    return TRANSPORT_ERR::INVALID_ARGS;
+  }
+  // blocking sockets: io_uring arms its own poll instead of failing EAGAIN
+  const int fd = OpenListenSocket(ipv4, port, config_.backlog, false);
+  if (fd < 0) {
+    return SystemError(-fd);
+  }
+  listen_fd_ = fd;
+  listen_port_ = LocalPort(fd);
+  listen_handler_ = &handler;
+  if (!ArmAccept()) {
+    return TRANSPORT_ERR::OUT_OF_MEMORY;
+  }
+  Enter(0, 0);
+  return TRANSPORT_ERR::NONE;
+}
+
+TransportErrorCode UringTransport::Connect(const char* ipv4, uint16_t port,
+                                           ConnectionHandler& handler,
+                                           Connection** out) noexcept {
+  if (!ready_) {
+    return TRANSPORT_ERR::NOT_INITIALIZED;
+  }
+  const int fd = OpenClientSocket(ipv4, port);
+  if (fd < 0) {
+    return SystemError(-fd);
+  }
+  const int rc = ConfigureStream(fd, config_.no_delay, false);
+  if (rc < 0) {
+    ::close(fd);
+    return SystemError(-rc);
+  }
+  Conn* conn = Register(fd, handler);
+  if (!conn) {
+    ::close(fd);
+    return TRANSPORT_ERR::TOO_MANY_CONNECTIONS;
+  }
+  if (out) {
+    *out = conn;
+  }
+  handler.OnOpen(*conn);
+  Enter(0, 0);
+  return TRANSPORT_ERR::NONE;
+}
+
+UringTransport::Conn* UringTransport::Register(
+    int fd, ConnectionHandler& handler) noexcept {
+  if (free_.empty()) {
+    return nullptr;
+  }
+  Conn& conn = conns_[free_.back()];
+  free_.pop_back();
+  conn.Open(fd, handler);
+  open_++;
+  ArmRecv(conn);
+  return &conn;
+}
+
+void UringTransport::OnRecv(Conn& conn, int32_t res, uint32_t flags) noexcept {
+  if (flags & IORING_CQE_F_BUFFER) {
+    const uint16_t bid = uint16_t(flags >> IORING_CQE_BUFFER_SHIFT);
+    if (res > 0 && !conn.Closing()) {
+      conn.handler->OnRead(
+          conn, absl::MakeConstSpan(recv_buffers_.get() +
+                                        std::size_t(bid) *
+                                            config_.recv_buffer_size,
+                                    static_cast<std::size_t>(res)));
+    }
+    RecycleBuffer(bid);
+  }
+  if (flags & IORING_CQE_F_MORE) {
+    return;
+  }
+  conn.ops--;
+  if (conn.Closing()) {
+    return;
+  }
+  if (res > 0 || res == -ENOBUFS) {
+    // multishot ended (buffers ran dry, or the kernel capped it): re-arm
+    ArmRecv(conn);
+  } else {
+    CloseLater(conn, res == 0 ? 0 : -res);
+  }
+}
+
+void UringTransport::OnSend(Conn& conn, int32_t res) noexcept {
+  conn.ops--;
+  if (conn.Closing() || res <= 0) {
+    conn.send_inflight = false;
+    CloseLater(conn, res < 0 ? -res : EPIPE);
+    return;
+  }
+  conn.inflight_off += static_cast<std::size_t>(res);
+  if (conn.inflight_off < conn.inflight_len) {
+    SubmitSend(conn);  // short send: the rest of the same half
+    return;
+  }
+  conn.send_inflight = false;
+  if (conn.fill_len > 0 && !SubmitSend(conn)) {
+    return;
+  }
+  if (conn.TakeWritable()) {
+    conn.handler->OnWritable(conn);
+  }
+}
+
+void UringTransport::Dispatch(uint64_t user_data, int32_t res,
+                              uint32_t flags) noexcept {
+  const uint32_t slot = static_cast<uint32_t>(user_data);
+  switch (static_cast<Op>(user_data >> 56)) {
+    case kOpAccept: {
+      if (res >= 0) {
+        Conn* conn = nullptr;
+        if (ConfigureStream(res, config_.no_delay, false) == 0) {
+          conn = Register(res, *listen_handler_);
+        }
+        if (conn) {
+          listen_handler_->OnOpen(*conn);
+        } else {
+          ::close(res);
+        }
+      }
+      if (!(flags & IORING_CQE_F_MORE) && listen_fd_ >= 0) {
+        ArmAccept();
+      }
+      break;
+    }
+    case kOpWake: {
+      uint64_t count;
+      while (::read(wake_fd_, &count, sizeof(count)) > 0) {
+      }
+      if (!(flags & IORING_CQE_F_MORE)) {
+        ArmWake();
+      }
+      break;
+    }
+    case kOpRecv:
+      OnRecv(conns_[slot], res, flags);
+      MaybeFinish(conns_[slot]);
+      break;
+    case kOpSend:
+      OnSend(conns_[slot], res);
+      MaybeFinish(conns_[slot]);
+      break;
+  }
+}
+
+int UringTransport::Reap() noexcept {
+  int n = 0;
+  uint32_t head = *cq_head_;
+  for (;;) {
+    const uint32_t tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+    if (head == tail) {
+      break;
+    }
+    while (head != tail) {
+      const io_uring_cqe& cqe = cqes_[head & cq_mask_];
+      const uint64_t user_data = cqe.user_data;
+      const int32_t res = cqe.res;
+      const uint32_t flags = cqe.flags;
+      // release the slot before dispatching: handlers may submit more
+      __atomic_store_n(cq_head_, ++head, __ATOMIC_RELEASE);
+      Dispatch(user_data, res, flags);
+      n++;
+    }
+  }
+  return n;
+}
+
+void UringTransport::CloseLater(Conn& conn, int error) noexcept {
+  if (conn.Closing() || conn.fd < 0) {
+    return;
+  }
+  conn.MarkClosing(error);
+  // completes the multishot recv and any send still in flight
+  ::shutdown(conn.fd, SHUT_RDWR);
+  MaybeFinish(conn);
+}
+
+void UringTransport::MaybeFinish(Conn& conn) noexcept {
+  if (conn.Closing() && conn.ops == 0 && !conn.queued) {
+    conn.queued = true;
+    closing_.push_back(conn.Id());
+  }
+}
+
+void UringTransport::FinishCloses() noexcept {
+  // OnClose() may close other connections; index, don't iterate
+  for (std::size_t i = 0; i < closing_.size(); ++i) {
+    Conn& conn = conns_[closing_[i]];
+    ::close(conn.fd);
+    conn.fd = -1;
+    open_--;
+    conn.handler->OnClose(conn, conn.error);
+    conn.handler = nullptr;
+    free_.push_back(conn.Id());
+  }
+  closing_.clear();
+}
+
+int UringTransport::Poll(int timeout_ms) noexcept {
+  if (!ready_) {
+    return -TRANSPORT_ERR::NOT_INITIALIZED;
+  }
+  const bool ready = *cq_head_ != __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+  if (!closing_.empty() || ready) {
+    timeout_ms = 0;
+  }
+  if (Enter(timeout_ms != 0 ? 1 : 0, timeout_ms) < 0) {
+    return -TRANSPORT_ERR::SYSTEM_ERROR;
+  }
+  const int n = Reap();
+  FinishCloses();
+  // sends queued by the handlers go out now, not on the next Poll()
+  if (Enter(0, 0) < 0) {
+    return -TRANSPORT_ERR::SYSTEM_ERROR;
+  }
+  return n;
+}
+
+void UringTransport::Wake() noexcept {
+  const uint64_t one = 1;
+  ssize_t rc;
+  do {
+    rc = ::write(wake_fd_, &one, sizeof(one));
+  } while (rc < 0 && errno == EINTR);
+}
+
+}  // namespace transport
+}  // namespace h2v